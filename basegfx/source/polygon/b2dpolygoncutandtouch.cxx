@@ -565,39 +565,50 @@ namespace basegfx
             }
             else
             {
-                B2DPoint aCurrA(rCandidate.getB2DPoint(0));
+                // sort the edges by their left end and sweep over them, so that
+                // only edges with overlapping x ranges get compared instead of
+                // every pair of edges
+                std::vector<B2DRange> aRanges;
+                std::vector<sal_uInt32> aOrder(nEdgeCount);
+                aRanges.reserve(nEdgeCount);
+
+                for(sal_uInt32 a(0); a < nEdgeCount; a++)
+                {
+                    aRanges.emplace_back(rCandidate.getB2DPoint(a), rCandidate.getB2DPoint(a + 1 == nPointCount ? 0 : a + 1));
+                    aOrder[a] = a;
+                }
 
-                for(sal_uInt32 a(0); a < nEdgeCount - 1; a++)
+                // stable_sort stays within bounds even with NaN coordinates
+                std::stable_sort(aOrder.begin(), aOrder.end(),
+                    [&aRanges](sal_uInt32 nA, sal_uInt32 nB)
+                    { return aRanges[nA].getMinX() < aRanges[nB].getMinX(); });
+
+                for(sal_uInt32 i(0); i < nEdgeCount; i++)
                 {
-                    const B2DPoint aNextA(rCandidate.getB2DPoint(a + 1 == nPointCount ? 0 : a + 1));
-                    const B2DRange aRangeA(aCurrA, aNextA);
-                    B2DPoint aCurrB(rCandidate.getB2DPoint(a + 1));
+                    const double fMaxX(aRanges[aOrder[i]].getMaxX());
 
-                    for(sal_uInt32 b(a + 1); b < nEdgeCount; b++)
+                    for(sal_uInt32 j(i + 1); j < nEdgeCount && aRanges[aOrder[j]].getMinX() <= fMaxX; j++)
                     {
-                        const B2DPoint aNextB(rCandidate.getB2DPoint(b + 1 == nPointCount ? 0 : b + 1));
-                        const B2DRange aRangeB(aCurrB, aNextB);
+                        const sal_uInt32 a(std::min(aOrder[i], aOrder[j]));
+                        const sal_uInt32 b(std::max(aOrder[i], aOrder[j]));
 
                         // consecutive segments touch of course
                         bool bOverlap = false;
                         if( b > a+1)
-                            bOverlap = aRangeA.overlaps(aRangeB);
+                            bOverlap = aRanges[a].overlaps(aRanges[b]);
                         else
-                            bOverlap = aRangeA.overlapsMore(aRangeB);
+                            bOverlap = aRanges[a].overlapsMore(aRanges[b]);
                         if( bOverlap)
                         {
-                            findEdgeCutsTwoEdges(aCurrA, aNextA, aCurrB, aNextB, a, b, rTempPoints, rTempPoints);
+                            findEdgeCutsTwoEdges(
+                                rCandidate.getB2DPoint(a), rCandidate.getB2DPoint(a + 1 == nPointCount ? 0 : a + 1),
+                                rCandidate.getB2DPoint(b), rCandidate.getB2DPoint(b + 1 == nPointCount ? 0 : b + 1),
+                                a, b, rTempPoints, rTempPoints);
                         }
-
-                        if (pPointLimit && rTempPoints.size() > *pPointLimit)
-                            break;
-
-                        // prepare next step
-                        aCurrB = aNextB;
                     }
 
-                    // prepare next step
-                    aCurrA = aNextA;
+                    if (pPointLimit && rTempPoints.size() > *pPointLimit)
+                        break;
                 }
             }
 
@@ -2064,8 +2064,7 @@ void SbUnoObject::Notify( SfxBroadcaster& rBC, const SfxHint& rHint )
                         }
                     }
                     // get the value
-                    Reference< XPropertySet > xPropSet( mxUnoAccess->queryAdapter( cppu::UnoType<XPropertySet>::get()), UNO_QUERY );
-                    Any aRetAny = xPropSet->getPropertyValue( pProp->GetName() );
+                    Any aRetAny = getPropertySetAdapter()->getPropertyValue( pProp->GetName() );
                     // The use of getPropertyValue (instead of using the index) is
                     // suboptimal, but the refactoring to XInvocation is already pending
                     // Otherwise it is possible to use FastPropertySet
@@ -2135,8 +2134,7 @@ void SbUnoObject::Notify( SfxBroadcaster& rBC, const SfxHint& rHint )
                 try
                 {
                     // set the value
-                    Reference< XPropertySet > xPropSet( mxUnoAccess->queryAdapter( cppu::UnoType<XPropertySet>::get()), UNO_QUERY );
-                    xPropSet->setPropertyValue( pProp->GetName(), aAnyValue );
+                    getPropertySetAdapter()->setPropertyValue( pProp->GetName(), aAnyValue );
                     // The use of getPropertyValue (instead of using the index) is
                     // suboptimal, but the refactoring to XInvocation is already pending
                     // Otherwise it is possible to use FastPropertySet
@@ -2764,6 +2762,15 @@ void SbUnoObject::implCreateDbgProperties()
     QuickInsert( xVarRef.get() );
 }
 
+const Reference< XPropertySet >& SbUnoObject::getPropertySetAdapter()
+{
+    // The adapter only depends on the introspected object, which doesn't change,
+    // so don't query it again for every property access e.g. in a macro loop
+    if( !mxPropertySetAdapter.is() )
+        mxPropertySetAdapter.set( mxUnoAccess->queryAdapter( cppu::UnoType<XPropertySet>::get() ), UNO_QUERY );
+    return mxPropertySetAdapter;
+}
+
 void SbUnoObject::implCreateAll()
 {
     // throw away all existing methods and properties
@@ -26,6 +26,7 @@
 #include <com/sun/star/beans/XMaterialHolder.hpp>
 #include <com/sun/star/beans/XExactName.hpp>
 #include <com/sun/star/beans/XIntrospectionAccess.hpp>
+#include <com/sun/star/beans/XPropertySet.hpp>
 #include <com/sun/star/lang/XComponent.hpp>
 #include <com/sun/star/script/XInvocation.hpp>
 #include <com/sun/star/reflection/XIdlClass.hpp>
@@ -106,6 +107,8 @@ class SbUnoObject: public SbxObject
     css::uno::Reference< css::script::XInvocation > mxInvocation;
     css::uno::Reference< css::beans::XExactName > mxExactName;
     css::uno::Reference< css::beans::XExactName > mxExactNameInvocation;
+    // XPropertySet adapter of mxUnoAccess, created on first property access
+    css::uno::Reference< css::beans::XPropertySet > mxPropertySetAdapter;
     bool bNeedIntrospection;
     bool bNativeCOMObject;
     css::uno::Any maTmpUnoObj; // Only to save obj for doIntrospection!
@@ -117,6 +120,8 @@ class SbUnoObject: public SbxObject
     // (on the on-demand-mechanism required for the dbg_-properties)
     void implCreateAll();
 
+    const css::uno::Reference< css::beans::XPropertySet >& getPropertySetAdapter();
+
 public:
     static bool getDefaultPropName( SbUnoObject const * pUnoObj, OUString& sDfltProp );
     SbUnoObject( const OUString& aName_, const css::uno::Any& aUnoObj_ );
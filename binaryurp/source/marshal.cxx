@@ -241,13 +241,46 @@ void Marshal::writeValue(
                     type.get())->
                 pType);
             assert(ctd.is());
-            if (ctd.get()->eTypeClass == typelib_TypeClass_BYTE) {
+            // Write elements of primitive type directly, without going
+            // through writeValue for each of them:
+            switch (ctd.get()->eTypeClass) {
+            case typelib_TypeClass_BYTE:
                 buffer->insert(
                     buffer->end(), p->elements, p->elements + p->nElements);
-            } else {
+                break;
+            case typelib_TypeClass_SHORT:
+            case typelib_TypeClass_UNSIGNED_SHORT:
+            case typelib_TypeClass_CHAR:
+                for (sal_Int32 i = 0; i != p->nElements; ++i) {
+                    write16(
+                        buffer,
+                        reinterpret_cast< sal_uInt16 const * >(p->elements)[i]);
+                }
+                break;
+            case typelib_TypeClass_LONG:
+            case typelib_TypeClass_UNSIGNED_LONG:
+            case typelib_TypeClass_FLOAT:
+            case typelib_TypeClass_ENUM:
+                for (sal_Int32 i = 0; i != p->nElements; ++i) {
+                    write32(
+                        buffer,
+                        reinterpret_cast< sal_uInt32 const * >(p->elements)[i]);
+                }
+                break;
+            case typelib_TypeClass_HYPER:
+            case typelib_TypeClass_UNSIGNED_HYPER:
+            case typelib_TypeClass_DOUBLE:
+                for (sal_Int32 i = 0; i != p->nElements; ++i) {
+                    write64(
+                        buffer,
+                        reinterpret_cast< sal_uInt64 const * >(p->elements)[i]);
+                }
+                break;
+            default:
                 for (sal_Int32 i = 0; i != p->nElements; ++i) {
                     writeValue(buffer, ctd, p->elements + i * ctd.get()->nSize);
                 }
+                break;
             }
             break;
         }
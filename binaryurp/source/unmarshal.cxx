@@ -437,6 +437,60 @@ BinaryAny Unmarshal::readSequence(css::uno::TypeDescription const & type) {
         sal_Sequence * p = s.getHandle();
         return BinaryAny(type, &p);
     }
+    switch (ctd.get()->eTypeClass) {
+    case typelib_TypeClass_SHORT:
+    case typelib_TypeClass_UNSIGNED_SHORT:
+    case typelib_TypeClass_CHAR:
+    case typelib_TypeClass_LONG:
+    case typelib_TypeClass_UNSIGNED_LONG:
+    case typelib_TypeClass_FLOAT:
+    case typelib_TypeClass_HYPER:
+    case typelib_TypeClass_UNSIGNED_HYPER:
+    case typelib_TypeClass_DOUBLE:
+        {
+            // Values of these types need no checking and have the same size
+            // in the block as in memory, so read them directly into the new
+            // sequence instead of going through a BinaryAny for each:
+            sal_Int32 nSize = ctd.get()->nSize;
+            assert(nSize == 2 || nSize == 4 || nSize == 8);
+            if (static_cast< sal_uInt64 >(end_ - data_) <
+                (static_cast< sal_uInt64 >(n) *
+                 static_cast< sal_uInt64 >(nSize)))
+            {
+                throw css::io::IOException(
+                    "binaryurp::Unmarshal: trying to read past end of block");
+            }
+            void * buf = allocate(
+                SAL_SEQUENCE_HEADER_SIZE +
+                static_cast< sal_Size >(n) * static_cast< sal_Size >(nSize));
+            sal_Sequence * seq = static_cast< sal_Sequence * >(buf);
+            seq->nRefCount = 0;
+            seq->nElements = static_cast< sal_Int32 >(n);
+            switch (nSize) {
+            case 2:
+                for (sal_uInt32 i = 0; i != n; ++i) {
+                    reinterpret_cast< sal_uInt16 * >(seq->elements)[i] =
+                        read16();
+                }
+                break;
+            case 4:
+                for (sal_uInt32 i = 0; i != n; ++i) {
+                    reinterpret_cast< sal_uInt32 * >(seq->elements)[i] =
+                        read32();
+                }
+                break;
+            default:
+                for (sal_uInt32 i = 0; i != n; ++i) {
+                    reinterpret_cast< sal_uInt64 * >(seq->elements)[i] =
+                        read64();
+                }
+                break;
+            }
+            return BinaryAny(type, &buf);
+        }
+    default:
+        break;
+    }
     std::vector< BinaryAny > as;
     as.reserve(n);
     for (sal_uInt32 i = 0; i != n; ++i) {
@@ -43,13 +43,6 @@
 
 namespace binaryurp {
 
-Writer::Item::Item()
-    : request(false)
-    , setter(false)
-    , exception(false)
-    , setCurrentContextMode(false)
-{}
-
 Writer::Item::Item(
     rtl::ByteSequence theTid, OUString theOid,
     css::uno::TypeDescription theType,
@@ -75,7 +68,7 @@ Writer::Item::Item(
 
 Writer::Writer(rtl::Reference< Bridge > const  & bridge):
     Thread("binaryurpWriter"), bridge_(bridge), marshal_(bridge, state_),
-    stop_(false)
+    batch_(false), blockMessages_(0), blockReplies_(0), stop_(false)
 {
     assert(bridge.is());
 }
@@ -149,36 +142,42 @@ void Writer::execute() {
         unblocked_.wait();
         for (;;) {
             items_.wait();
-            Item item;
+            std::deque< Item > items;
             {
                 std::lock_guard g(mutex_);
                 if (stop_) {
                     return;
                 }
                 assert(!queue_.empty());
-                item = queue_.front();
-                queue_.pop_front();
-                if (queue_.empty()) {
-                    items_.reset();
-                }
+                items.swap(queue_);
+                items_.reset();
             }
-            if (item.request) {
-                sendRequest(
-                    item.tid, item.oid, item.type, item.member, item.arguments,
-                    (item.oid != "UrpProtocolProperties" &&
-                     !item.member.equals(
-                         css::uno::TypeDescription(
-                             "com.sun.star.uno.XInterface::release")) &&
-                     bridge_->isCurrentContextMode()),
-                    item.currentContext);
-            } else {
-                sendReply(
-                    item.tid, item.member, item.setter, item.exception,
-                    item.returnValue, item.arguments);
-                if (item.setCurrentContextMode) {
-                    bridge_->setCurrentContextMode();
+            // Send all the messages queued meanwhile (e.g., a burst of oneway
+            // calls) in as few blocks as possible, instead of doing a
+            // connection write for each of them:
+            batch_ = items.size() > 1;
+            for (Item const & item : items) {
+                if (item.request) {
+                    sendRequest(
+                        item.tid, item.oid, item.type, item.member,
+                        item.arguments,
+                        (item.oid != "UrpProtocolProperties" &&
+                         !item.member.equals(
+                             css::uno::TypeDescription(
+                                 "com.sun.star.uno.XInterface::release")) &&
+                         bridge_->isCurrentContextMode()),
+                        item.currentContext);
+                } else {
+                    sendReply(
+                        item.tid, item.member, item.setter, item.exception,
+                        item.returnValue, item.arguments);
+                    if (item.setCurrentContextMode) {
+                        bridge_->setCurrentContextMode();
+                    }
                 }
             }
+            flushBlock();
+            batch_ = false;
         }
     } catch (const css::uno::Exception & e) {
         SAL_INFO("binaryurp", "caught " << e);
@@ -404,17 +403,55 @@ void Writer::sendReply(
     }
     sendMessage(buf);
     lastTid_ = tid;
-    bridge_->decrementCalls();
+    if (batch_) {
+        // only done once the reply has actually been written, see flushBlock:
+        ++blockReplies_;
+    } else {
+        bridge_->decrementCalls();
+    }
 }
 
 void Writer::sendMessage(std::vector< unsigned char > const & buffer) {
+    if (!batch_) {
+        writeBlock(buffer, 1);
+        return;
+    }
+    // Keep blocks of batched messages reasonably small, a large message is
+    // better sent on its own than copied into the block:
+    if (blockMessages_ != 0
+        && block_.size() + buffer.size() > MAX_BATCHED_BLOCK_SIZE)
+    {
+        flushBlock();
+    }
+    if (blockMessages_ == 0 && buffer.size() > MAX_BATCHED_BLOCK_SIZE) {
+        writeBlock(buffer, 1);
+        return;
+    }
+    block_.insert(block_.end(), buffer.begin(), buffer.end());
+    ++blockMessages_;
+}
+
+void Writer::flushBlock() {
+    if (blockMessages_ != 0) {
+        writeBlock(block_, blockMessages_);
+        block_.clear();
+        blockMessages_ = 0;
+    }
+    for (; blockReplies_ != 0; --blockReplies_) {
+        bridge_->decrementCalls();
+    }
+}
+
+void Writer::writeBlock(
+    std::vector< unsigned char > const & buffer, sal_uInt32 messages)
+{
     std::vector< unsigned char > header;
     if (buffer.size() > SAL_MAX_UINT32) {
         throw css::uno::RuntimeException(
             "message too large for URP");
     }
     Marshal::write32(&header, static_cast< sal_uInt32 >(buffer.size()));
-    Marshal::write32(&header, 1);
+    Marshal::write32(&header, messages);
     assert(!buffer.empty());
     unsigned char const * p = buffer.data();
     std::vector< unsigned char >::size_type n = buffer.size();
@@ -21,6 +21,7 @@
 
 #include <sal/config.h>
 
+#include <cstddef>
 #include <deque>
 #include <mutex>
 #include <vector>
@@ -99,9 +100,14 @@ private:
 
     void sendMessage(std::vector< unsigned char > const & buffer);
 
-    struct Item {
-        Item();
+    void flushBlock();
+
+    void writeBlock(
+        std::vector< unsigned char > const & buffer, sal_uInt32 messages);
 
+    static constexpr std::size_t MAX_BATCHED_BLOCK_SIZE = 65536;
+
+    struct Item {
         // Request:
         Item(
             rtl::ByteSequence theTid, OUString theOid,
@@ -137,6 +143,12 @@ private:
     com::sun::star::uno::TypeDescription lastType_;
     OUString lastOid_;
     rtl::ByteSequence lastTid_;
+    // Only used by the Bridge::writer_ thread, to combine the messages of all
+    // items taken from queue_ at once into blocks:
+    bool batch_;
+    std::vector< unsigned char > block_;
+    sal_uInt32 blockMessages_;
+    std::size_t blockReplies_;
     osl::Condition unblocked_;
     osl::Condition items_;
 
@@ -44,6 +44,8 @@
 #include <com/sun/star/beans/XPropertySet.hpp>
 #include <officecfg/Office/Compatibility.hxx>
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 
 namespace chart
@@ -209,6 +211,44 @@ static void lcl_removeDuplicatePoints( std::vector<std::vector<css::drawing::Pos
     rPolyPoly = std::move(aTmp);
 }
 
+// Of a run of consecutive points that fall into the same column at the given
+// resolution keep only the first, the lowest, the highest and the last one:
+// the line drawn through them looks the same, but for big data series it has
+// far fewer points.
+static void lcl_reduceToColumnExtremes( std::vector<std::vector<css::drawing::Position3D>>& rPolyPoly, PlottingPositionHelper& rPosHelper )
+{
+    for( auto& rPoly : rPolyPoly )
+    {
+        const size_t nPointCount = rPoly.size();
+        size_t nTargetPointCount = 0;
+        size_t nRunStart = 0;
+        while( nRunStart < nPointCount )
+        {
+            size_t nRunEnd = nRunStart + 1;
+            size_t nMin = nRunStart;
+            size_t nMax = nRunStart;
+            while( nRunEnd < nPointCount
+                   && rPosHelper.isSameXForGivenResolution( rPoly[nRunStart].PositionX, rPoly[nRunEnd].PositionX ) )
+            {
+                if( rPoly[nRunEnd].PositionY < rPoly[nMin].PositionY )
+                    nMin = nRunEnd;
+                if( rPoly[nRunEnd].PositionY > rPoly[nMax].PositionY )
+                    nMax = nRunEnd;
+                ++nRunEnd;
+            }
+
+            const size_t aKeep[] = { nRunStart, std::min( nMin, nMax ), std::max( nMin, nMax ), nRunEnd - 1 };
+            for( size_t i = 0; i < std::size( aKeep ); ++i )
+            {
+                if( i == 0 || aKeep[i] != aKeep[i - 1] )
+                    rPoly[nTargetPointCount++] = rPoly[aKeep[i]];
+            }
+            nRunStart = nRunEnd;
+        }
+        rPoly.resize( nTargetPointCount );
+    }
+}
+
 bool AreaChart::create_stepped_line(
         std::vector<std::vector<css::drawing::Position3D>> aStartPoly,
         chart2::CurveStyle eCurveStyle,
@@ -359,6 +399,8 @@ bool AreaChart::impl_createLine( VDataSeries* pSeries
     { // default to creating a straight line
         SAL_WARN_IF(m_eCurveStyle != CurveStyle_LINES, "chart2.areachart", "Unknown curve style");
         Clipping::clipPolygonAtRectangle( *pSeriesPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
+        if( m_nDimension != 3 )
+            lcl_reduceToColumnExtremes( aPoly, *pPosHelper );
     }
 
     if(!ShapeFactory::hasPolygonAnyLines(aPoly))
@@ -101,6 +101,7 @@ public:
     inline void   setCoordinateSystemResolution( const css::uno::Sequence< sal_Int32 >& rCoordinateSystemResolution );
     inline bool   isSameForGivenResolution( double fX, double fY, double fZ
                                 , double fX2, double fY2, double fZ2 );
+    inline bool   isSameXForGivenResolution( double fX, double fX2 );
 
     inline bool   isStrongLowerRequested( sal_Int32 nDimensionIndex ) const;
     inline bool   isLogicVisible( double fX, double fY, double fZ ) const;
@@ -317,6 +318,21 @@ bool PlottingPositionHelper::isSameForGivenResolution( double fX, double fY, dou
     return (bSameX && bSameY && bSameZ);
 }
 
+bool PlottingPositionHelper::isSameXForGivenResolution( double fX, double fX2 /*these values are expected to be scaled already*/ )
+{
+    if( !std::isfinite(fX) || !std::isfinite(fX2) )
+        return false;
+
+    double fScaledMinX = getLogicMinX();
+    double fScaledMaxX = getLogicMaxX();
+
+    doLogicScaling( &fScaledMinX, nullptr, nullptr );
+    doLogicScaling( &fScaledMaxX, nullptr, nullptr );
+
+    return ( static_cast<sal_Int32>(m_nXResolution*(fX - fScaledMinX)/(fScaledMaxX-fScaledMinX))
+                == static_cast<sal_Int32>(m_nXResolution*(fX2 - fScaledMinX)/(fScaledMaxX-fScaledMinX)) );
+}
+
 bool PlottingPositionHelper::isStrongLowerRequested( sal_Int32 nDimensionIndex ) const
 {
     if( m_aScales.empty() )
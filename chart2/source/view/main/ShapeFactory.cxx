@@ -1905,18 +1905,18 @@ rtl::Reference<SvxShapePolyPolygon>
         return nullptr;
 
     //create shape
-    rtl::Reference<SvxShapePolyPolygon> xShape = new SvxShapePolyPolygon(nullptr);
-    xShape->setShapeKind(SdrObjKind::PolyLine);
-    xTarget->addShape(*xShape);
-
-    drawing::PointSequenceSequence aAnyPoints = PolyToPointSequence(rPoints);
+    rtl::Reference<SdrPathObj> pPath = new SdrPathObj(xTarget->GetSdrObject()->getSdrModelFromSdrObject(), SdrObjKind::PolyLine);
+    xTarget->GetSdrObject()->GetSubList()->InsertObject(pPath.get());
+    rtl::Reference<SvxShapePolyPolygon> xShape = static_cast<SvxShapePolyPolygon*>(pPath->getUnoShape().get());
 
     //set properties
     try
     {
-        //Polygon
-        xShape->SvxShape::setPropertyValue( UNO_NAME_POLYPOLYGON
-            , uno::Any( aAnyPoints ) );
+        // Polygon, set directly instead of going through a PointSequenceSequence
+        basegfx::B2DPolyPolygon aNewPolyPolygon( PolyToB2DPolyPolygon(rPoints) );
+        // tdf#117145 metric of SdrModel is app-specific, metric of UNO API is 100thmm
+        pPath->ForceMetricToItemPoolMetric(aNewPolyPolygon);
+        pPath->SetPathPoly(aNewPolyPolygon);
 
         if(pLineProperties)
         {
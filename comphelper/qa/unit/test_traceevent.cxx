@@ -106,7 +106,7 @@ void TestTraceEvent::test()
 
     CPPUNIT_ASSERT_EQUAL(9, static_cast<int>(aEvents.size()));
 
-    CPPUNIT_ASSERT(aEvents[0].startsWith("{\"name:\"instant1\",\"ph\":\"i\","));
+    CPPUNIT_ASSERT(aEvents[0].startsWith("{\"name\":\"instant1\",\"ph\":\"i\","));
     CPPUNIT_ASSERT(aEvents[1].startsWith("{\"name\":\"async2.5\",\"ph\":\"S\",\"id\":1,"));
     CPPUNIT_ASSERT(aEvents[2].startsWith("{\"name\":\"block2\",\"ph\":\"X\","));
     CPPUNIT_ASSERT(aEvents[3].startsWith(
@@ -114,7 +114,7 @@ void TestTraceEvent::test()
     CPPUNIT_ASSERT(aEvents[4].startsWith("{\"name\":\"block3\",\"ph\":\"X\","));
     CPPUNIT_ASSERT(aEvents[5].startsWith("{\"name\":\"async2.5\",\"ph\":\"F\",\"id\":1,"));
     CPPUNIT_ASSERT(aEvents[6].startsWith(
-        "{\"name:\"instant2\",\"ph\":\"i\",\"args\":{\"foo2\":\"bar2\",\"tem2\":\"42\"},"));
+        "{\"name\":\"instant2\",\"ph\":\"i\",\"args\":{\"foo2\":\"bar2\",\"tem2\":\"42\"},"));
     CPPUNIT_ASSERT(aEvents[7].startsWith("{\"name\":\"test2\",\"ph\":\"X\""));
     CPPUNIT_ASSERT(aEvents[8].startsWith(
         "{\"name\":\"async3\",\"ph\":\"F\",\"id\":2,\"args\":{\"foo\":\"bar\",\"tem\":\"42\"},"));
@@ -225,7 +225,7 @@ void ThreadPool::pushTask( std::unique_ptr<ThreadTask> pTask )
     }
 
     pTask->mpTag->onTaskPushed();
-    maTasks.insert( maTasks.begin(), std::move(pTask) );
+    maTasks.push_back( std::move(pTask) );
 
     maTasksChanged.notify_one();
 }
@@ -236,8 +236,8 @@ std::unique_ptr<ThreadTask> ThreadPool::popWorkLocked( std::unique_lock< std::mu
     {
         if( !maTasks.empty() )
         {
-            std::unique_ptr<ThreadTask> pTask = std::move(maTasks.back());
-            maTasks.pop_back();
+            std::unique_ptr<ThreadTask> pTask = std::move(maTasks.front());
+            maTasks.pop_front();
             return pTask;
         }
         else if (!bWait || mbTerminate)
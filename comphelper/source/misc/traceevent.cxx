@@ -55,21 +55,15 @@ void TraceEvent::addInstantEvent(const char* sName, const std::map<OUString, OUS
 {
     long long nNow = getNow();
 
-    int nPid = 0;
-    oslProcessInfo aProcessInfo;
-    aProcessInfo.Size = sizeof(oslProcessInfo);
-    if (osl_getProcessInfo(nullptr, osl_Process_IDENTIFIER, &aProcessInfo) == osl_Process_E_None)
-        nPid = aProcessInfo.Ident;
-
     addRecording("{"
-                 "\"name:\""
+                 "\"name\":\""
                  + OUString(sName, strlen(sName), RTL_TEXTENCODING_UTF8)
                  + "\","
                    "\"ph\":\"i\""
                  + createArgsString(args) + ",\"ts\":" + OUString::number(nNow)
                  + ","
                    "\"pid\":"
-                 + OUString::number(nPid)
+                 + OUString::number(getPid())
                  + ","
                    "\"tid\":"
                  + OUString::number(osl_getThreadIdentifier(nullptr)) + "},");
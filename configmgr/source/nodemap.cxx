@@ -31,12 +31,12 @@ namespace configmgr
 void NodeMap::cloneInto(NodeMap* target) const
 {
     assert(target != nullptr && target->empty());
-    NodeMapImpl clone(maImpl);
-    for (auto& elem : clone)
+    // Insert the clones directly in order, instead of first copying the
+    // references to the original nodes and then replacing them:
+    for (auto const& elem : maImpl)
     {
-        elem.second = elem.second->clone(true);
+        target->maImpl.emplace_hint(target->maImpl.end(), elem.first, elem.second->clone(true));
     }
-    std::swap(clone, target->maImpl);
     target->clearCache();
 }
 
@@ -289,6 +289,7 @@ void ODbaseTable::fillColumns()
     m_aTypes.clear();
     m_aPrecisions.clear();
     m_aScales.clear();
+    m_aCurrencies.clear();
 
     // Number of fields:
     sal_Int32 nFieldCount = (m_aHeader.headerLength - 1) / 32 - 1;
@@ -311,6 +312,7 @@ void ODbaseTable::fillColumns()
     m_aTypes.reserve(nFieldCount);
     m_aPrecisions.reserve(nFieldCount);
     m_aScales.reserve(nFieldCount);
+    m_aCurrencies.reserve(nFieldCount);
 
     OUString aTypeName;
     const bool bCase = getConnection()->getMetaData()->supportsMixedCaseQuotedIdentifiers();
@@ -428,6 +430,7 @@ void ODbaseTable::fillColumns()
         m_aTypes.push_back(eType);
         m_aPrecisions.push_back(nPrecision);
         m_aScales.push_back(aDBFColumn.db_dez);
+        m_aCurrencies.push_back(bIsCurrency);
 
         Reference< XPropertySet> xCol = new sdbcx::OColumn(aColumnName,
                                                     aTypeName,
@@ -879,7 +882,7 @@ bool ODbaseTable::fetchRow(OValueRefRow& _rRow, const OSQLColumns & _rCols, bool
         else if ( DataType::DOUBLE == nType )
         {
             double d = 0.0;
-            if (getBOOL((*aIter)->getPropertyValue(OMetaConnection::getPropMap().getNameByIndex(PROPERTY_ID_ISCURRENCY)))) // Currency is treated separately
+            if (m_aCurrencies[i-1]) // Currency is treated separately
             {
                 sal_Int64 nValue = 0;
                 if (o3tl::make_unsigned(nLen) > sizeof(nValue))
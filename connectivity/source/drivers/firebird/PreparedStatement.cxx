@@ -59,6 +59,7 @@ OPreparedStatement::OPreparedStatement( Connection* _pConnection,
     ,m_sSqlStatement(sql)
     ,m_pOutSqlda(nullptr)
     ,m_pInSqlda(nullptr)
+    ,m_nChangeCount(0)
 {
     SAL_INFO("connectivity.firebird", "OPreparedStatement(). "
              "sql: " << sql);
@@ -334,7 +335,8 @@ sal_Bool SAL_CALL OPreparedStatement::execute()
                                   m_aStatementHandle,
                                   m_pOutSqlda);
 
-    if (getStatementChangeCount() > 0)
+    m_nChangeCount = getStatementChangeCount();
+    if (m_nChangeCount > 0)
         m_pConnection->notifyDatabaseModified();
 
     return m_xResultSet.is();
@@ -343,8 +345,11 @@ sal_Bool SAL_CALL OPreparedStatement::execute()
 
 sal_Int32 SAL_CALL OPreparedStatement::executeUpdate()
 {
+    MutexGuard aGuard( m_aMutex );
+
     execute();
-    return getStatementChangeCount();
+    // don't query the statement info again, e.g. for every row of a bulk insert
+    return m_nChangeCount;
 }
 
 Reference< XResultSet > SAL_CALL OPreparedStatement::executeQuery()
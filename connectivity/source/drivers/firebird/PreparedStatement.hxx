@@ -50,6 +50,8 @@ namespace connectivity::firebird
 
             XSQLDA*         m_pOutSqlda;
             XSQLDA*         m_pInSqlda;
+            /// Number of rows changed by the last execute()
+            sal_Int32       m_nChangeCount;
             /// @throws css::sdbc::SQLException
             /// @throws css::uno::RuntimeException
             void checkParameterIndex(sal_Int32 nParameterIndex);
@@ -100,6 +100,7 @@ namespace connectivity::dbase
             std::vector<sal_Int32> m_aTypes;      // holds all types for columns just to avoid to ask the propertyset
             std::vector<sal_Int32> m_aPrecisions; // same as above
             std::vector<sal_Int32> m_aScales;
+            std::vector<bool> m_aCurrencies; // same as above
             std::vector<sal_Int32> m_aRealFieldLengths;
             DBFHeader       m_aHeader = {};
             DBFMemoHeader   m_aMemoHeader;
@@ -1642,6 +1642,16 @@ void ORowSet::impl_ensureStatement_throw()
             // this exception doesn't matter here because when we catch an exception
             // then the driver doesn't support this feature
         }
+
+        // let the driver fetch rows in blocks of the size of our cache window
+        try
+        {
+            xStatementProps->setPropertyValue( PROPERTY_FETCHSIZE, Any( m_nFetchSize ) );
+        }
+        catch ( const Exception& )
+        {
+            // the fetch size is only a hint, so it doesn't matter if the driver doesn't support it
+        }
     }
     catch (SQLException& rException)
     {
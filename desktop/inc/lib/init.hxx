@@ -196,7 +196,7 @@ namespace desktop {
         bool processWindowEvent(int type, CallbackData& aCallbackData);
         queue_type2::iterator toQueue2(queue_type1::iterator);
         queue_type2::reverse_iterator toQueue2(queue_type1::reverse_iterator);
-        void queue(const int type, CallbackData& data);
+        void queue(const int type, CallbackData&& data);
         void enqueueUpdatedTypes();
         void enqueueUpdatedType( int type, const SfxViewShell* sourceViewShell, int viewId );
 
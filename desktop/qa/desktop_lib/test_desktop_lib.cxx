@@ -160,6 +160,7 @@ public:
     void testSearchCalc();
     void testSearchAllNotificationsCalc();
     void testPaintTile();
+    void testPaintTiles();
     void testSaveAs();
     void testSaveAsJsonOptions();
     void testSaveAsCalc();
@@ -228,6 +229,7 @@ public:
     CPPUNIT_TEST(testSearchCalc);
     CPPUNIT_TEST(testSearchAllNotificationsCalc);
     CPPUNIT_TEST(testPaintTile);
+    CPPUNIT_TEST(testPaintTiles);
     CPPUNIT_TEST(testSaveAs);
     CPPUNIT_TEST(testSaveAsJsonOptions);
     CPPUNIT_TEST(testSaveAsCalc);
@@ -669,6 +671,37 @@ void DesktopLOKTest::testPaintTile()
     pDocument->pClass->paintTile(pDocument, aBuffer.data(), nCanvasWidth, nCanvasHeight, nTilePosX, nTilePosY, nTileWidth, nTileHeight);
 }
 
+void DesktopLOKTest::testPaintTiles()
+{
+    // Given a text document:
+    LibLODocument_Impl* pDocument = loadDoc("blank_text.odt");
+    constexpr int nCanvasSize = 256;
+    constexpr int nTileSize = 3840;
+    const int aTilePosX[] = { 0, nTileSize, 0 };
+    const int aTilePosY[] = { 0, 0, nTileSize };
+    std::vector<unsigned char> aBuffers[3];
+    std::vector<unsigned char> aExpected[3];
+    unsigned char* pBuffers[3];
+    for (size_t i = 0; i < 3; ++i)
+    {
+        aBuffers[i].resize(nCanvasSize * nCanvasSize * 4);
+        aExpected[i].resize(nCanvasSize * nCanvasSize * 4);
+        pBuffers[i] = aBuffers[i].data();
+    }
+
+    // When painting the tiles in one batch:
+    pDocument->pClass->paintTiles(pDocument, pBuffers, 3, nCanvasSize, nCanvasSize, aTilePosX,
+                                  aTilePosY, nTileSize, nTileSize);
+
+    // Then each tile is the same as a tile painted on its own:
+    for (size_t i = 0; i < 3; ++i)
+    {
+        pDocument->pClass->paintTile(pDocument, aExpected[i].data(), nCanvasSize, nCanvasSize,
+                                     aTilePosX[i], aTilePosY[i], nTileSize, nTileSize);
+        CPPUNIT_ASSERT(aExpected[i] == aBuffers[i]);
+    }
+}
+
 void DesktopLOKTest::testSaveAs()
 {
     LibLODocument_Impl* pDocument = loadDoc("blank_text.odt");
@@ -3636,10 +3669,11 @@ void DesktopLOKTest::testABI()
     CPPUNIT_ASSERT_EQUAL(documentClassOffset(68),
                          offsetof(struct _LibreOfficeKitDocumentClass, setViewTimezone));
     CPPUNIT_ASSERT_EQUAL(documentClassOffset(69), offsetof(struct _LibreOfficeKitDocumentClass, paintThumbnail));
+    CPPUNIT_ASSERT_EQUAL(documentClassOffset(70), offsetof(struct _LibreOfficeKitDocumentClass, paintTiles));
 
 
     // As above
-    CPPUNIT_ASSERT_EQUAL(documentClassOffset(70), sizeof(struct _LibreOfficeKitDocumentClass));
+    CPPUNIT_ASSERT_EQUAL(documentClassOffset(71), sizeof(struct _LibreOfficeKitDocumentClass));
 }
 
 CPPUNIT_TEST_SUITE_REGISTRATION(DesktopLOKTest);
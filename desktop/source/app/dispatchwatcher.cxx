@@ -62,6 +62,7 @@
 #include <osl/thread.hxx>
 #include <osl/file.hxx>
 #include <iostream>
+#include <map>
 #include <string_view>
 #include <utility>
 
@@ -304,6 +305,8 @@ bool DispatchWatcher::executeDispatchRequests( const std::vector<DispatchRequest
     std::vector< DispatchHolder >   aDispatches;
     bool                     bSetInputFilter = false;
     OUString                 aForcedInputFilter;
+    // export filters guessed for --convert-to, by output extension and document service
+    std::map< std::pair< OUString, OUString >, OUString > aGuessedFilters;
 
     for (auto const & aDispatchRequest: aDispatchRequestsList)
     {
@@ -589,7 +592,19 @@ bool DispatchWatcher::executeDispatchRequests( const std::vector<DispatchRequest
                                     utl::MediaDescriptor aMediaDesc( xModel->getArgs() );
                                     aDocService = aMediaDesc.getUnpackedValueOrDefault(utl::MediaDescriptor::PROP_DOCUMENTSERVICE, OUString() );
                                 }
-                                aFilter = impl_GuessFilter( aOutFile, aDocService );
+                                // The guess only depends on the extension of the output
+                                // file, so don't detect it again for every converted file
+                                const std::pair<OUString, OUString> aGuessKey(
+                                    INetURLObject(aOutFile).getExtension(), aDocService);
+                                auto it = aGuessedFilters.find(aGuessKey);
+                                if (it != aGuessedFilters.end())
+                                    aFilter = it->second;
+                                else
+                                {
+                                    aFilter = impl_GuessFilter( aOutFile, aDocService );
+                                    if (!aFilter.isEmpty())
+                                        aGuessedFilters.emplace(aGuessKey, aFilter);
+                                }
                             }
 
                             bool bMultiFileTarget = false;
@@ -40,6 +40,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <set>
 #include <iostream>
 #include <string_view>
 
@@ -1115,6 +1116,11 @@ static void doc_paintTile(LibreOfficeKitDocument* pThis,
                           const int nTilePosX, const int nTilePosY,
                           const int nTileWidth, const int nTileHeight);
 static void doc_paintThumbnail(LibreOfficeKitDocument* pThis, unsigned char* pBuffer, int x, int y);
+static void doc_paintTiles(LibreOfficeKitDocument* pThis,
+                           unsigned char** pBuffers, const int nTileCount,
+                           const int nCanvasWidth, const int nCanvasHeight,
+                           const int* pTilePosX, const int* pTilePosY,
+                           const int nTileWidth, const int nTileHeight);
 #ifdef IOS
 static void doc_paintTileToCGContext(LibreOfficeKitDocument* pThis,
                                      void* rCGContext,
@@ -1389,6 +1395,7 @@ LibLODocument_Impl::LibLODocument_Impl(uno::Reference <css::lang::XComponent> xC
         m_pDocumentClass->getEditMode = doc_getEditMode;
         m_pDocumentClass->paintTile = doc_paintTile;
         m_pDocumentClass->paintThumbnail = doc_paintThumbnail;
+        m_pDocumentClass->paintTiles = doc_paintTiles;
 #ifdef IOS
         m_pDocumentClass->paintTileToCGContext = doc_paintTileToCGContext;
 #endif
@@ -1603,19 +1610,19 @@ void CallbackFlushHandler::resetUpdatedTypePerViewId( int nType, int nViewId )
 void CallbackFlushHandler::libreOfficeKitViewCallback(int nType, const char* pPayload)
 {
     CallbackData callbackData(pPayload);
-    queue(nType, callbackData);
+    queue(nType, std::move(callbackData));
 }
 
 void CallbackFlushHandler::libreOfficeKitViewCallbackWithViewId(int nType, const char* pPayload, int nViewId)
 {
     CallbackData callbackData(pPayload, nViewId);
-    queue(nType, callbackData);
+    queue(nType, std::move(callbackData));
 }
 
 void CallbackFlushHandler::libreOfficeKitViewInvalidateTilesCallback(const tools::Rectangle* pRect, int nPart, int nMode)
 {
     CallbackData callbackData(pRect, nPart, nMode);
-    queue(LOK_CALLBACK_INVALIDATE_TILES, callbackData);
+    queue(LOK_CALLBACK_INVALIDATE_TILES, std::move(callbackData));
 }
 
 void CallbackFlushHandler::libreOfficeKitViewUpdatedCallback(int nType)
@@ -1660,10 +1667,10 @@ void CallbackFlushHandler::libreOfficeKitViewAddPendingInvalidateTiles()
 void CallbackFlushHandler::queue(const int type, const char* data)
 {
     CallbackData callbackData(data);
-    queue(type, callbackData);
+    queue(type, std::move(callbackData));
 }
 
-void CallbackFlushHandler::queue(const int type, CallbackData& aCallbackData)
+void CallbackFlushHandler::queue(const int type, CallbackData&& aCallbackData)
 {
     comphelper::ProfileZone aZone("CallbackFlushHandler::queue");
 
@@ -1905,9 +1912,9 @@ void CallbackFlushHandler::queue(const int type, CallbackData& aCallbackData)
     // Validate that the cached data and the payload string are identical.
     assert(aCallbackData.validate() && "Cached callback payload object and string mismatch!");
     m_queue1.emplace_back(type);
-    m_queue2.emplace_back(aCallbackData);
+    m_queue2.emplace_back(std::move(aCallbackData));
     SAL_INFO("lok", "Queued #" << (m_queue1.size() - 1) <<
-             " [" << type << "]: [" << aCallbackData.getPayload() << "] to have " << m_queue1.size() << " entries.");
+             " [" << type << "]: [" << m_queue2.back().getPayload() << "] to have " << m_queue1.size() << " entries.");
 
 #ifdef DBG_UTIL
     {
@@ -2431,39 +2438,28 @@ void CallbackFlushHandler::startTimer()
 
 bool CallbackFlushHandler::removeAll(int type)
 {
-    bool bErased = false;
-    auto it1 = m_queue1.begin();
-    for(;;)
-    {
-        it1 = std::find(it1, m_queue1.end(), type);
-        if(it1 == m_queue1.end())
-            break;
-        m_queue2.erase(toQueue2(it1));
-        it1 = m_queue1.erase(it1);
-        bErased = true;
-    }
-    return bErased;
+    return removeAll(type, [](const CallbackData&) { return true; });
 }
 
 bool CallbackFlushHandler::removeAll(int type, const std::function<bool (const CallbackData&)>& rTestFunc)
 {
-    bool bErased = false;
-    auto it1 = m_queue1.begin();
-    for(;;)
+    // Compact both queues in a single pass, erasing one element at a time
+    // would move the whole tail for every removed callback.
+    size_t nKept = 0;
+    for (size_t i = 0; i < m_queue1.size(); ++i)
     {
-        it1 = std::find(it1, m_queue1.end(), type);
-        if(it1 == m_queue1.end())
-            break;
-        auto it2 = toQueue2(it1);
-        if (rTestFunc(*it2))
+        if (m_queue1[i] == type && rTestFunc(m_queue2[i]))
+            continue;
+        if (nKept != i)
         {
-            m_queue2.erase(it2);
-            it1 = m_queue1.erase(it1);
-            bErased = true;
+            m_queue1[nKept] = m_queue1[i];
+            m_queue2[nKept] = std::move(m_queue2[i]);
         }
-        else
-            ++it1;
+        ++nKept;
     }
+    const bool bErased = nKept != m_queue1.size();
+    m_queue1.erase(m_queue1.begin() + nKept, m_queue1.end());
+    m_queue2.erase(m_queue2.begin() + nKept, m_queue2.end());
     return bErased;
 }
 
@@ -4023,6 +4019,34 @@ static void doc_paintThumbnail(LibreOfficeKitDocument* pThis, unsigned char* pBu
     doc_paintTile(pThis, pBuffer, pixelWidth, pixelHeight, x-offsetXTwips, y-offsetYTwips, pixelWidthTwips, pixelHeightTwips);
 }
 
+static void doc_paintTiles(LibreOfficeKitDocument* pThis,
+                           unsigned char** pBuffers, const int nTileCount,
+                           const int nCanvasWidth, const int nCanvasHeight,
+                           const int* pTilePosX, const int* pTilePosY,
+                           const int nTileWidth, const int nTileHeight)
+{
+    comphelper::ProfileZone aZone("doc_paintTiles");
+
+    // Hold the SolarMutex for the whole batch, so that no event processing
+    // (and no other client request) sneaks in between two tiles.
+    SolarMutexGuard aGuard;
+    SetLastExceptionMsg();
+
+    SAL_INFO( "lok.tiledrendering", "paintTiles: painting " << nTileCount << " tiles of ["
+              << nTileWidth << "x" << nTileHeight << "] to ["
+              << nCanvasWidth << "x" << nCanvasHeight << "]px" );
+
+    if (!getTiledRenderable(pThis))
+    {
+        SetLastExceptionMsg("Document doesn't support tiled rendering");
+        return;
+    }
+
+    for (int i = 0; i < nTileCount; ++i)
+        doc_paintTile(pThis, pBuffers[i], nCanvasWidth, nCanvasHeight,
+                      pTilePosX[i], pTilePosY[i], nTileWidth, nTileHeight);
+}
+
 static void doc_paintPartTile(LibreOfficeKitDocument* pThis,
                               unsigned char* pBuffer,
                               const int nPart,
@@ -7266,17 +7290,24 @@ static void preloadData()
             aLocales = xSpell->getLocales();
     }
 
+    // Most locales resolve to the same CJK and CTL languages, look up each
+    // default font only once.
+    std::set<std::pair<DefaultFontType, LanguageType>> aPreloadedFonts;
+    auto preloadDefaultFont = [&aPreloadedFonts](DefaultFontType eType, LanguageType nLang) {
+        if (aPreloadedFonts.emplace(eType, nLang).second)
+            OutputDevice::GetDefaultFont(eType, nLang, GetDefaultFontFlags::OnlyOne);
+    };
     for (const auto& aLocale : std::as_const(aLocales))
     {
         //TODO: Add more types and cache more aggressively. For now this initializes the fontcache.
         using namespace ::com::sun::star::i18n::ScriptType;
-        LanguageType nLang;
-        nLang = MsLangId::resolveSystemLanguageByScriptType(LanguageTag::convertToLanguageType(aLocale, false), LATIN);
-        OutputDevice::GetDefaultFont(DefaultFontType::LATIN_SPREADSHEET, nLang, GetDefaultFontFlags::OnlyOne);
-        nLang = MsLangId::resolveSystemLanguageByScriptType(LanguageTag::convertToLanguageType(aLocale, false), ASIAN);
-        OutputDevice::GetDefaultFont(DefaultFontType::CJK_SPREADSHEET, nLang, GetDefaultFontFlags::OnlyOne);
-        nLang = MsLangId::resolveSystemLanguageByScriptType(LanguageTag::convertToLanguageType(aLocale, false), COMPLEX);
-        OutputDevice::GetDefaultFont(DefaultFontType::CTL_SPREADSHEET, nLang, GetDefaultFontFlags::OnlyOne);
+        const LanguageType nLocaleLang = LanguageTag::convertToLanguageType(aLocale, false);
+        preloadDefaultFont(DefaultFontType::LATIN_SPREADSHEET,
+                           MsLangId::resolveSystemLanguageByScriptType(nLocaleLang, LATIN));
+        preloadDefaultFont(DefaultFontType::CJK_SPREADSHEET,
+                           MsLangId::resolveSystemLanguageByScriptType(nLocaleLang, ASIAN));
+        preloadDefaultFont(DefaultFontType::CTL_SPREADSHEET,
+                           MsLangId::resolveSystemLanguageByScriptType(nLocaleLang, COMPLEX));
     }
 
     std::cerr << "Preload config\n";
@@ -123,6 +123,12 @@ void Primitive2DContainer::append(const Primitive2DContainer& rSource)
 
 void Primitive2DContainer::append(Primitive2DContainer&& rSource)
 {
+    if (empty())
+    {
+        // e.g. a decomposition visited into a fresh container, just take over its storage
+        std::deque<Primitive2DReference>::swap(rSource);
+        return;
+    }
     this->insert(this->end(), std::make_move_iterator(rSource.begin()),
                  std::make_move_iterator(rSource.end()));
 }
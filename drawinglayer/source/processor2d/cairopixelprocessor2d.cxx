@@ -42,6 +42,23 @@ using namespace com::sun::star;
 
 namespace
 {
+// check if geometry with the given object range is outside of the discrete
+// local ViewPort, allowing for pixel snapping and AntiAliasing at its edges
+bool impIsOutsideDiscreteViewPort(const basegfx::B2DRange& rObjectRange,
+                                  const drawinglayer::geometry::ViewInformation2D& rViewInformation)
+{
+    const basegfx::B2DRange& rDiscreteViewPort(rViewInformation.getDiscreteViewport());
+
+    if (rDiscreteViewPort.isEmpty())
+        return false;
+
+    basegfx::B2DRange aRange(rObjectRange);
+    aRange.transform(rViewInformation.getObjectToViewTransformation());
+    aRange.grow(2.0);
+
+    return !aRange.overlaps(rDiscreteViewPort);
+}
+
 basegfx::B2DPoint impPixelSnap(const basegfx::B2DPolygon& rPolygon,
                                const drawinglayer::geometry::ViewInformation2D& rViewInformation,
                                sal_uInt32 nIndex)
@@ -259,6 +276,9 @@ void CairoPixelProcessor2D::processPolygonHairlinePrimitive2D(
     if (!rPolygon.count())
         return;
 
+    if (impIsOutsideDiscreteViewPort(rPolygon.getB2DRange(), getViewInformation2D()))
+        return;
+
     cairo_save(mpRT);
 
     cairo_matrix_t aMatrix;
@@ -301,6 +321,9 @@ void CairoPixelProcessor2D::processPolyPolygonColorPrimitive2D(
     if (!nCount)
         return;
 
+    if (impIsOutsideDiscreteViewPort(rPolyPolygon.getB2DRange(), getViewInformation2D()))
+        return;
+
     cairo_save(mpRT);
 
     cairo_matrix_t aMatrix;
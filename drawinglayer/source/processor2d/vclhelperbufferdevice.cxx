@@ -196,6 +196,13 @@ VclPtr<VirtualDevice> VDevBuffer::alloc(OutputDevice& rOutDev, const Size& rSize
                     aFound = a;
                     bOkay = isSizeSuitable(aFound->buf, rSizePixel);
                 }
+
+                if (bOkay && aFound->buf->GetOutputSizePixel() == rSizePixel)
+                {
+                    // exactly the requested size (e.g. the same tile size as
+                    // the last paint), no other buffer can be a better fit
+                    break;
+                }
             }
         }
 
@@ -461,6 +461,25 @@ void VclPixelProcessor2D::processTextDecoratedPortionPrimitive2D(
 void VclPixelProcessor2D::processPolygonHairlinePrimitive2D(
     const primitive2d::PolygonHairlinePrimitive2D& rPolygonHairlinePrimitive2D)
 {
+    // check if the line is inside discrete local ViewPort, huge flat lists of
+    // hairlines (e.g. from imported drawings) are mostly outside of it
+    const basegfx::B2DRange& rDiscreteViewPort(getViewInformation2D().getDiscreteViewport());
+
+    if (!rDiscreteViewPort.isEmpty())
+    {
+        basegfx::B2DRange aRange(rPolygonHairlinePrimitive2D.getB2DPolygon().getB2DRange());
+
+        aRange.transform(maCurrentTransformation);
+        // pixel snapping and AntiAliasing may touch neighbouring pixels
+        aRange.grow(2.0);
+
+        if (!aRange.overlaps(rDiscreteViewPort))
+        {
+            // content is outside discrete local ViewPort
+            return;
+        }
+    }
+
     if (tryDrawPolygonHairlinePrimitive2DDirect(rPolygonHairlinePrimitive2D, 0.0))
     {
         return;
@@ -69,9 +69,11 @@
 #include <o3tl/sorted_vector.hxx>
 #include <osl/diagnose.h>
 #include <comphelper/string.hxx>
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vcl/outdev/ScopedStates.hxx>
 
@@ -2580,31 +2582,32 @@ void ImpEditEngine::CreateTextPortions( ParaPortion* pParaPortion, sal_Int32& rS
     ContentNode* pNode = pParaPortion->GetNode();
     DBG_ASSERT( pNode->Len(), "CreateTextPortions should not be used for empty paragraphs!" );
 
-    o3tl::sorted_vector< sal_Int32 > aPositions;
-    aPositions.insert( 0 );
+    // Collect unsorted and sort once, inserting each position into a sorted
+    // vector is quadratic in the number of attributes.
+    std::vector< sal_Int32 > aPositionsList;
+    aPositionsList.push_back( 0 );
 
     for (std::size_t nAttr = 0;; ++nAttr)
     {
         // Insert Start and End into the Array...
-        // The Insert method does not allow for duplicate values...
         EditCharAttrib* pAttrib = GetAttrib(pNode->GetCharAttribs().GetAttribs(), nAttr);
         if (!pAttrib)
             break;
-        aPositions.insert( pAttrib->GetStart() );
-        aPositions.insert( pAttrib->GetEnd() );
+        aPositionsList.push_back( pAttrib->GetStart() );
+        aPositionsList.push_back( pAttrib->GetEnd() );
     }
-    aPositions.insert( pNode->Len() );
+    aPositionsList.push_back( pNode->Len() );
 
     if ( pParaPortion->aScriptInfos.empty() )
         InitScriptTypes( GetParaPortions().GetPos( pParaPortion ) );
 
     const ScriptTypePosInfos& rTypes = pParaPortion->aScriptInfos;
     for (const ScriptTypePosInfo& rType : rTypes)
-        aPositions.insert( rType.nStartPos );
+        aPositionsList.push_back( rType.nStartPos );
 
     const WritingDirectionInfos& rWritingDirections = pParaPortion->aWritingDirectionInfos;
     for (const WritingDirectionInfo & rWritingDirection : rWritingDirections)
-        aPositions.insert( rWritingDirection.nStartPos );
+        aPositionsList.push_back( rWritingDirection.nStartPos );
 
     if ( mpIMEInfos && mpIMEInfos->nLen && mpIMEInfos->pAttribs && ( mpIMEInfos->aPos.GetNode() == pNode ) )
     {
@@ -2613,13 +2616,18 @@ void ImpEditEngine::CreateTextPortions( ParaPortion* pParaPortion, sal_Int32& rS
         {
             if ( mpIMEInfos->pAttribs[n] != nLastAttr )
             {
-                aPositions.insert( mpIMEInfos->aPos.GetIndex() + n );
+                aPositionsList.push_back( mpIMEInfos->aPos.GetIndex() + n );
                 nLastAttr = mpIMEInfos->pAttribs[n];
             }
         }
-        aPositions.insert( mpIMEInfos->aPos.GetIndex() + mpIMEInfos->nLen );
+        aPositionsList.push_back( mpIMEInfos->aPos.GetIndex() + mpIMEInfos->nLen );
     }
 
+    std::sort( aPositionsList.begin(), aPositionsList.end() );
+    aPositionsList.erase( std::unique( aPositionsList.begin(), aPositionsList.end() ), aPositionsList.end() );
+    o3tl::sorted_vector< sal_Int32 > aPositions;
+    aPositions.insert_sorted_unique_vector( std::move( aPositionsList ) );
+
     // From ... Delete:
     // Unfortunately, the number of text portions does not have to match
     // aPositions.Count(), since there might be line breaks...
@@ -787,16 +787,18 @@ namespace emfio
             for (sal_uInt32 i = 0; i < nPoly && mpInputStream->good(); ++i)
             {
                 const sal_uInt16 nPointCount(aPoints[i]);
-                std::vector<Point> aPtAry(nPointCount);
+                // read straight into the polygon, no temporary point array
+                tools::Polygon aPolygon(nPointCount);
+                Point* pPtAry = aPolygon.GetPointAry();
                 for (sal_uInt16 j = 0; j < nPointCount && mpInputStream->good(); ++j)
                 {
                     T nX(0), nY(0);
                     *mpInputStream >> nX >> nY;
-                    aPtAry[j] = Point( nX, nY );
+                    pPtAry[j] = Point( nX, nY );
                     ++nReadPoints;
                 }
 
-                aPolyPoly.Insert(tools::Polygon(aPtAry.size(), aPtAry.data()));
+                aPolyPoly.Insert(aPolygon);
             }
 
             DrawPolyPolygon(aPolyPoly, mbRecordPath);
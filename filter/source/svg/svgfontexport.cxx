@@ -81,6 +81,11 @@ void SVGFontExport::implCollectGlyphs()
 
     pVDev->EnableOutput( false );
 
+    // created on the first text, not again for every text action
+    css::uno::Reference< css::i18n::XBreakIterator > xBI;
+    bool bBreakIteratorCreated = false;
+    const css::lang::Locale& rLocale = Application::GetSettings().GetLanguageTag().getLocale();
+
     for (auto const& elem : maObjects)
     {
         if( elem.HasRepresentation() )
@@ -136,12 +141,14 @@ void SVGFontExport::implCollectGlyphs()
                 if( !aText.isEmpty() )
                 {
                     GlyphSet& rGlyphSet = implGetGlyphSet( pVDev->GetFont() );
-                    css::uno::Reference< css::i18n::XBreakIterator > xBI(
-                        vcl::unohelper::CreateBreakIterator() );
+                    if( !bBreakIteratorCreated )
+                    {
+                        xBI = vcl::unohelper::CreateBreakIterator();
+                        bBreakIteratorCreated = true;
+                    }
 
                     if( xBI.is() )
                     {
-                        const css::lang::Locale&   rLocale = Application::GetSettings().GetLanguageTag().getLocale();
                         sal_Int32                               nCurPos = 0, nLastPos = -1;
 
                         while( ( nCurPos < aText.getLength() ) && ( nCurPos > nLastPos ) )
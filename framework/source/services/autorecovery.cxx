@@ -3016,6 +3016,9 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
 
     lNewArgs[utl::MediaDescriptor::PROP_AUTOSAVEEVENT] <<= true;
 
+    // Nobody looks at the thumbnail of a backup copy, don't render it on each autosave.
+    lNewArgs["NoThumbnail"] <<= true;
+
     // try to save this document as a new temp file every time.
     // Mark AutoSave state as "INCOMPLETE" if it failed.
     // Because the last temp file is too old and does not include all changes.
@@ -92,6 +92,9 @@ protected:
     {
         std::shared_ptr< BI_ValueData > mpValue;
         OString                         maBIMapKey;
+        /// Locale and rule maBIMapKey was last built for
+        css::lang::Locale               maLocale;
+        const char*                     mpRule = nullptr;
     } character, sentence, line, *icuBI;
     BI_Data words[4]; // 4 is css::i18n::WordType enumeration size
 
@@ -125,17 +125,29 @@ void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocal
     // expensive numeric conversion in append() for faster construction of the
     // always used global key.
     assert( 0 <= breakType && breakType <= 9 && 0 <= rBreakType && rBreakType <= 9 && 0 <= nWordType && nWordType <= 9);
-    const OString aLangtagStr( LanguageTag::convertToBcp47( rLocale).toUtf8());
-    OStringBuffer aKeyBuf(64);
-    aKeyBuf.append( aLangtagStr).append(';');
-    if (rule)
-        aKeyBuf.append(rule);
-    aKeyBuf.append(';').append( static_cast<char>('0'+breakType)).append(';').
-        append( static_cast<char>('0'+rBreakType)).append(';').append( static_cast<char>('0'+nWordType));
-    // langtag;rule;breakType;rBreakType;nWordType
-    const OString aBIMapGlobalKey( aKeyBuf.makeStringAndClear());
-
-    if (icuBI->maBIMapKey != aBIMapGlobalKey || !icuBI->mpValue || !icuBI->mpValue->mpBreakIterator)
+    // Converting the locale to a language tag for the key is not cheap, so
+    // first check whether the iterator was already loaded for the same locale
+    // and rule, as is the case for most calls e.g. when iterating over words.
+    const bool bSameLocaleAndRule = icuBI->mpValue && icuBI->mpValue->mpBreakIterator
+        && icuBI->mpRule == rule && icuBI->maLocale.Language == rLocale.Language
+        && icuBI->maLocale.Country == rLocale.Country && icuBI->maLocale.Variant == rLocale.Variant;
+    OString aLangtagStr;
+    OString aBIMapGlobalKey;
+    if (!bSameLocaleAndRule)
+    {
+        aLangtagStr = LanguageTag::convertToBcp47( rLocale).toUtf8();
+        OStringBuffer aKeyBuf(64);
+        aKeyBuf.append( aLangtagStr).append(';');
+        if (rule)
+            aKeyBuf.append(rule);
+        aKeyBuf.append(';').append( static_cast<char>('0'+breakType)).append(';').
+            append( static_cast<char>('0'+rBreakType)).append(';').append( static_cast<char>('0'+nWordType));
+        // langtag;rule;breakType;rBreakType;nWordType
+        aBIMapGlobalKey = aKeyBuf.makeStringAndClear();
+    }
+
+    if (!bSameLocaleAndRule &&
+        (icuBI->maBIMapKey != aBIMapGlobalKey || !icuBI->mpValue || !icuBI->mpValue->mpBreakIterator))
     {
 
         auto aMapIt( theBIMap.find( aBIMapGlobalKey));
@@ -310,6 +322,11 @@ void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocal
             theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
         bNewBreak=true;
     }
+    if (!bSameLocaleAndRule)
+    {
+        icuBI->maLocale = rLocale;
+        icuBI->mpRule = rule;
+    }
 
     if (!(bNewBreak || icuBI->mpValue->maICUText.pData != rText.pData))
         return;
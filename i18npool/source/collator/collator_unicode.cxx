@@ -127,6 +127,10 @@ Collator_Unicode::compareSubstring( const OUString& str1, sal_Int32 off1, sal_In
 sal_Int32 SAL_CALL
 Collator_Unicode::compareString( const OUString& str1, const OUString& str2)
 {
+    // Identical strings are equal in any collation, which is common when
+    // sorting columns with repeated (and often shared) strings.
+    if (str1 == str2)
+        return 0;
     return collator->compare(reinterpret_cast<const UChar *>(str1.getStr()), str1.getLength(),
                              reinterpret_cast<const UChar *>(str2.getStr()), str2.getLength());
 }
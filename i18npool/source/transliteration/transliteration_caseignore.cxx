@@ -18,6 +18,7 @@
  */
 
 #include <com/sun/star/i18n/TransliterationType.hpp>
+#include <rtl/character.hxx>
 #include <rtl/ref.hxx>
 
 #include <i18nutil/casefolding.hxx>
@@ -33,6 +34,17 @@ using namespace ::com::sun::star::lang;
 
 namespace i18npool {
 
+namespace {
+
+// ASCII characters fold to their ASCII lower case, except for the I's and J's
+// whose folding depends on the locale and the following characters.
+bool isPlainAsciiFolding(sal_Unicode c)
+{
+    return rtl::isAscii(c) && c != 'I' && c != 'J' && c != 'i';
+}
+
+}
+
 Transliteration_caseignore::Transliteration_caseignore()
 {
     nMappingType = MappingType::FullFolding;
@@ -117,6 +129,21 @@ Transliteration_caseignore::compare(
     i18nutil::MappingElement e1, e2;
     nMatch1 = nMatch2 = 0;
 
+    // Compare the leading ASCII part in place, without the mapping tables.
+    if (moduleLoaded == TransliterationFlags::IGNORE_CASE) {
+        while (nMatch1 < nCount1 && nMatch2 < nCount2) {
+            c1 = unistr1[nMatch1];
+            c2 = unistr2[nMatch2];
+            if (!isPlainAsciiFolding(c1) || !isPlainAsciiFolding(c2))
+                break;
+            c1 = static_cast<sal_Unicode>(rtl::toAsciiLowerCase(c1));
+            c2 = static_cast<sal_Unicode>(rtl::toAsciiLowerCase(c2));
+            if (c1 != c2)
+                return c1 > c2 ? 1 : -1;
+            nMatch1++; nMatch2++;
+        }
+    }
+
 #define NOT_END_OF_STR1 (nMatch1 < nCount1 || e1.current < e1.element.nmap)
 #define NOT_END_OF_STR2 (nMatch2 < nCount2 || e2.current < e2.element.nmap)
 
@@ -506,6 +506,17 @@ struct _LibreOfficeKitDocumentClass
                             int x,
                             int y);
 
+    /// @see lok::Document::paintTiles().
+    void (*paintTiles) (LibreOfficeKitDocument* pThis,
+                        unsigned char** pBuffers,
+                        const int nTileCount,
+                        const int nCanvasWidth,
+                        const int nCanvasHeight,
+                        const int* pTilePosX,
+                        const int* pTilePosY,
+                        const int nTileWidth,
+                        const int nTileHeight);
+
 #endif // defined LOK_USE_UNSTABLE_API || defined LIBO_INTERNAL_ONLY
 };
 
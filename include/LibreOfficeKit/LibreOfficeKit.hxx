@@ -891,6 +891,32 @@ public:
         return mpDoc->pClass->paintThumbnail(mpDoc, pBuffer, x, y);
     }
 
+    /**
+     * Renders several tiles of the same size and zoom level, as paintTile()
+     * would do for each of them, but without giving up the document in between.
+     *
+     * @param pBuffers nTileCount buffers, the size of each is determined by nCanvasWidth and nCanvasHeight.
+     * @param nTileCount number of tiles to render.
+     * @param nCanvasWidth number of pixels in a row of each buffer.
+     * @param nCanvasHeight number of pixels in a column of each buffer.
+     * @param pTilePosX nTileCount logical X positions of the top left corner of the rendered rectangles, in TWIPs.
+     * @param pTilePosY nTileCount logical Y positions of the top left corner of the rendered rectangles, in TWIPs.
+     * @param nTileWidth logical width of each rendered rectangle, in TWIPs.
+     * @param nTileHeight logical height of each rendered rectangle, in TWIPs.
+     */
+    void paintTiles(unsigned char** pBuffers,
+                    const int nTileCount,
+                    const int nCanvasWidth,
+                    const int nCanvasHeight,
+                    const int* pTilePosX,
+                    const int* pTilePosY,
+                    const int nTileWidth,
+                    const int nTileHeight)
+    {
+        return mpDoc->pClass->paintTiles(mpDoc, pBuffers, nTileCount, nCanvasWidth, nCanvasHeight,
+                                         pTilePosX, pTilePosY, nTileWidth, nTileHeight);
+    }
+
 #endif // defined LOK_USE_UNSTABLE_API || defined LIBO_INTERNAL_ONLY
 };
 
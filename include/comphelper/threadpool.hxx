@@ -16,6 +16,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <vector>
 #include <memory>
 
@@ -103,7 +104,7 @@ private:
     bool                    mbTerminate;
     std::size_t const       mnMaxWorkers;
     std::size_t             mnBusyWorkers;
-    std::vector< std::unique_ptr<ThreadTask> >   maTasks;
+    std::deque< std::unique_ptr<ThreadTask> >    maTasks;
     std::vector< rtl::Reference< ThreadWorker > > maWorkers;
 };
 
@@ -95,6 +95,7 @@ private:
                                                            const Gradient& rGrad );
 
     SAL_DLLPRIVATE bool                 ImplPlayWithRenderer(OutputDevice& rOut, const Point& rPos, Size rLogicDestSize);
+    SAL_DLLPRIVATE void                 ImplPlayActions(OutputDevice& rOut, size_t nPos);
 
     void                                Linker( OutputDevice* pOut, bool bLink );
 
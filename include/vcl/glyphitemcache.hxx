@@ -63,6 +63,12 @@ public:
     /// at the end.
     void SetCacheGlyphsWhenDoingFallbackFonts(bool bOK);
 
+    /// Number of lookups since the last clear() that found (or did not find) a cached item.
+    size_t GetHitCount() const { return mnHits; }
+    size_t GetMissCount() const { return mnMisses; }
+    /// Approximate memory held by the cached glyphs, in bytes.
+    size_t GetCachedSize() const { return mCachedGlyphs.total_size(); }
+
     static SalLayoutGlyphsCache* self();
     SalLayoutGlyphsCache(int size) // needs to be public for vcl::DeleteOnDeinit
         : mCachedGlyphs(size)
@@ -103,12 +109,13 @@ private:
                           std::equal_to<CachedGlyphsKey>, GlyphsCost>
         GlyphsCache;
     GlyphsCache mCachedGlyphs;
-    // Last temporary glyphs returned (pointer is returned, so the object needs to be kept somewhere).
-    std::optional<CachedGlyphsKey> mLastTemporaryKey;
+    // Last uncached glyphs returned (pointer is returned, so the object needs to be kept somewhere).
     SalLayoutGlyphs mLastTemporaryGlyphs;
     // If set, info about the last call which wanted a substring of the full text.
     std::optional<CachedGlyphsKey> mLastSubstringKey;
     bool mbCacheGlyphsWhenDoingFallbackFonts = false;
+    size_t mnHits = 0;
+    size_t mnMisses = 0;
 
     SalLayoutGlyphsCache(const SalLayoutGlyphsCache&) = delete;
     SalLayoutGlyphsCache& operator=(const SalLayoutGlyphsCache&) = delete;
@@ -14,6 +14,7 @@
 #include <vcl/dllapi.h>
 #include <vcl/test/TestResult.hxx>
 
+#include <chrono>
 #include <vector>
 
 class VCL_PLUGIN_PUBLIC VclTestResult
@@ -23,17 +24,22 @@ class VCL_PLUGIN_PUBLIC VclTestResult
     OUString m_aTestStatus;
     //For storing the resultant bitmap correspondingly to the test.
     Bitmap m_aResultantBitmap;
+    //How long drawing and checking the test took.
+    std::chrono::steady_clock::duration m_aDuration;
 
 public:
-    VclTestResult(OUString atestName, OUString atestStatus, Bitmap atestBitmap)
+    VclTestResult(OUString atestName, OUString atestStatus, Bitmap atestBitmap,
+                  std::chrono::steady_clock::duration aDuration = {})
         : m_aTestName(std::move(atestName))
         , m_aTestStatus(std::move(atestStatus))
         , m_aResultantBitmap(atestBitmap)
+        , m_aDuration(aDuration)
     {
     }
     const OUString& getTestName() const { return m_aTestName; }
     OUString getStatus(bool bLocalize = false);
     const Bitmap& getBitmap() const { return m_aResultantBitmap; }
+    std::chrono::steady_clock::duration getDuration() const { return m_aDuration; }
 };
 
 class VCL_PLUGIN_PUBLIC GraphicsRenderTests
@@ -46,6 +52,8 @@ class VCL_PLUGIN_PUBLIC GraphicsRenderTests
     OUString m_aCurGraphicsBackend;
     //Location where the results should be stored.
     OUString m_aUserInstallPath;
+    //When the previous test finished, to measure the duration of the next one.
+    std::chrono::steady_clock::time_point m_aLastResultTime;
 
     void testDrawRectWithRectangle();
     void testDrawRectWithPixel();
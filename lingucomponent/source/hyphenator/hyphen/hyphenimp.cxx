@@ -335,12 +335,33 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
         while((n >=0) && (lcword[n] == '.'))
             n--;
         n++;
-        if (n > 0)
+        HDInfo& rDict = mvDicts[k];
+        if (rDict.nCacheMinLead != minLead || rDict.nCacheMinTrail != minTrail)
+        {
+            rDict.aHyphensCache.clear();
+            rDict.nCacheMinLead = minLead;
+            rDict.nCacheMinTrail = minTrail;
+        }
+        OString aCacheKey(lcword.get(), n);
+        auto aCacheIt = rDict.aHyphensCache.find(aCacheKey);
+        if (aCacheIt != rDict.aHyphensCache.end())
+        {
+            // line formatting asks for the same words again and again
+            memcpy(hyphens.get(), aCacheIt->second.getStr(), n);
+        }
+        else if (n > 0)
         {
             const bool bFailed = 0 != hnj_hyphen_hyphenate3( dict, lcword.get(), n, hyphens.get(), nullptr,
                     &rep, &pos, &cut, minLead, minTrail,
                     std::max<sal_Int16>(dict->clhmin, std::max<sal_Int16>(dict->clhmin, 2) + std::max(0, minLead  - std::max<sal_Int16>(dict->lhmin, 2))),
                     std::max<sal_Int16>(dict->crhmin, std::max<sal_Int16>(dict->crhmin, 2) + std::max(0, minTrail - std::max<sal_Int16>(dict->rhmin, 2))) );
+            if (!bFailed && !rep)
+            {
+                // occasional clean-up...
+                if (rDict.aHyphensCache.size() > 5000)
+                    rDict.aHyphensCache.clear();
+                rDict.aHyphensCache.emplace(aCacheKey, OString(hyphens.get(), n));
+            }
             if (bFailed)
             {
                 // whoops something did not work
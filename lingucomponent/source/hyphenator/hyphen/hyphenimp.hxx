@@ -41,6 +41,8 @@
 
 #include <hyphen.h>
 
+#include <unordered_map>
+
 using namespace ::com::sun::star::uno;
 using namespace ::com::sun::star::beans;
 using namespace ::com::sun::star::lang;
@@ -52,6 +54,11 @@ struct HDInfo {
   Locale           aLoc;
   rtl_TextEncoding eEnc;
   std::unique_ptr<CharClass> apCC;
+  // hyphenation points of recently hyphenated (lower case, encoded) words
+  // without discretionary hyphenation, for the minimal lead and trail used
+  std::unordered_map<OString, OString> aHyphensCache;
+  sal_Int16        nCacheMinLead = -1;
+  sal_Int16        nCacheMinTrail = -1;
 };
 
 class Hyphenator :
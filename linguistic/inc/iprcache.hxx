@@ -31,8 +31,8 @@
 #include <rtl/ref.hxx>
 #include <i18nlangtag/lang.h>
 
-#include <set>
 #include <map>
+#include <unordered_set>
 
 namespace linguistic
 {
@@ -74,7 +74,7 @@ class SpellCache final
 {
     rtl::Reference<FlushListener>  mxFlushLstnr;
 
-    typedef std::set< OUString >                  WordList_t;
+    typedef std::unordered_set< OUString >        WordList_t;
     typedef std::map< LanguageType, WordList_t >  LangWordList_t;
     LangWordList_t  aWordLists;
 
@@ -219,7 +219,7 @@ void SpellCache::AddWord( const OUString& rWord, LanguageType nLang )
     MutexGuard  aGuard( GetLinguMutex() );
     WordList_t & rList = aWordLists[ nLang ];
     // occasional clean-up...
-    if (rList.size() > 500)
+    if (rList.size() > 5000)
         rList.clear();
     rList.insert( rWord );
 }
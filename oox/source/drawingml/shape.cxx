@@ -1878,10 +1878,12 @@ Reference< XShape > const & Shape::createAndInsert(
         // Set glow effect properties
         if ( aEffectProperties.maGlow.moGlowRad.has_value() )
         {
-            uno::Reference<beans::XPropertySet> propertySet (mxShape, uno::UNO_QUERY);
-            propertySet->setPropertyValue("GlowEffectRadius", Any(convertEmuToHmm(aEffectProperties.maGlow.moGlowRad.value())));
-            propertySet->setPropertyValue("GlowEffectColor", Any(aEffectProperties.maGlow.moGlowColor.getColor(rGraphicHelper)));
-            propertySet->setPropertyValue("GlowEffectTransparency", Any(aEffectProperties.maGlow.moGlowColor.getTransparency()));
+            // set them at once, so that the shape's item set is only updated once
+            aPropertySet.setProperties(
+                { "GlowEffectColor", "GlowEffectRadius", "GlowEffectTransparency" },
+                { Any(aEffectProperties.maGlow.moGlowColor.getColor(rGraphicHelper)),
+                  Any(convertEmuToHmm(aEffectProperties.maGlow.moGlowRad.value())),
+                  Any(aEffectProperties.maGlow.moGlowColor.getTransparency()) });
         }
 
         // Set soft edge effect properties
@@ -1258,15 +1258,17 @@ const char* DrawingML::GetRelationCompPrefix() const
 OUString DrawingML::WriteImage( const Graphic& rGraphic , bool bRelPathToMedia )
 {
     GfxLink aLink = rGraphic.GetGfxLink ();
-    BitmapChecksum aChecksum = rGraphic.GetChecksum();
     OUString sMediaType;
     const char* pExtension = "";
     OUString sRelId;
     OUString sPath;
 
     // tdf#74670 tdf#91286 Save image only once
+    // The checksum may need to hash the whole bitmap, only get it when it's used.
+    BitmapChecksum aChecksum = 0;
     if (!maExportGraphics.empty())
     {
+        aChecksum = rGraphic.GetChecksum();
         auto aIterator = maExportGraphics.top().find(aChecksum);
         if (aIterator != maExportGraphics.top().end())
             sPath = aIterator->second;
@@ -207,9 +207,9 @@ std::optional< sal_Int32 > AttributeList::getInteger( sal_Int32 nAttrToken ) con
 
 std::optional< sal_uInt32 > AttributeList::getUnsigned( sal_Int32 nAttrToken ) const
 {
-    OUString aValue = mxAttribs->getOptionalValue( nAttrToken );
-    bool bValid = !aValue.isEmpty();
-    return bValid ? std::optional< sal_uInt32 >( AttributeConversion::decodeUnsigned( aValue ) ) : std::optional< sal_uInt32 >();
+    std::string_view aValue = getView( nAttrToken );
+    bool bValid = !aValue.empty();
+    return bValid ? std::optional< sal_uInt32 >( getLimitedValue< sal_uInt32, sal_Int64 >( o3tl::toInt64( aValue ), 0, SAL_MAX_UINT32 ) ) : std::optional< sal_uInt32 >();
 }
 
 std::optional< sal_Int64 > AttributeList::getHyper( sal_Int32 nAttrToken ) const
@@ -221,9 +221,10 @@ std::optional< sal_Int64 > AttributeList::getHyper( sal_Int32 nAttrToken ) const
 
 std::optional< sal_Int32 > AttributeList::getIntegerHex( sal_Int32 nAttrToken ) const
 {
-    OUString aValue = mxAttribs->getOptionalValue( nAttrToken );
-    bool bValid = !aValue.isEmpty();
-    return bValid ? std::optional< sal_Int32 >( AttributeConversion::decodeIntegerHex( aValue ) ) : std::optional< sal_Int32 >();
+    std::string_view aValue = getView( nAttrToken );
+    bool bValid = !aValue.empty();
+    // see AttributeConversion::decodeIntegerHex
+    return bValid ? std::optional< sal_Int32 >( static_cast< sal_Int32 >( o3tl::toUInt32( aValue, 16 ) ) ) : std::optional< sal_Int32 >();
 }
 
 std::optional< bool > AttributeList::getBool( sal_Int32 nAttrToken ) const
@@ -20,6 +20,7 @@
 #include <comphelper/anytostring.hxx>
 #include <comphelper/propertyvalue.hxx>
 #include <comphelper/sequenceashashmap.hxx>
+#include <o3tl/safeint.hxx>
 #include <o3tl/string_view.hxx>
 #include <sal/log.hxx>
 #include <tools/multisel.hxx>
@@ -111,9 +112,12 @@ PresentationFragmentHandler::~PresentationFragmentHandler() noexcept
 void PresentationFragmentHandler::importSlideNames(XmlFilterBase& rFilter, const std::vector<SlidePersistPtr>& rSlidePersist)
 {
     sal_Int32 nMaxPages = rSlidePersist.size();
+    Reference<XDrawPages> xDrawPages;
+    // names of the first pages, fetched when needed for the check of duplicated titles
+    std::vector<OUString> aPageNames;
     for (sal_Int32 nPage = 0; nPage < nMaxPages; nPage++)
     {
-        auto aShapeMap = rSlidePersist[nPage]->getShapeMap();
+        const auto& aShapeMap = rSlidePersist[nPage]->getShapeMap();
         auto aIter = std::find_if(aShapeMap.begin(), aShapeMap.end(),
                                   [](const std::pair<OUString, ShapePtr>& element) {
                                       auto pShapePtr = element.second;
@@ -134,14 +138,21 @@ void PresentationFragmentHandler::importSlideNames(XmlFilterBase& rFilter, const
             if (bUseTitleAsSlideName)
             {
                 sal_Int32 nCount = 1;
-                Reference<XDrawPagesSupplier> xDPS(rFilter.getModel(), UNO_QUERY_THROW);
-                Reference<XDrawPages> xDrawPages(xDPS->getDrawPages(), UNO_SET_THROW);
-                for (sal_Int32 i = 0; i < nPage; ++i)
+                if (!xDrawPages)
+                {
+                    Reference<XDrawPagesSupplier> xDPS(rFilter.getModel(), UNO_QUERY_THROW);
+                    xDrawPages.set(xDPS->getDrawPages(), UNO_SET_THROW);
+                }
+                while (aPageNames.size() < o3tl::make_unsigned(nPage))
                 {
-                    Reference<XDrawPage> xDrawPage(xDrawPages->getByIndex(i), UNO_QUERY);
+                    Reference<XDrawPage> xDrawPage(xDrawPages->getByIndex(sal_Int32(aPageNames.size())), UNO_QUERY);
                     Reference<container::XNamed> xNamed(xDrawPage, UNO_QUERY_THROW);
+                    aPageNames.push_back(xNamed->getName());
+                }
+                for (sal_Int32 i = 0; i < nPage; ++i)
+                {
                     OUString sRest;
-                    if (xNamed->getName().startsWith(aTitleText, &sRest)
+                    if (aPageNames[i].startsWith(aTitleText, &sRest)
                         && (sRest.isEmpty()
                             || (sRest.startsWith(" (") && sRest.endsWith(")")
                                 && o3tl::toInt32(sRest.subView(2, sRest.getLength() - 3)) > 0)))
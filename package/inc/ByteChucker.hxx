@@ -22,6 +22,8 @@
 #include <com/sun/star/uno/Sequence.h>
 #include <com/sun/star/uno/Reference.h>
 
+#include <vector>
+
 namespace com::sun::star {
     namespace io { class XSeekable; class XOutputStream; }
 }
@@ -29,8 +31,8 @@ class ByteChucker final
 {
     css::uno::Reference < css::io::XOutputStream > xStream;
     css::uno::Reference < css::io::XSeekable > xSeek;
-    css::uno::Sequence < sal_Int8 > a2Sequence, a4Sequence;
-    sal_Int8 * const p2Sequence, * const p4Sequence;
+    /// Header fields not yet written, so that a header costs a single writeBytes() call
+    std::vector < sal_Int8 > maPending;
 
 public:
     ByteChucker (css::uno::Reference<css::io::XOutputStream> const & xOstream);
@@ -42,33 +44,41 @@ public:
     /// @throws css::uno::RuntimeException
     void WriteBytes( const css::uno::Sequence< sal_Int8 >& aData );
 
+    /** Writes the pending header fields written with WriteInt16() etc.
+
+        Must be called before anything else writes to the underlying stream.
+
+        @throws css::io::NotConnectedException
+        @throws css::io::BufferSizeExceededException
+        @throws css::io::IOException
+        @throws css::uno::RuntimeException
+     */
+    void Flush();
+
     /// @throws css::io::IOException
     /// @throws css::uno::RuntimeException
     sal_Int64 GetPosition();
 
     void WriteInt16(sal_Int16 nInt16)
     {
-        p2Sequence[0] = static_cast< sal_Int8 >((nInt16 >>  0 ) & 0xFF);
-        p2Sequence[1] = static_cast< sal_Int8 >((nInt16 >>  8 ) & 0xFF);
-        WriteBytes( a2Sequence );
+        maPending.push_back( static_cast< sal_Int8 >((nInt16 >>  0 ) & 0xFF) );
+        maPending.push_back( static_cast< sal_Int8 >((nInt16 >>  8 ) & 0xFF) );
     }
 
     void WriteInt32(sal_Int32 nInt32)
     {
-        p4Sequence[0] = static_cast< sal_Int8 >((nInt32 >>  0 ) & 0xFF);
-        p4Sequence[1] = static_cast< sal_Int8 >((nInt32 >>  8 ) & 0xFF);
-        p4Sequence[2] = static_cast< sal_Int8 >((nInt32 >> 16 ) & 0xFF);
-        p4Sequence[3] = static_cast< sal_Int8 >((nInt32 >> 24 ) & 0xFF);
-        WriteBytes( a4Sequence );
+        maPending.push_back( static_cast< sal_Int8 >((nInt32 >>  0 ) & 0xFF) );
+        maPending.push_back( static_cast< sal_Int8 >((nInt32 >>  8 ) & 0xFF) );
+        maPending.push_back( static_cast< sal_Int8 >((nInt32 >> 16 ) & 0xFF) );
+        maPending.push_back( static_cast< sal_Int8 >((nInt32 >> 24 ) & 0xFF) );
     }
 
     void WriteUInt32(sal_uInt32 nuInt32)
     {
-        p4Sequence[0] = static_cast < sal_Int8 > ((nuInt32 >>  0 ) & 0xFF);
-        p4Sequence[1] = static_cast < sal_Int8 > ((nuInt32 >>  8 ) & 0xFF);
-        p4Sequence[2] = static_cast < sal_Int8 > ((nuInt32 >> 16 ) & 0xFF);
-        p4Sequence[3] = static_cast < sal_Int8 > ((nuInt32 >> 24 ) & 0xFF);
-        WriteBytes( a4Sequence );
+        maPending.push_back( static_cast < sal_Int8 > ((nuInt32 >>  0 ) & 0xFF) );
+        maPending.push_back( static_cast < sal_Int8 > ((nuInt32 >>  8 ) & 0xFF) );
+        maPending.push_back( static_cast < sal_Int8 > ((nuInt32 >> 16 ) & 0xFF) );
+        maPending.push_back( static_cast < sal_Int8 > ((nuInt32 >> 24 ) & 0xFF) );
     }
 };
 
@@ -51,6 +51,8 @@ public:
     sal_Int32 m_nDerivedKeySize;
     sal_Int32 m_nStartKeyGenID;
     bool m_bTryWrongSHA1;
+    /// m_aKey derived with PBKDF2, kept as deriving it is slow on purpose
+    css::uno::Sequence < sal_Int8 > m_aDerivedKey;
 
     EncryptionData(const BaseEncryptionData& aData, const css::uno::Sequence< sal_Int8 >& aKey, sal_Int32 nEncAlg, sal_Int32 nCheckAlg, sal_Int32 nDerivedKeySize, sal_Int32 nStartKeyGenID, bool const bTryWrongSHA1)
     : BaseEncryptionData( aData )
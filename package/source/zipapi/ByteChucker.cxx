@@ -27,10 +27,6 @@ using namespace ::com::sun::star::uno;
 ByteChucker::ByteChucker(Reference<XOutputStream> const & xOstream)
 : xStream(xOstream)
 , xSeek (xOstream, UNO_QUERY )
-, a2Sequence ( 2 )
-, a4Sequence ( 4 )
-, p2Sequence ( a2Sequence.getArray() )
-, p4Sequence ( a4Sequence.getArray() )
 {
 }
 
@@ -40,12 +36,21 @@ ByteChucker::~ByteChucker()
 
 void ByteChucker::WriteBytes( const Sequence< sal_Int8 >& aData )
 {
+    Flush();
     xStream->writeBytes(aData);
 }
 
+void ByteChucker::Flush()
+{
+    if (maPending.empty())
+        return;
+    xStream->writeBytes(Sequence< sal_Int8 >(maPending.data(), maPending.size()));
+    maPending.clear();
+}
+
 sal_Int64 ByteChucker::GetPosition(  )
 {
-    return xSeek->getPosition();
+    return xSeek->getPosition() + maPending.size();
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
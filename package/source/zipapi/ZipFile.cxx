@@ -40,7 +40,6 @@
 #include <osl/diagnose.h>
 
 #include <algorithm>
-#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -176,15 +175,24 @@ uno::Reference< xml::crypto::XCipherContext > ZipFile::StaticGetCipher( const un
         // usable as symmetric session key
         aDerivedKey = xEncryptionData->m_aKey;
     }
-    else if ( rtl_Digest_E_None != rtl_digest_PBKDF2( reinterpret_cast< sal_uInt8* >( aDerivedKey.getArray() ),
-                        aDerivedKey.getLength(),
-                        reinterpret_cast< const sal_uInt8 * > (xEncryptionData->m_aKey.getConstArray() ),
-                        xEncryptionData->m_aKey.getLength(),
-                        reinterpret_cast< const sal_uInt8 * > ( xEncryptionData->m_aSalt.getConstArray() ),
-                        xEncryptionData->m_aSalt.getLength(),
-                        xEncryptionData->m_nIterationCount ) )
+    else if ( xEncryptionData->m_aDerivedKey.hasElements() )
     {
-        throw ZipIOException("Can not create derived key!" );
+        // already derived when checking the password
+        aDerivedKey = xEncryptionData->m_aDerivedKey;
+    }
+    else
+    {
+        if ( rtl_Digest_E_None != rtl_digest_PBKDF2( reinterpret_cast< sal_uInt8* >( aDerivedKey.getArray() ),
+                            aDerivedKey.getLength(),
+                            reinterpret_cast< const sal_uInt8 * > (xEncryptionData->m_aKey.getConstArray() ),
+                            xEncryptionData->m_aKey.getLength(),
+                            reinterpret_cast< const sal_uInt8 * > ( xEncryptionData->m_aSalt.getConstArray() ),
+                            xEncryptionData->m_aSalt.getLength(),
+                            xEncryptionData->m_nIterationCount ) )
+        {
+            throw ZipIOException("Can not create derived key!" );
+        }
+        xEncryptionData->m_aDerivedKey = aDerivedKey;
     }
 
     if ( xEncryptionData->m_nEncAlg == xml::crypto::CipherID::AES_CBC_W3C_PADDING )
@@ -528,7 +536,8 @@ bool ZipFile::hasValidPassword ( ZipEntry const & rEntry, const ::rtl::Reference
 
 namespace {
 
-class XBufferedStream : public cppu::WeakImplHelper<css::io::XInputStream, css::io::XSeekable>
+class XBufferedStream : public cppu::WeakImplHelper<css::io::XInputStream, css::io::XSeekable>,
+                        public comphelper::ByteReader
 {
     std::vector<sal_Int8> maBytes;
     size_t mnPos;
@@ -582,11 +591,17 @@ public:
 
         sal_Int32 nReadSize = std::min<sal_Int32>(nBytesToRead, remainingSize());
         rData.realloc(nReadSize);
-        auto pData = rData.getArray();
-        std::vector<sal_Int8>::const_iterator it = maBytes.cbegin();
-        std::advance(it, mnPos);
-        for (sal_Int32 i = 0; i < nReadSize; ++i, ++it)
-            pData[i] = *it;
+        return readSomeBytes(rData.getArray(), nReadSize);
+    }
+
+    // comphelper::ByteReader
+    virtual sal_Int32 readSomeBytes( sal_Int8* pData, sal_Int32 nBytesToRead ) override
+    {
+        if (!hasBytes())
+            return 0;
+
+        sal_Int32 nReadSize = std::min<sal_Int32>(nBytesToRead, remainingSize());
+        std::copy_n(maBytes.data() + mnPos, nReadSize, pData);
 
         mnPos += nReadSize;
 
@@ -117,7 +117,9 @@ void ZipOutputEntryBase::processDeflated( const uno::Sequence< sal_Int8 >& defla
 {
     if ( nLength > 0 )
     {
-        uno::Sequence< sal_Int8 > aTmpBuffer( deflateBuffer.getConstArray(), nLength );
+        // share a completely filled buffer instead of copying it
+        uno::Sequence< sal_Int8 > aTmpBuffer = nLength == deflateBuffer.getLength()
+            ? deflateBuffer : uno::Sequence< sal_Int8 >( deflateBuffer.getConstArray(), nLength );
         if ( m_bEncryptCurrentEntry && m_xDigestContext.is() && m_xCipherContext.is() )
         {
             // Need to update our digest before encryption...
@@ -203,6 +203,7 @@ void ZipOutputStream::writeEND(sal_uInt32 nOffset, sal_uInt32 nLength)
     m_aChucker.WriteUInt32( nLength );
     m_aChucker.WriteUInt32( nOffset );
     m_aChucker.WriteInt16( 0 );
+    m_aChucker.Flush();
 }
 
 static sal_uInt32 getTruncated( sal_Int64 nNum, bool *pIsTruncated )
@@ -271,6 +272,8 @@ void ZipOutputStream::writeEXT( const ZipEntry &rEntry )
         // unlikely to appreciate so fail instead:
         throw IOException( "File contains streams that are too large." );
     }
+
+    m_aChucker.Flush();
 }
 
 void ZipOutputStream::writeLOC( ZipEntry *pEntry, bool bEncrypt )
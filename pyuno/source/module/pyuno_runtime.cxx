@@ -522,17 +522,37 @@ PyRef Runtime::any2PyObject (const Any &a ) const
             // @since 0.9.2
             return PyRef( PyUNO_ByteSequence_new( byteSequence, *this ), SAL_NO_ACQUIRE );
         }
+        else if( auto pDoubles = o3tl::tryAccess<Sequence<double>>(a) )
+        {
+            // common for cell data, so don't go through a Sequence<Any>
+            PyRef tuple( PyTuple_New (pDoubles->getLength()), SAL_NO_ACQUIRE, NOT_NULL);
+            for( sal_Int32 i = 0; i < pDoubles->getLength(); i++ )
+                PyTuple_SetItem( tuple.get(), i, PyFloat_FromDouble( (*pDoubles)[i] ) );
+            return tuple;
+        }
+        else if( auto pStrings = o3tl::tryAccess<Sequence<OUString>>(a) )
+        {
+            PyRef tuple( PyTuple_New (pStrings->getLength()), SAL_NO_ACQUIRE, NOT_NULL);
+            for( sal_Int32 i = 0; i < pStrings->getLength(); i++ )
+                PyTuple_SetItem( tuple.get(), i, ustring2PyUnicode( (*pStrings)[i] ).getAcquired() );
+            return tuple;
+        }
         else
         {
-            Reference< XTypeConverter > tc = getImpl()->cargo->xTypeConverter;
-            tc->convertTo (a, cppu::UnoType<decltype(s)>::get()) >>= s;
+            // Only other kinds of sequences need the type converter, converting
+            // the elements to their own type is a no-op
+            if( !(a >>= s) )
+            {
+                Reference< XTypeConverter > tc = getImpl()->cargo->xTypeConverter;
+                tc->convertTo (a, cppu::UnoType<decltype(s)>::get()) >>= s;
+            }
             PyRef tuple( PyTuple_New (s.getLength()), SAL_NO_ACQUIRE, NOT_NULL);
             int i=0;
             try
             {
                 for ( i = 0; i < s.getLength (); i++)
                 {
-                    PyRef element = any2PyObject (tc->convertTo (s[i], s[i].getValueType() ));
+                    PyRef element = any2PyObject (s[i]);
                     OSL_ASSERT( element.is() );
                     PyTuple_SetItem( tuple.get(), i, element.getAcquired() );
                 }
@@ -506,11 +506,14 @@ oslFileError FileHandle_Impl::writeFileAt(
                 return osl_File_E_None;
             }
 
-            // update buffer (pointer)
+            // update buffer (pointer); there is nothing to read when appending
             sal_uInt64 uDone = 0;
-            result = readAt(bufptr, m_buffer, m_bufsiz, &uDone);
-            if (result != osl_File_E_None)
-                return result;
+            if (o3tl::make_unsigned(bufptr) < m_size)
+            {
+                result = readAt(bufptr, m_buffer, m_bufsiz, &uDone);
+                if (result != osl_File_E_None)
+                    return result;
+            }
 
             m_bufptr = bufptr;
             m_buflen = uDone;
@@ -49,6 +49,20 @@ public:
         CPPUNIT_ASSERT_EQUAL(RTL_CONSTASCII_LENGTH("  +1.E01"), end);
         CPPUNIT_ASSERT_EQUAL(10.0, res);
 
+        res = rtl::math::stringToDouble(
+                "-123456789.012345x",
+                '.', ',', &status, &end);
+        CPPUNIT_ASSERT_EQUAL(rtl_math_ConversionStatus_Ok, status);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(17), end);
+        CPPUNIT_ASSERT_EQUAL(-123456789.012345, res);
+
+        res = rtl::math::stringToDouble(
+                "0.1",
+                '.', ',', &status, &end);
+        CPPUNIT_ASSERT_EQUAL(rtl_math_ConversionStatus_Ok, status);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(3), end);
+        CPPUNIT_ASSERT_EQUAL(0.1, res);
+
         res = rtl::math::stringToDouble(
                 "NaN",
                 '.', ',', &status, &end);
@@ -21,11 +21,13 @@ private:
     void testStartsWithIgnoreAsciiCase();
     void testCompareTo();
     void testUtf8StringLiterals();
+    void testHashCode();
 
     CPPUNIT_TEST_SUITE(Test);
     CPPUNIT_TEST(testStartsWithIgnoreAsciiCase);
     CPPUNIT_TEST(testCompareTo);
     CPPUNIT_TEST(testUtf8StringLiterals);
+    CPPUNIT_TEST(testHashCode);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -116,6 +118,20 @@ void Test::testUtf8StringLiterals()
     CPPUNIT_ASSERT_EQUAL(97, int(static_cast<unsigned char>(sIn[2])));
 }
 
+void Test::testHashCode()
+{
+    // Check against the plain definition, for all the lengths around the unrolled loop:
+    const OString aStr("Line for a hashCode.\xff");
+    for (sal_Int32 nLen = 0; nLen <= aStr.getLength(); ++nLen)
+    {
+        sal_uInt32 nExpected = nLen;
+        for (sal_Int32 i = 0; i < nLen; ++i)
+            nExpected = nExpected * 37 + static_cast<unsigned char>(aStr[i]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<sal_Int32>(nExpected),
+                             rtl_str_hashCode_WithLength(aStr.getStr(), nLen));
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Test);
 
 }
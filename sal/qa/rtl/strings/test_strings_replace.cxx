@@ -276,6 +276,9 @@ void Test::ustringReplaceAll() {
 
     CPPUNIT_ASSERT_EQUAL(
         OUString("foobarbaz"), OUString("foobarfoo").replaceAll(u"foo", u"baz", 1));
+
+    CPPUNIT_ASSERT_EQUAL(
+        OUString("a.b.c."), OUString("a/b/c/").replaceAll(u"/", u"."));
 }
 
 void Test::ustringReplaceAllAsciiL() {
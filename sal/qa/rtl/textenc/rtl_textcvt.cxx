@@ -458,6 +458,8 @@ public:
 
     void testInvalidUtf8();
 
+    void testUtf8AsciiRuns();
+
     void testInvalidUnicode();
 
     void testSRCBUFFERTOSMALL();
@@ -474,6 +476,7 @@ public:
     CPPUNIT_TEST(testComplexCut);
     CPPUNIT_TEST(testInvalidUtf7);
     CPPUNIT_TEST(testInvalidUtf8);
+    CPPUNIT_TEST(testUtf8AsciiRuns);
     CPPUNIT_TEST(testInvalidUnicode);
     CPPUNIT_TEST(testSRCBUFFERTOSMALL);
     CPPUNIT_TEST(testMime);
@@ -3048,6 +3051,58 @@ void Test::testInvalidUtf8() {
     }
 }
 
+void Test::testUtf8AsciiRuns() {
+    // Non-ASCII characters within and after runs of ASCII characters:
+    OString const utf8("0123456789abcdef\xC3\xA4" "0123456789abcdef\xF0\x9F\x98\x80" "01234567");
+    OUString const utf16(u"0123456789abcdef\u00E4" "0123456789abcdef\U0001F600" "01234567");
+    CPPUNIT_ASSERT_EQUAL(utf16, OStringToOUString(utf8, RTL_TEXTENCODING_UTF8));
+    CPPUNIT_ASSERT_EQUAL(utf8, OUStringToOString(utf16, RTL_TEXTENCODING_UTF8));
+    // UTF-8, destination buffer too small within a run of ASCII characters:
+    {
+        auto const converter = rtl_createTextToUnicodeConverter(
+            RTL_TEXTENCODING_UTF8);
+        CPPUNIT_ASSERT(converter != nullptr);
+        sal_Unicode buf[TEST_STRING_SIZE];
+        sal_uInt32 info;
+        sal_Size converted;
+        auto const size = rtl_convertTextToUnicode(
+            converter, nullptr, utf8.getStr(), utf8.getLength(), buf, 20,
+            (RTL_TEXTTOUNICODE_FLAGS_UNDEFINED_ERROR
+             | RTL_TEXTTOUNICODE_FLAGS_MBUNDEFINED_ERROR
+             | RTL_TEXTTOUNICODE_FLAGS_INVALID_ERROR
+             | RTL_TEXTTOUNICODE_FLAGS_FLUSH),
+            &info, &converted);
+        CPPUNIT_ASSERT_EQUAL(sal_Size(20), size);
+        CPPUNIT_ASSERT_EQUAL(utf16.copy(0, 20), OUString(buf, sal_Int32(size)));
+        CPPUNIT_ASSERT_EQUAL(RTL_TEXTTOUNICODE_INFO_DESTBUFFERTOOSMALL, info);
+        CPPUNIT_ASSERT_EQUAL(sal_Size(21), converted);
+        rtl_destroyTextToUnicodeConverter(converter);
+    }
+    // Java UTF-8, NUL within a run of ASCII characters:
+    {
+        auto const converter = rtl_createUnicodeToTextConverter(
+            RTL_TEXTENCODING_JAVA_UTF8);
+        CPPUNIT_ASSERT(converter != nullptr);
+        char buf[TEST_STRING_SIZE];
+        sal_uInt32 info;
+        sal_Size converted;
+        auto const size = rtl_convertUnicodeToText(
+            converter, nullptr, u"0123456789abcdef\0" "0123456789abcdef", 33, buf,
+            TEST_STRING_SIZE,
+            (RTL_UNICODETOTEXT_FLAGS_UNDEFINED_ERROR
+             | RTL_UNICODETOTEXT_FLAGS_INVALID_ERROR
+             | RTL_UNICODETOTEXT_FLAGS_FLUSH),
+            &info, &converted);
+        CPPUNIT_ASSERT_EQUAL(sal_Size(34), size);
+        CPPUNIT_ASSERT_EQUAL(
+            OString("0123456789abcdef\xC0\x80" "0123456789abcdef"),
+            OString(buf, sal_Int32(size)));
+        CPPUNIT_ASSERT_EQUAL(sal_uInt32(0), info);
+        CPPUNIT_ASSERT_EQUAL(sal_Size(33), converted);
+        rtl_destroyUnicodeToTextConverter(converter);
+    }
+}
+
 void Test::testInvalidUnicode() {
     auto const converter = rtl_createUnicodeToTextConverter(RTL_TEXTENCODING_UTF8);
     CPPUNIT_ASSERT(converter != nullptr);
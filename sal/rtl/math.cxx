@@ -205,6 +205,52 @@ void SAL_CALL rtl_math_doubleToUString(rtl_uString ** pResult,
 
 namespace {
 
+// Converts a plain decimal number like "-123.45" with at most 15 significant
+// digits without strtod: both the digits and the power of ten are exact
+// doubles then, so a single correctly rounded division gives the same result.
+bool fastStringToDouble(char const * pBuf, double & rVal)
+{
+    char const * p = pBuf;
+    bool bNegative = *p == '-';
+    if (bNegative)
+        ++p;
+    sal_uInt64 nMantissa = 0;
+    int nDigits = 0;
+    int nFracDigits = -1;
+    for (; *p; ++p)
+    {
+        if (rtl::isAsciiDigit(static_cast<unsigned char>(*p)))
+        {
+            if (nDigits == 15)
+                return false;
+            nMantissa = nMantissa * 10 + (*p - '0');
+            ++nDigits;
+            if (nFracDigits >= 0)
+                ++nFracDigits;
+        }
+        else if (*p == '.' && nFracDigits < 0)
+            nFracDigits = 0;
+        else
+            return false;
+    }
+    if (nDigits == 0)
+        return false;
+    double fVal = static_cast<double>(nMantissa);
+    if (nFracDigits > 0)
+    {
+#if defined FLT_EVAL_METHOD && FLT_EVAL_METHOD != 0
+        // Excess precision could round twice.
+        return false;
+#else
+        static constexpr double aExp10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                             1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+        fVal /= aExp10[nFracDigits];
+#endif
+    }
+    rVal = bNegative ? -fVal : fVal;
+    return true;
+}
+
 template< typename CharT >
 double stringToDouble(CharT const * pBegin, CharT const * pEnd,
                              CharT cDecSeparator, CharT cGroupSeparator,
@@ -411,9 +457,10 @@ double stringToDouble(CharT const * pBegin, CharT const * pEnd,
         {
             buf[bufpos] = '\0';
             bufmap[bufpos] = p;
-            char* pCharParseEnd;
+            char* pCharParseEnd = buf + bufpos;
             errno = 0;
-            fVal = strtod_nolocale(buf, &pCharParseEnd);
+            if (!fastStringToDouble(buf, fVal))
+                fVal = strtod_nolocale(buf, &pCharParseEnd);
             if (errno == ERANGE)
             {
                 // Check for the dreaded rounded to 15 digits max value
@@ -19,7 +19,9 @@
 
 #include <sal/config.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include <sal/types.h>
 #include <rtl/character.hxx>
@@ -45,6 +47,40 @@ struct ImplUnicodeToUtf8Context
     sal_Unicode nHighSurrogate; /* 0xFFFF: write BOM */
 };
 
+// Copies the run of ASCII characters at the start of [pSrc..pSrc+n) to pDest,
+// returning its length.  NUL ends the run in Java UTF-8, where it is encoded
+// as two bytes:
+template<typename Src, typename Dest>
+sal_Size copyAsciiRun(Src const * pSrc, Dest * pDest, sal_Size n, bool bJavaUtf8)
+{
+    sal_Size i = 0;
+    if (!bJavaUtf8)
+    {
+        // Test eight characters at a time; the copy loop is left to the
+        // compiler to vectorize:
+        constexpr sal_uInt64 nNonAsciiMask
+            = sizeof (Src) == 1 ? 0x8080808080808080 : 0xFF80FF80FF80FF80;
+        constexpr sal_Size nStep = sizeof (sal_uInt64) / sizeof (Src) * 2;
+        for (; n - i >= nStep; i += nStep)
+        {
+            sal_uInt64 aWords[2];
+            std::memcpy(aWords, pSrc + i, sizeof aWords);
+            if (((aWords[0] | aWords[1]) & nNonAsciiMask) != 0)
+                break;
+            for (sal_Size j = 0; j != nStep; ++j)
+                pDest[i + j] = static_cast<Dest>(pSrc[i + j]);
+        }
+    }
+    for (; i != n; ++i)
+    {
+        sal_uInt32 c = pSrc[i];
+        if (c > 0x7F || (bJavaUtf8 && c == 0))
+            break;
+        pDest[i] = static_cast<Dest>(c);
+    }
+    return i;
+}
+
 }
 
 void * ImplCreateUtf8ToUnicodeContext()
@@ -95,6 +131,21 @@ sal_Size ImplConvertUtf8ToUnicode(
 
     while (pSrcBufPtr < pSrcBufEnd)
     {
+        if (nShift < 0)
+        {
+            sal_Size n = copyAsciiRun(
+                pSrcBufPtr, pDestBufPtr,
+                std::min<sal_Size>(pSrcBufEnd - pSrcBufPtr, pDestBufEnd - pDestBufPtr),
+                bJavaUtf8);
+            if (n != 0)
+            {
+                pSrcBufPtr += n;
+                pDestBufPtr += n;
+                bCheckBom = false;
+                startOfCurrentChar = pSrcBufPtr;
+                continue;
+            }
+        }
         bool bConsume = true;
         sal_uInt32 nChar = *pSrcBufPtr++;
         if (nShift < 0)
@@ -343,6 +394,19 @@ sal_Size ImplConvertUnicodeToUtf8(
 
     while (pSrcBufPtr < pSrcBufEnd)
     {
+        if (nHighSurrogate == 0)
+        {
+            sal_Size n = copyAsciiRun(
+                pSrcBufPtr, pDestBufPtr,
+                std::min<sal_Size>(pSrcBufEnd - pSrcBufPtr, pDestBufEnd - pDestBufPtr),
+                bJavaUtf8);
+            if (n != 0)
+            {
+                pSrcBufPtr += n;
+                pDestBufPtr += n;
+                continue;
+            }
+        }
         sal_uInt32 nChar = *pSrcBufPtr++;
         if (nHighSurrogate == 0)
         {
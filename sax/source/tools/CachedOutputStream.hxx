@@ -24,7 +24,7 @@ class ForMergeBase
 {
 public:
     virtual ~ForMergeBase() {}
-    virtual void append( const css::uno::Sequence<sal_Int8>& rWhat ) = 0;
+    virtual void append( const sal_Int8* pData, sal_Int32 nLen ) = 0;
 };
 
 class CachedOutputStream
@@ -88,7 +88,7 @@ public:
                 if (mbWriteToOutStream)
                     mxOutputStream->writeBytes( css::uno::Sequence<sal_Int8>(pStr, nLen) );
                 else
-                    mpForMerge->append( css::uno::Sequence<sal_Int8>(pStr, nLen) );
+                    mpForMerge->append( pStr, nLen );
                 return;
             }
         }
@@ -105,7 +105,7 @@ public:
         if (mbWriteToOutStream)
             mxOutputStream->writeBytes( mpCache );
         else
-            mpForMerge->append( mpCache );
+            mpForMerge->append( reinterpret_cast<const sal_Int8*>(pSeq->elements), mnCacheWrittenSize );
         // and next time write to the beginning
         mnCacheWrittenSize = 0;
     }
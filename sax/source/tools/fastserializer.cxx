@@ -152,6 +152,25 @@ namespace sax_fastparser {
         return ('0' <= c && c <= '9') || ('A' <= c && c <= 'F') || ('a' <= c && c <= 'f');
     }
 
+    /// Whether c is written as is, without any further check, when escaping.
+    static bool isPlainChar( char c )
+    {
+        if (static_cast<unsigned char>(c) < 0x20)
+            return false;
+        switch (c)
+        {
+            case '<':
+            case '>':
+            case '&':
+            case '\'':
+            case '"':
+            case '_':
+            case '\xEF':
+                return false;
+        }
+        return true;
+    }
+
     void FastSaxSerializer::write( const char* pStr, sal_Int32 nLen, bool bEscape )
     {
         if (nLen == -1)
@@ -169,6 +188,18 @@ namespace sax_fastparser {
         sal_Int32 nNextXescape = 0;
         for (sal_Int32 i = 0; i < nLen;)
         {
+            // Write a run of characters that need no escaping at once.
+            sal_Int32 nRunEnd = i;
+            while (nRunEnd < nLen && isPlainChar( pStr[ nRunEnd ] ))
+                ++nRunEnd;
+            if (nRunEnd != i)
+            {
+                writeBytes( pStr + i, nRunEnd - i );
+                i = nRunEnd;
+                if (i == nLen)
+                    break;
+            }
+
             char c = pStr[ i ];
             switch( c )
             {
@@ -616,11 +647,11 @@ namespace sax_fastparser {
                 maMarkStack.top()->m_DebugStartedElements.pop_front();
             }
 #endif
-            Sequence<sal_Int8> aSeq( maMarkStack.top()->getData() );
+            const Int8Vector aSeq( std::move( maMarkStack.top()->getData() ) );
             maMarkStack.pop();
             mbMarkStackEmpty = true;
             maCachedOutputStream.resetOutputToStream();
-            maCachedOutputStream.writeBytes( aSeq.getConstArray(), aSeq.getLength() );
+            maCachedOutputStream.writeBytes( aSeq.data(), aSeq.size() );
             return;
         }
 
@@ -628,7 +659,7 @@ namespace sax_fastparser {
         ::std::deque<sal_Int32> topDebugStartedElements(maMarkStack.top()->m_DebugStartedElements);
         ::std::deque<sal_Int32> topDebugEndedElements(maMarkStack.top()->m_DebugEndedElements);
 #endif
-        const Int8Sequence aMerge( maMarkStack.top()->getData() );
+        const Int8Vector aMerge( std::move( maMarkStack.top()->getData() ) );
         maMarkStack.pop();
 #ifdef DBG_UTIL
         switch (eMergeType)
@@ -713,10 +744,10 @@ namespace sax_fastparser {
         maCachedOutputStream.writeBytes( reinterpret_cast<const sal_Int8*>(pStr), nLen );
     }
 
-    FastSaxSerializer::Int8Sequence& FastSaxSerializer::ForMerge::getData()
+    FastSaxSerializer::Int8Vector& FastSaxSerializer::ForMerge::getData()
     {
-        merge( maData, maPostponed, true );
-        maPostponed.realloc( 0 );
+        merge( maData, maPostponed.data(), maPostponed.size(), true );
+        maPostponed.clear();
 
         return maData;
     }
@@ -725,61 +756,50 @@ namespace sax_fastparser {
     void FastSaxSerializer::ForMerge::print( )
     {
         std::cerr << "Data: ";
-        for ( sal_Int32 i=0, len=maData.getLength(); i < len; i++ )
+        for ( sal_Int8 c : maData )
         {
-            std::cerr << maData[i];
+            std::cerr << c;
         }
 
         std::cerr << "\nPostponed: ";
-        for ( sal_Int32 i=0, len=maPostponed.getLength(); i < len; i++ )
+        for ( sal_Int8 c : maPostponed )
         {
-            std::cerr << maPostponed[i];
+            std::cerr << c;
         }
 
         std::cerr << "\n";
     }
 #endif
 
-    void FastSaxSerializer::ForMerge::prepend( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForMerge::prepend( const Int8Vector &rWhat )
     {
-        merge( maData, rWhat, false );
+        merge( maData, rWhat.data(), rWhat.size(), false );
     }
 
-    void FastSaxSerializer::ForMerge::append( const css::uno::Sequence<sal_Int8> &rWhat )
+    void FastSaxSerializer::ForMerge::append( const sal_Int8* pData, sal_Int32 nLen )
     {
-        merge( maData, rWhat, true );
+        merge( maData, pData, nLen, true );
     }
 
-    void FastSaxSerializer::ForMerge::postpone( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForMerge::postpone( const Int8Vector &rWhat )
     {
-        merge( maPostponed, rWhat, true );
+        merge( maPostponed, rWhat.data(), rWhat.size(), true );
     }
 
-    void FastSaxSerializer::ForMerge::merge( Int8Sequence &rTop, const Int8Sequence &rMerge, bool bAppend )
+    void FastSaxSerializer::ForMerge::merge( Int8Vector &rTop, const sal_Int8* pMerge, sal_Int32 nMergeLen, bool bAppend )
     {
-        sal_Int32 nMergeLen = rMerge.getLength();
         if ( nMergeLen <= 0 )
             return;
 
-        sal_Int32 nTopLen = rTop.getLength();
-
-        rTop.realloc( nTopLen + nMergeLen );
-        if ( bAppend )
-        {
-            // append the rMerge to the rTop
-            memcpy( rTop.getArray() + nTopLen, rMerge.getConstArray(), nMergeLen );
-        }
-        else
-        {
-            // prepend the rMerge to the rTop
-            memmove( rTop.getArray() + nMergeLen, rTop.getConstArray(), nTopLen );
-            memcpy( rTop.getArray(), rMerge.getConstArray(), nMergeLen );
-        }
+        // unlike a realloc'd Sequence the vector grows geometrically, so that
+        // appending the pieces of a mark one by one doesn't copy everything
+        // collected so far again and again
+        rTop.insert( bAppend ? rTop.end() : rTop.begin(), pMerge, pMerge + nMergeLen );
     }
 
     void FastSaxSerializer::ForMerge::resetData( )
     {
-        maData = Int8Sequence();
+        maData.clear();
     }
 
     void FastSaxSerializer::ForSort::setCurrentElement( sal_Int32 nElement )
@@ -788,19 +808,18 @@ namespace sax_fastparser {
         if( std::find( rOrder.begin(), rOrder.end(), nElement ) != rOrder.end() )
         {
             mnCurrentElement = nElement;
-            if ( maData.find( nElement ) == maData.end() )
-                maData[ nElement ] = Int8Sequence();
+            maData.try_emplace( nElement );
         }
     }
 
-    void FastSaxSerializer::ForSort::prepend( const Int8Sequence &rWhat )
+    void FastSaxSerializer::ForSort::prepend( const Int8Vector &rWhat )
     {
-        append( rWhat );
+        append( rWhat.data(), rWhat.size() );
     }
 
-    void FastSaxSerializer::ForSort::append( const css::uno::Sequence<sal_Int8> &rWhat )
+    void FastSaxSerializer::ForSort::append( const sal_Int8* pData, sal_Int32 nLen )
     {
-        merge( maData[mnCurrentElement], rWhat, true );
+        merge( maData[mnCurrentElement], pData, nLen, true );
     }
 
     void FastSaxSerializer::ForSort::sort()
@@ -809,16 +828,15 @@ namespace sax_fastparser {
         resetData();
 
         // Sort it all
-        std::map< sal_Int32, Int8Sequence >::iterator iter;
         for ( const auto nIndex : std::as_const(maOrder) )
         {
-            iter = maData.find( nIndex );
+            auto iter = maData.find( nIndex );
             if ( iter != maData.end() )
-                ForMerge::append( iter->second );
+                ForMerge::append( iter->second.data(), iter->second.size() );
         }
     }
 
-    FastSaxSerializer::Int8Sequence& FastSaxSerializer::ForSort::getData()
+    FastSaxSerializer::Int8Vector& FastSaxSerializer::ForSort::getData()
     {
         sort( );
         return ForMerge::getData();
@@ -830,8 +848,8 @@ namespace sax_fastparser {
         for ( const auto& [rElement, rData] : maData )
         {
             std::cerr << "pair: " << rElement;
-            for ( sal_Int32 i=0, len=rData.getLength(); i < len; ++i )
-                std::cerr << rData[i];
+            for ( sal_Int8 c : rData )
+                std::cerr << c;
             std::cerr << "\n";
         }
 
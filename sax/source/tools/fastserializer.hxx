@@ -31,6 +31,7 @@
 #include <string_view>
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace sax_fastparser {
 
@@ -46,6 +47,7 @@ typedef std::vector<TokenValue> TokenValueList;
 class FastSaxSerializer
 {
     typedef css::uno::Sequence< ::sal_Int8 > Int8Sequence;
+    typedef std::vector< ::sal_Int8 > Int8Vector;
     typedef css::uno::Sequence< ::sal_Int32 > Int32Sequence;
 
 public:
@@ -166,8 +168,8 @@ private:
 
     class ForMerge : public ForMergeBase
     {
-        Int8Sequence maData;
-        Int8Sequence maPostponed;
+        Int8Vector maData;
+        Int8Vector maPostponed;
 
     public:
         sal_Int32 const m_Tag;
@@ -183,23 +185,23 @@ private:
         explicit ForMerge(sal_Int32 const nTag) : m_Tag(nTag) {}
 
         virtual void setCurrentElement( ::sal_Int32 /*nToken*/ ) {}
-        virtual Int8Sequence& getData();
+        virtual Int8Vector& getData();
 #if OSL_DEBUG_LEVEL > 0
         virtual void print();
 #endif
 
-        virtual void prepend( const Int8Sequence &rWhat );
-        virtual void append( const css::uno::Sequence<sal_Int8> &rWhat ) override;
-        void postpone( const Int8Sequence &rWhat );
+        virtual void prepend( const Int8Vector &rWhat );
+        virtual void append( const sal_Int8* pData, sal_Int32 nLen ) override;
+        void postpone( const Int8Vector &rWhat );
 
     protected:
         void resetData( );
-        static void merge( Int8Sequence &rTop, const Int8Sequence &rMerge, bool bAppend );
+        static void merge( Int8Vector &rTop, const sal_Int8* pMerge, sal_Int32 nMergeLen, bool bAppend );
     };
 
     class ForSort : public ForMerge
     {
-        std::map< ::sal_Int32, Int8Sequence > maData;
+        std::map< ::sal_Int32, Int8Vector > maData;
         sal_Int32 mnCurrentElement;
 
         Int32Sequence maOrder;
@@ -213,14 +215,14 @@ private:
 
         void setCurrentElement( ::sal_Int32 nToken ) override;
 
-        virtual Int8Sequence& getData() override;
+        virtual Int8Vector& getData() override;
 
 #if OSL_DEBUG_LEVEL > 0
         virtual void print() override;
 #endif
 
-        virtual void prepend( const Int8Sequence &rWhat ) override;
-        virtual void append( const css::uno::Sequence<sal_Int8> &rWhat ) override;
+        virtual void prepend( const Int8Vector &rWhat ) override;
+        virtual void append( const sal_Int8* pData, sal_Int32 nLen ) override;
     private:
         void sort();
     };
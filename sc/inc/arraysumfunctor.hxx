@@ -10,11 +10,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include "kahan.hxx"
 #include "arraysumfunctor.hxx"
 #include <formula/errorcodes.hxx>
 
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace sc::op
 {
 // Checkout available optimization options.
@@ -25,13 +30,24 @@ namespace sc::op
 // Whenever we raise baseline to e.g. AVX, this may get
 // replaced with AVX code (get it from git history).
 // Do it similarly with other platforms.
+// NEON is part of the AArch64 baseline, so the same applies there.
 #if defined(X86_64) || (defined(X86) && defined(_WIN32))
 #define SC_USE_SSE2 1
 KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent);
+size_t findNonFiniteSSE2(size_t i, size_t nSize, const double* pCurrent);
+double executeMaxSSE2(size_t& i, size_t nSize, const double* pCurrent, double fInit);
+double executeMinSSE2(size_t& i, size_t nSize, const double* pCurrent, double fInit);
+void executeMultiplySSE2(size_t& i, size_t nSize, double* pResult, const double* pCurrent);
 #else
 #define SC_USE_SSE2 0
 #endif
 
+#if !SC_USE_SSE2 && (defined(__aarch64__) || defined(_M_ARM64))
+#define SC_USE_NEON 1
+#else
+#define SC_USE_NEON 0
+#endif
+
 /**
   * If no boosts available, Unrolled KahanSum.
   * Most likely to use on android.
@@ -61,6 +77,98 @@ static inline KahanSum executeUnrolled(size_t& i, size_t nSize, const double* pC
     return 0.0;
 }
 
+#if SC_USE_NEON
+/** Kahan sum with NEON, see sumSSE2().
+  */
+static inline void sumNEON(float64x2_t& sum, float64x2_t& err, const float64x2_t& value)
+{
+    float64x2_t t = vaddq_f64(sum, value);
+    uint64x2_t mask = vcgeq_f64(vabsq_f64(sum), vabsq_f64(value));
+    float64x2_t a = vbslq_f64(mask, sum, value);
+    float64x2_t b = vbslq_f64(mask, value, sum);
+    err = vaddq_f64(err, vaddq_f64(vsubq_f64(a, t), b));
+    sum = t;
+}
+
+static inline KahanSum executeNEON(size_t& i, size_t nSize, const double* pCurrent)
+{
+    if (nSize > i + 3)
+    {
+        float64x2_t sum1 = vdupq_n_f64(0.0);
+        float64x2_t err1 = vdupq_n_f64(0.0);
+        float64x2_t sum2 = vdupq_n_f64(0.0);
+        float64x2_t err2 = vdupq_n_f64(0.0);
+
+        for (; i + 3 < nSize; i += 4)
+        {
+            sumNEON(sum1, err1, vld1q_f64(pCurrent));
+            sumNEON(sum2, err2, vld1q_f64(pCurrent + 2));
+            pCurrent += 4;
+        }
+
+        sumNEON(sum1, err1, sum2);
+        sumNEON(sum1, err1, err2);
+
+        double sums[2];
+        double errs[2];
+        vst1q_f64(&sums[0], sum1);
+        vst1q_f64(&errs[0], err1);
+
+        sumNeumanierNormal(sums[0], errs[0], sums[1]);
+        sumNeumanierNormal(sums[0], errs[0], errs[1]);
+        return { sums[0], errs[0] };
+    }
+    return { 0.0, 0.0 };
+}
+
+/** All ones for finite values, zero for infinities and NaNs (x - x is NaN for those).
+  */
+static inline uint64x2_t finiteMaskNEON(const float64x2_t& value)
+{
+    return vceqq_f64(vsubq_f64(value, value), vdupq_n_f64(0.0));
+}
+
+static inline size_t findNonFiniteNEON(size_t i, size_t nSize, const double* pCurrent)
+{
+    for (; i + 1 < nSize; i += 2)
+    {
+        uint64x2_t mask = finiteMaskNEON(vld1q_f64(pCurrent + i));
+        if ((vgetq_lane_u64(mask, 0) & vgetq_lane_u64(mask, 1)) == 0)
+            break;
+    }
+    return i;
+}
+
+template <bool bMax>
+static inline double executeExtremeNEON(size_t& i, size_t nSize, const double* pCurrent,
+                                        double fInit)
+{
+    float64x2_t acc = vdupq_n_f64(fInit);
+    for (; i + 1 < nSize; i += 2)
+    {
+        float64x2_t value = vld1q_f64(pCurrent + i);
+        // Non-finite elements are replaced by the accumulator, i.e. ignored.
+        value = vbslq_f64(finiteMaskNEON(value), value, acc);
+        acc = bMax ? vmaxq_f64(acc, value) : vminq_f64(acc, value);
+    }
+    return bMax ? std::max(vgetq_lane_f64(acc, 0), vgetq_lane_f64(acc, 1))
+                : std::min(vgetq_lane_f64(acc, 0), vgetq_lane_f64(acc, 1));
+}
+
+static inline void executeMultiplyNEON(size_t& i, size_t nSize, double* pResult,
+                                       const double* pCurrent)
+{
+    for (; i + 1 < nSize; i += 2)
+    {
+        float64x2_t value = vld1q_f64(pResult + i);
+        // NaNs (errors, including ElementNaN) in the result array are kept as they are.
+        uint64x2_t ordered = vceqq_f64(value, value);
+        float64x2_t product = vmulq_f64(value, vld1q_f64(pCurrent + i));
+        vst1q_f64(pResult + i, vbslq_f64(ordered, product, value));
+    }
+}
+#endif
+
 /**
   * This function task is to choose the fastest method available to perform the sum.
   * @param i
@@ -71,6 +179,8 @@ static inline KahanSum executeFast(size_t& i, size_t nSize, const double* pCurre
 {
 #if SC_USE_SSE2
     return executeSSE2(i, nSize, pCurrent);
+#elif SC_USE_NEON
+    return executeNEON(i, nSize, pCurrent);
 #else
     return executeUnrolled(i, nSize, pCurrent);
 #endif
@@ -117,6 +227,88 @@ inline KahanSum sumArray(const double* pArray, size_t nSize)
     return fSum;
 }
 
+/**
+  * Find the first element of an array that is not a finite number, e.g. an
+  * error encoded as NaN.
+  * @return the index of that element, or nSize if all elements are finite.
+  */
+inline size_t findNonFinite(const double* pArray, size_t nSize)
+{
+    size_t i = 0;
+#if SC_USE_SSE2
+    i = findNonFiniteSSE2(i, nSize, pArray);
+#elif SC_USE_NEON
+    i = findNonFiniteNEON(i, nSize, pArray);
+#endif
+    for (; i < nSize; ++i)
+    {
+        if (!std::isfinite(pArray[i]))
+            break;
+    }
+    return i;
+}
+
+/**
+  * Maximum of fInit and all finite elements of an array.  Non-finite
+  * elements are ignored, use findNonFinite() first if they matter.
+  */
+inline double maxArray(const double* pArray, size_t nSize, double fInit)
+{
+    size_t i = 0;
+    double fMax = fInit;
+#if SC_USE_SSE2
+    fMax = executeMaxSSE2(i, nSize, pArray, fInit);
+#elif SC_USE_NEON
+    fMax = executeExtremeNEON<true>(i, nSize, pArray, fInit);
+#endif
+    for (; i < nSize; ++i)
+    {
+        if (std::isfinite(pArray[i]))
+            fMax = std::max(fMax, pArray[i]);
+    }
+    return fMax;
+}
+
+/**
+  * Minimum of fInit and all finite elements of an array, see maxArray().
+  */
+inline double minArray(const double* pArray, size_t nSize, double fInit)
+{
+    size_t i = 0;
+    double fMin = fInit;
+#if SC_USE_SSE2
+    fMin = executeMinSSE2(i, nSize, pArray, fInit);
+#elif SC_USE_NEON
+    fMin = executeExtremeNEON<false>(i, nSize, pArray, fInit);
+#endif
+    for (; i < nSize; ++i)
+    {
+        if (std::isfinite(pArray[i]))
+            fMin = std::min(fMin, pArray[i]);
+    }
+    return fMin;
+}
+
+/**
+  * Elementwise pResult[i] *= pArray[i], as used by SUMPRODUCT.  Elements of
+  * pResult that are NaN (errors, or ElementNaN for non-numeric elements)
+  * are left untouched.
+  */
+inline void multiplyArray(double* pResult, const double* pArray, size_t nSize)
+{
+    size_t i = 0;
+#if SC_USE_SSE2
+    executeMultiplySSE2(i, nSize, pResult, pArray);
+#elif SC_USE_NEON
+    executeMultiplyNEON(i, nSize, pResult, pArray);
+#endif
+    for (; i < nSize; ++i)
+    {
+        if (!std::isnan(pResult[i]))
+            pResult[i] *= pArray[i];
+    }
+}
+
 } // end namespace sc::op
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
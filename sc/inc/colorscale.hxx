@@ -240,10 +240,20 @@ protected:
 
 private:
 
+    /**
+     * Sorted values of all numeric cells in the range.  The cache is kept
+     * across paints until a cell in the range changes or the range itself
+     * does.
+     */
     struct ScColorFormatCache
     {
         std::vector<double> maValues;
+        ScRangeList maRanges;
+        /// Null in clipboard and undo documents, which do not broadcast.
+        std::unique_ptr<ScFormulaListener> mpListener;
     };
+
+    bool isCacheValid() const;
     mutable std::unique_ptr<ScColorFormatCache> mpCache;
 };
 
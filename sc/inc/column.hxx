@@ -153,6 +153,7 @@ public:
 
     sal_uInt32  GetNumberFormat( const ScInterpreterContext& rContext, SCROW nRow ) const;
     sal_uInt32  GetNumberFormat( SCROW nStartRow, SCROW nEndRow ) const;
+    bool        HasOnlyGeneralNumberFormat( SCROW nStartRow, SCROW nEndRow ) const;
 
     /// Including current, may return -1
     SCROW       GetNextUnprotected( SCROW nRow, bool bUp ) const;
@@ -480,6 +481,12 @@ public:
     void        SetDirtyAfterLoad();
     void        SetTableOpDirty( const ScRange& );
     void        CalcAll();
+    /**
+     * Collect the sheets referenced by formula cells of this column.
+     * rUnknown is set if some formula may reference sheets that cannot be
+     * determined without calculating it, e.g. through INDIRECT().
+     */
+    void        CollectReferencedTabs( std::set<SCTAB>& rTabs, bool& rUnknown ) const;
     void CalcAfterLoad( sc::CompileFormulaContext& rCxt, bool bStartListening );
     void CompileAll( sc::CompileFormulaContext& rCxt );
     void CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress );
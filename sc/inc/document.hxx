@@ -100,6 +100,8 @@ class ColumnSet;
 class UpdatedRangeNames;
 class TableColumnBlockPositionSet;
 class ColumnIterator;
+class FormulaGroupWorkStealingScheduler;
+class FormulaGroupProfiler;
 class ExternalDataMapper;
 class Sparkline;
 class SparklineGroup;
@@ -361,6 +363,7 @@ private:
 
     std::shared_ptr<sc::FormulaGroupContext> mpFormulaGroupCxt;
     bool                mbFormulaGroupCxtBlockDiscard;
+    std::unique_ptr<sc::FormulaGroupProfiler> mpFormulaGroupProfiler;
 
     ScCalcConfig        maCalcConfig;
 
@@ -472,6 +475,7 @@ private:
     mutable ScInterpreterContext maInterpreterContext;
 
     std::shared_mutex mScLookupMutex; // protection for thread-unsafe parts of handling ScLookup
+    std::unique_ptr<ScLookupCacheMap> mxScLookupCache; // cache for lookups like VLOOKUP and MATCH
     std::unique_ptr<ScSortedRangeCacheMap> mxScSortedRangeCache; // cache for unsorted lookups
 
     static const sal_uInt16 nSrcVer;                        // file version (load/save)
@@ -1213,6 +1217,11 @@ public:
     void                                      BlockFormulaGroupContextDiscard( bool block )
                                                   { mbFormulaGroupCxtBlockDiscard = block; }
 
+    /// Statistics of the formula group calculations, created on first use.
+    SC_DLLPUBLIC sc::FormulaGroupProfiler&    GetFormulaGroupProfiler();
+    /// The profiler if it is recording and this is not a threaded calculation, else nullptr.
+    sc::FormulaGroupProfiler*                 GetRecordingFormulaGroupProfiler();
+
     // Note that if pShared is set and a value is returned that way, the returned OUString is empty.
     SC_DLLPUBLIC OUString                     GetInputString( SCCOL nCol, SCROW nRow, SCTAB nTab, bool bForceSystemLocale = false ) const;
     FormulaError                              GetStringForFormula( const ScAddress& rPos, OUString& rString );
@@ -1223,6 +1232,9 @@ public:
     SC_DLLPUBLIC double                       RoundValueAsShown( double fVal, sal_uInt32 nFormat, const ScInterpreterContext* pContext = nullptr ) const;
     SC_DLLPUBLIC sal_uInt32                   GetNumberFormat( SCCOL nCol, SCROW nRow, SCTAB nTab ) const;
     sal_uInt32                                GetNumberFormat( const ScRange& rRange ) const;
+    /** Check whether all cells in rRange have the General number format of
+        any language, the column attributes only. */
+    bool                                      HasOnlyGeneralNumberFormat( const ScRange& rRange ) const;
     SC_DLLPUBLIC sal_uInt32                   GetNumberFormat( const ScInterpreterContext& rContext, const ScAddress& ) const;
     SC_DLLPUBLIC void                         SetNumberFormat( const ScAddress& rPos, sal_uInt32 nNumberFormat );
 
@@ -1367,6 +1379,14 @@ public:
     // Useful to ensure that the given cells will not need interpreting.
     bool              InterpretCellsIfNeeded( const ScRangeList& rRanges );
     SC_DLLPUBLIC void CalcAll();
+    /**
+     * Order in which CalcAll() calculates the sheets: sheets that others
+     * depend on come first, sorted into topological levels of the sheet
+     * reference graph.  Falls back to document order if the sheets depend
+     * on each other circularly, if references cannot be determined
+     * statically, or if iterative calculation is enabled.
+     */
+    std::vector<SCTAB> GetCalcAllTabOrder() const;
     SC_DLLPUBLIC void CalcAfterLoad( bool bStartListening = true );
     void              CompileAll();
     void              CompileXML();
@@ -1395,8 +1415,9 @@ public:
     SC_DLLPUBLIC  void   SetAutoNameCache(  std::unique_ptr<ScAutoNameCache> pCache );
 
                     /** Creates a ScLookupCache cache for the range if it
-                        doesn't already exist. */
-    ScLookupCache & GetLookupCache( const ScRange & rRange, ScInterpreterContext* pContext );
+                        doesn't already exist. The cache is shared by all
+                        interpreter threads. */
+    ScLookupCache & GetLookupCache( const ScRange & rRange );
     ScSortedRangeCache & GetSortedRangeCache( const ScRange & rRange, const ScQueryParam& param,
                                               ScInterpreterContext* pContext );
                     /** Only ScLookupCache dtor uses RemoveLookupCache(), do
@@ -2272,6 +2293,13 @@ public:
     void SC_DLLPUBLIC SetFormulaResults( const ScAddress& rTopPos, const double* pResults, size_t nLen );
 
     void CalculateInColumnInThread( ScInterpreterContext& rContext, const ScRange& rCalcRange, unsigned nThisThread, unsigned nThreadsTotal);
+    /**
+     * Calculate the formula cells in rCalcRange in a worker thread, taking
+     * the cells to calculate from rScheduler instead of a fixed interleaved
+     * share.
+     */
+    void CalculateInColumnInThread( ScInterpreterContext& rContext, const ScRange& rCalcRange, unsigned nThisThread,
+                                    sc::FormulaGroupWorkStealingScheduler& rScheduler );
     void HandleStuffAfterParallelCalculation( SCCOL nColStart, SCCOL nColEnd, SCROW nRow, size_t nLen, SCTAB nTab, ScInterpreter* pInterpreter );
 
     /**
@@ -30,6 +30,8 @@ struct ScTabOpParam;
 struct ScDocumentImportImpl;
 enum class SvtScriptType : sal_uInt8;
 
+namespace svl { class SharedString; }
+
 /**
  * Accessor class to ScDocument.  Its purpose is to allow import filter to
  * fill the document model and nothing but that.  Filling the document via
@@ -99,6 +101,8 @@ public:
             const ScSetStringParam* pStringParam = nullptr);
     void setNumericCell(const ScAddress& rPos, double fVal);
     void setStringCell(const ScAddress& rPos, const OUString& rStr);
+    /** Set a string already interned in the document's string pool. */
+    void setStringCell(const ScAddress& rPos, const svl::SharedString& rStr);
     void setEditCell(const ScAddress& rPos, std::unique_ptr<EditTextObject> pEditText);
 
     void setFormulaCell(
@@ -394,6 +394,12 @@ public:
 
     /// @see vcl::ITiledRenderable::completeFunction().
     virtual void completeFunction(const OUString& rFunctionName) override;
+
+    /// @see vcl::ITiledRenderable::supportsCommand().
+    bool supportsCommand(std::u16string_view rCommand) override;
+
+    /// @see vcl::ITiledRenderable::getCommandValues().
+    void getCommandValues(tools::JsonWriter& rJsonWriter, std::string_view rCommand) override;
 };
 
 class ScDrawPagesObj final : public cppu::WeakImplHelper<
@@ -722,6 +722,14 @@ public:
 
     void enableDocTimer( bool bEnable );
 
+    /**
+     * While deferred, refreshing a source document does not yet update the
+     * cells referencing it.  Ending the deferral updates the cells of all
+     * source documents refreshed meanwhile at once, so that a cell
+     * referencing several of them is set dirty and repainted only once.
+     */
+    void deferRefCellRefresh( bool bDefer );
+
     /** Add all known external files to the LinkManager. */
     void addFilesToLinkManager();
 
@@ -729,6 +737,7 @@ private:
     ScExternalRefManager(const ScExternalRefManager&) = delete;
 
     void refreshAllRefCells(sal_uInt16 nFileId);
+    static void refreshRefCells(const RefCellSet& rRefCells);
 
     void fillCellFormat(sal_uLong nFmtIndex, ScExternalRefCache::CellFormat* pFmt) const;
 
@@ -864,6 +873,10 @@ private:
 
     bool mbDocTimerEnabled:1;
 
+    bool mbRefCellRefreshDeferred:1;
+    /** Source documents refreshed while mbRefCellRefreshDeferred is set. */
+    o3tl::sorted_vector<sal_uInt16> maDeferredRefreshFileIds;
+
     AutoTimer maSrcDocTimer;
     DECL_DLLPRIVATE_LINK(TimeOutHdl, Timer*, void);
 };
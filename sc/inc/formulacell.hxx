@@ -168,6 +168,9 @@ private:
     bool InterpretFormulaGroupOpenCL(sc::FormulaLogger::GroupScope& aScope,
                                      bool& bDependencyComputed,
                                      bool& bDependencyCheckFailed);
+    bool InterpretFormulaGroupCPU(sc::FormulaLogger::GroupScope& aScope,
+                                  bool& bDependencyComputed,
+                                  bool& bDependencyCheckFailed);
     bool InterpretInvariantFormulaGroup();
 
 public:
@@ -222,6 +225,13 @@ public:
 
     ScFormulaCell(const ScFormulaCell& rCell, ScDocument& rDoc, const ScAddress& rPos, ScCloneFlags nCloneFlags = ScCloneFlags::Default);
 
+    /**
+     * Copy of rCell without a copy of its token array, the cell joins xGroup
+     * instead.  The token array of xGroup must be what copying the one of
+     * rCell to rPos would result in, the caller adjusts the group length.
+     */
+    ScFormulaCell(const ScFormulaCell& rCell, ScDocument& rDoc, const ScAddress& rPos, const ScFormulaCellGroupRef& xGroup);
+
     void            SetFreeFlying( bool b ) { mbFreeFlying = b; }
 
     size_t GetHash() const;
@@ -235,7 +245,12 @@ public:
     // If setting entire document dirty after load, no broadcasts but still append to FormulaTree.
     void            SetDirtyAfterLoad();
     void ResetTableOpDirtyVar();
-    void            SetTableOpDirty();
+    /** @param bTrack
+            Broadcast the change right away.  If false the caller calls
+            ScDocument::TrackFormulas() after setting several cells, which
+            broadcasts adjacent cells with one hint.
+     */
+    void            SetTableOpDirty( bool bTrack = true );
 
     bool IsDirtyOrInTableOpDirty() const
     {
@@ -258,7 +273,14 @@ public:
 
     void CompileTokenArray( bool bNoListening = false );
     void CompileTokenArray( sc::CompileFormulaContext& rCxt, bool bNoListening = false );
-    void CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress );        // compile temporary string tokens
+    /** Compile temporary string tokens.
+
+        @param pLastCell the formula cell last compiled further up in the same
+               column, if any. Its tokens are reused if the formula is the
+               same relative to its position, also if it is not adjacent.
+     */
+    void CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress,
+                     const ScFormulaCell* pLastCell = nullptr );
     void CalcAfterLoad( sc::CompileFormulaContext& rCxt, bool bStartListening );
     bool            MarkUsedExternalReferences();
     // Returns true if the cell was interpreted as part of the formula group.
@@ -145,6 +145,35 @@ public:
     virtual bool interpret(ScDocument& rDoc, const ScAddress& rTopPos, ScFormulaCellGroupRef& xGroup, ScTokenArray& rCode) = 0;
 };
 
+/**
+ * Formula group interpreter that evaluates the converted token array of a
+ * group on the CPU, one operation over all rows of the group at a time.
+ *
+ * Only the four basic arithmetic operators, unary minus, the comparison
+ * operators and SUM, AVERAGE, MIN, MAX and COUNT over purely numeric input
+ * are handled; interpret() fails for anything else, so that the caller can
+ * fall back to the threaded or the plain interpreter.  Results are meant to
+ * be identical to those of ScInterpreter, including the error a row ends
+ * up with.
+ */
+class FormulaGroupInterpreterCPU final : public FormulaGroupInterpreter
+{
+public:
+    static FormulaGroupInterpreterCPU& get();
+
+    /**
+     * Check whether the compiled (RPN) code of a formula is made up only of
+     * what interpret() can handle.
+     *
+     * @param rLogicalResult set to true if the formula results in a boolean
+     *                       value, i.e. its last operation is a comparison.
+     */
+    static bool isSupported(const ScTokenArray& rCode, bool& rLogicalResult);
+
+    virtual ScMatrixRef inverseMatrix(const ScMatrix& rMat) override;
+    virtual bool interpret(ScDocument& rDoc, const ScAddress& rTopPos, ScFormulaCellGroupRef& xGroup, ScTokenArray& rCode) override;
+};
+
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
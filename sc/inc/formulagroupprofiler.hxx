@@ -0,0 +1,188 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "address.hxx"
+
+#include <rtl/ustring.hxx>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <vector>
+
+namespace sc {
+
+/// How a formula group ended up being calculated.
+enum class FormulaGroupCalcPath
+{
+    /// Not as a group, every cell is interpreted on its own.
+    Software,
+    OpenCL,
+    Vector,
+    Threaded
+};
+
+/**
+ * Collects per formula group statistics of formula group calculations of a
+ * document: how often and how long a group was calculated, which way, and
+ * why group calculation was not possible.
+ *
+ * Recording is off by default and then costs one test per group
+ * calculation attempt.  Only the main thread records, attempts made during
+ * a threaded calculation are not counted.  Groups are identified by the
+ * position and length of their top cell, so editing the group starts a new
+ * entry.  The time of a group includes the time spent calculating the
+ * groups it depends on.
+ */
+class FormulaGroupProfiler
+{
+public:
+    struct Entry
+    {
+        ScAddress maTopPos;
+        SCROW mnLength = 0;
+        FormulaGroupCalcPath mePath = FormulaGroupCalcPath::Software;
+        /// Why the group was not calculated as a group, the first one given.
+        OUString maFallbackReason;
+        size_t mnCalls = 0;
+        /// Number of group calculations that fell back to single cells.
+        size_t mnFallbacks = 0;
+        std::chrono::steady_clock::duration maTime {};
+    };
+
+    /**
+     * Records one group calculation attempt when it goes out of scope.  The
+     * reason set last by setFallbackReason() while it is the innermost scope
+     * is assigned to it.
+     */
+    class GroupScope
+    {
+        friend class FormulaGroupProfiler;
+
+        FormulaGroupProfiler* mpProfiler = nullptr;
+        GroupScope* mpOuter = nullptr;
+        ScAddress maTopPos;
+        SCROW mnLength = 0;
+        FormulaGroupCalcPath mePath = FormulaGroupCalcPath::Software;
+        const char* mpReason = nullptr;
+        std::chrono::steady_clock::time_point maStart;
+
+    public:
+        GroupScope() = default;
+        GroupScope(const GroupScope&) = delete;
+        GroupScope& operator=(const GroupScope&) = delete;
+
+        ~GroupScope()
+        {
+            if (!mpProfiler)
+                return;
+            assert(mpProfiler->mpInnermost == this);
+            mpProfiler->mpInnermost = mpOuter;
+            mpProfiler->record(*this, std::chrono::steady_clock::now() - maStart);
+        }
+
+        void start(FormulaGroupProfiler& rProfiler, const ScAddress& rTopPos, SCROW nLength)
+        {
+            assert(!mpProfiler);
+            mpProfiler = &rProfiler;
+            mpOuter = rProfiler.mpInnermost;
+            rProfiler.mpInnermost = this;
+            maTopPos = rTopPos;
+            mnLength = nLength;
+            maStart = std::chrono::steady_clock::now();
+        }
+
+        void setPath(FormulaGroupCalcPath ePath) { mePath = ePath; }
+    };
+
+private:
+    std::map<ScAddress, Entry> maEntries;
+    GroupScope* mpInnermost = nullptr;
+    bool mbEnabled = false;
+
+    void record(const GroupScope& rScope, std::chrono::steady_clock::duration aTime)
+    {
+        Entry& rEntry = maEntries[rScope.maTopPos];
+        if (rEntry.mnLength != rScope.mnLength)
+        {
+            // A different group at the same position.
+            rEntry = Entry();
+            rEntry.maTopPos = rScope.maTopPos;
+            rEntry.mnLength = rScope.mnLength;
+        }
+        rEntry.mePath = rScope.mePath;
+        ++rEntry.mnCalls;
+        rEntry.maTime += aTime;
+        if (rScope.mePath == FormulaGroupCalcPath::Software)
+        {
+            ++rEntry.mnFallbacks;
+            if (rEntry.maFallbackReason.isEmpty() && rScope.mpReason)
+                rEntry.maFallbackReason = OUString::createFromAscii(rScope.mpReason);
+        }
+    }
+
+public:
+    FormulaGroupProfiler() = default;
+    FormulaGroupProfiler(const FormulaGroupProfiler&) = delete;
+    FormulaGroupProfiler& operator=(const FormulaGroupProfiler&) = delete;
+
+    bool isEnabled() const { return mbEnabled; }
+    void setEnabled(bool bEnabled) { mbEnabled = bEnabled; }
+
+    void reset()
+    {
+        assert(!mpInnermost);
+        maEntries.clear();
+    }
+
+    /// Give the reason why the group currently being calculated falls back to single cells.
+    void setFallbackReason(const char* pReason)
+    {
+        if (mpInnermost)
+            mpInnermost->mpReason = pReason;
+    }
+
+    /// Up to nCount entries with the longest calculation time first.
+    std::vector<const Entry*> getTopEntries(size_t nCount) const
+    {
+        std::vector<const Entry*> aEntries;
+        aEntries.reserve(maEntries.size());
+        for (const auto& rPair : maEntries)
+            aEntries.push_back(&rPair.second);
+
+        nCount = std::min(nCount, aEntries.size());
+        std::partial_sort(aEntries.begin(), aEntries.begin() + nCount, aEntries.end(),
+                          [](const Entry* p1, const Entry* p2) { return p1->maTime > p2->maTime; });
+        aEntries.resize(nCount);
+        return aEntries;
+    }
+
+    static const char* getPathName(FormulaGroupCalcPath ePath)
+    {
+        switch (ePath)
+        {
+            case FormulaGroupCalcPath::OpenCL:
+                return "opencl";
+            case FormulaGroupCalcPath::Vector:
+                return "vector";
+            case FormulaGroupCalcPath::Threaded:
+                return "threaded";
+            case FormulaGroupCalcPath::Software:
+                break;
+        }
+        return "software";
+    }
+};
+
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
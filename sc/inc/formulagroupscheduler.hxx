@@ -0,0 +1,201 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <sal/types.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sc {
+
+/**
+ * Distributes the cells of a threaded formula group calculation among the
+ * worker threads.
+ *
+ * The cells of all columns being calculated are numbered consecutively,
+ * column by column.  Every worker starts out owning an equal contiguous
+ * share of these indices and takes small chunks from the front of it.  A
+ * worker that has run out of work steals the back half of the remaining
+ * share of a neighbour, so that rows with very uneven calculation cost do
+ * not leave most of the threads idle while one of them is still busy.
+ *
+ * Statistics are collected per worker and can be dumped after the
+ * calculation to judge how well the work was balanced.
+ */
+class FormulaGroupWorkStealingScheduler
+{
+public:
+    struct WorkerStats
+    {
+        size_t mnCells = 0;
+        size_t mnChunks = 0;
+        size_t mnSteals = 0;
+        std::chrono::steady_clock::duration maBusyTime {};
+    };
+
+private:
+    struct alignas(64) Worker
+    {
+        std::mutex maMutex;
+        size_t mnBegin = 0;
+        size_t mnEnd = 0;
+        WorkerStats maStats;
+    };
+
+    std::vector<Worker> maWorkers;
+    size_t mnTotal;
+    size_t mnChunkSize;
+
+    /// Try to move part of another worker's share to nWorker.  Called with no lock held.
+    bool steal(unsigned nWorker)
+    {
+        const unsigned nWorkers = maWorkers.size();
+        for (unsigned nOffset = 1; nOffset < nWorkers; ++nOffset)
+        {
+            Worker& rVictim = maWorkers[(nWorker + nOffset) % nWorkers];
+            size_t nBegin, nEnd;
+            {
+                std::scoped_lock aGuard(rVictim.maMutex);
+                const size_t nRemaining = rVictim.mnEnd - rVictim.mnBegin;
+                if (nRemaining == 0)
+                    continue;
+                // Leave the victim at least the chunk it may be about to take.
+                const size_t nTake = nRemaining <= mnChunkSize ? nRemaining : nRemaining / 2;
+                nEnd = rVictim.mnEnd;
+                nBegin = nEnd - nTake;
+                rVictim.mnEnd = nBegin;
+            }
+
+            Worker& rThief = maWorkers[nWorker];
+            std::scoped_lock aGuard(rThief.maMutex);
+            assert(rThief.mnBegin == rThief.mnEnd);
+            rThief.mnBegin = nBegin;
+            rThief.mnEnd = nEnd;
+            ++rThief.maStats.mnSteals;
+            return true;
+        }
+        return false;
+    }
+
+public:
+    /**
+     * @param nTotal number of cells to calculate.
+     * @param nWorkers number of worker threads.
+     * @param nChunkSize number of cells a worker takes at once, 0 to pick
+     *                   a size based on the amount of work per worker.
+     */
+    FormulaGroupWorkStealingScheduler(size_t nTotal, unsigned nWorkers, size_t nChunkSize = 0)
+        : maWorkers(std::max(nWorkers, 1u))
+        , mnTotal(nTotal)
+        , mnChunkSize(nChunkSize)
+    {
+        const size_t nCount = maWorkers.size();
+        if (mnChunkSize == 0)
+            mnChunkSize = std::clamp<size_t>(nTotal / (nCount * 16), 1, 64);
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            maWorkers[i].mnBegin = nTotal * i / nCount;
+            maWorkers[i].mnEnd = nTotal * (i + 1) / nCount;
+        }
+    }
+
+    FormulaGroupWorkStealingScheduler(const FormulaGroupWorkStealingScheduler&) = delete;
+    FormulaGroupWorkStealingScheduler& operator=(const FormulaGroupWorkStealingScheduler&) = delete;
+
+    /**
+     * Get the next chunk of cell indices [rBegin, rEnd) to calculate by
+     * worker nWorker, stealing from other workers if its own share is
+     * exhausted.
+     *
+     * @return false when there is no work left at all.
+     */
+    bool getNextChunk(unsigned nWorker, size_t& rBegin, size_t& rEnd)
+    {
+        assert(nWorker < maWorkers.size());
+        Worker& rWorker = maWorkers[nWorker];
+        do
+        {
+            std::scoped_lock aGuard(rWorker.maMutex);
+            if (rWorker.mnBegin < rWorker.mnEnd)
+            {
+                rBegin = rWorker.mnBegin;
+                rEnd = std::min(rBegin + mnChunkSize, rWorker.mnEnd);
+                rWorker.mnBegin = rEnd;
+                rWorker.maStats.mnCells += rEnd - rBegin;
+                ++rWorker.maStats.mnChunks;
+                return true;
+            }
+        } while (steal(nWorker));
+
+        return false;
+    }
+
+    /// To be called by the worker itself once it has finished.
+    void addBusyTime(unsigned nWorker, std::chrono::steady_clock::duration aTime)
+    {
+        Worker& rWorker = maWorkers[nWorker];
+        std::scoped_lock aGuard(rWorker.maMutex);
+        rWorker.maStats.maBusyTime += aTime;
+    }
+
+    unsigned getWorkerCount() const { return maWorkers.size(); }
+    size_t getChunkSize() const { return mnChunkSize; }
+
+    /// Only valid after all workers have finished.
+    const WorkerStats& getStats(unsigned nWorker) const { return maWorkers[nWorker].maStats; }
+
+    /**
+     * Ratio of the longest busy time of a worker to the average busy time
+     * of all workers.  1.0 means perfectly balanced.  Only valid after all
+     * workers have finished.
+     */
+    double getImbalance() const
+    {
+        double fMax = 0.0;
+        double fSum = 0.0;
+        for (const Worker& rWorker : maWorkers)
+        {
+            const double fTime = std::chrono::duration<double>(rWorker.maStats.maBusyTime).count();
+            fMax = std::max(fMax, fTime);
+            fSum += fTime;
+        }
+        if (fSum <= 0.0)
+            return 1.0;
+        return fMax / (fSum / maWorkers.size());
+    }
+
+    /// Human-readable summary for the formula logger and SAL_INFO.
+    std::string dumpStats() const
+    {
+        std::ostringstream aOut;
+        aOut << "work stealing: " << mnTotal << " cells, " << maWorkers.size()
+             << " workers, chunk size " << mnChunkSize << ", imbalance " << getImbalance();
+        for (size_t i = 0; i < maWorkers.size(); ++i)
+        {
+            const WorkerStats& rStats = maWorkers[i].maStats;
+            aOut << "; #" << i << ": " << rStats.mnCells << " cells, " << rStats.mnChunks
+                 << " chunks, " << rStats.mnSteals << " steals, "
+                 << std::chrono::duration_cast<std::chrono::microseconds>(rStats.maBusyTime).count()
+                 << "us";
+        }
+        return aOut.str();
+    }
+};
+
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -22,7 +22,6 @@ class FormulaToken;
 
 class ScDocument;
 class SvNumberFormatter;
-struct ScLookupCacheMap;
 class ScInterpreter;
 enum class SvNumFormatType : sal_Int16;
 
@@ -55,8 +54,10 @@ struct ScInterpreterContext
     const ScDocument* mpDoc;
     size_t mnTokenCachePos;
     std::vector<formula::FormulaToken*> maTokens;
+    // Same as maTokens, for the string results of ScInterpreter::PushString().
+    size_t mnStringTokenCachePos;
+    std::vector<formula::FormulaToken*> maStringTokens;
     std::vector<DelayedSetNumberFormat> maDelayedSetNumberFormat;
-    std::unique_ptr<ScLookupCacheMap> mxScLookupCache; // cache for lookups like VLOOKUP and MATCH
     // Allocation cache for "aConditions" array in ScInterpreter::IterateParameterIfs()
     // This is populated/used only when formula-group threading is enabled.
     std::vector<sal_uInt8> maConditions;
@@ -82,7 +83,6 @@ private:
     void ResetTokens();
     void SetDocAndFormatter(const ScDocument& rDoc, SvNumberFormatter* pFormatter);
     void Cleanup();
-    void ClearLookupCache(const ScDocument* pDoc);
     void initFormatTable();
     SvNumberFormatter* mpFormatter;
     mutable NFIndexAndFmtType maNFTypeCache;
@@ -132,10 +132,6 @@ class ScInterpreterContextPool
     // Cleans up the contexts prepared by call to immediately previous Init() and
     // marks them all as unused.
     void ReturnToPool();
-
-public:
-    // Only to be used to clear lookup cache in all pool elements
-    static void ClearLookupCaches(const ScDocument* pDoc);
 };
 
 class ScThreadedInterpreterContextGetterGuard
@@ -23,6 +23,7 @@
 #include <svl/listener.hxx>
 
 #include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 
 class ScDocument;
@@ -34,6 +35,9 @@ struct ScQueryEntry;
     up, in case other lookups of the same query in the same row are to be
     performed, which usually occur to obtain a different offset column of the
     same query.
+
+    The cache is shared by all interpreter threads, lookup() and insert() may
+    be called concurrently during threaded group calculation.
  */
 
 class ScLookupCache final : public SvtListener
@@ -190,6 +194,7 @@ private:
     };
 
     std::unordered_map< QueryKey, QueryCriteriaAndResult, QueryKey::Hash > maQueryMap;
+    mutable std::shared_mutex maMutex; // protects maQueryMap
     ScRange         maRange;
     ScDocument *    mpDoc;
     ScLookupCacheMap & mCacheMap;
@@ -23,9 +23,11 @@
 #include "queryentry.hxx"
 #include <o3tl/hash_combine.hxx>
 #include <svl/listener.hxx>
+#include <svl/sharedstring.hxx>
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 class ScDocument;
 struct ScInterpreterContext;
@@ -39,6 +41,10 @@ struct ScSortedRangeCacheMap;
     The class has a vector of SCROW items, which is sorted according to values
     of those cells. Therefore e.g. binary search of those cells can be done
     by doing binary search of the vector while mapping the indexes to rows.
+
+    Caches for SC_EQUAL additionally have a hash index of the cell values,
+    so that exact-match lookups do not need to search at all, see
+    findFirstEqualRow().
  */
 
 class ScSortedRangeCache final : public SvtListener
@@ -100,7 +106,31 @@ public:
     }
     SCROW rowForIndex(size_t index) const { return mSortedRows[index]; }
 
+    /** Returns whether findFirstEqualRow() can be used for the query item.
+        The cache must be for SC_EQUAL and strings must be interned in the
+        document string pool, as they are compared by identity. */
+    bool canFindEqual(const ScQueryEntry::Item& item) const;
+    /** Returns the first row of the range matching the item the way
+        ScQueryEvaluator does for SC_EQUAL, or -1 if there is none. */
+    SCROW findFirstEqualRow(const ScQueryEntry::Item& item) const;
+
 private:
+    struct ValueEntry
+    {
+        double value;
+        SCROW row;
+    };
+    // Hash index for SC_EQUAL, values are grouped by bucketForValue(),
+    // in row order inside a bucket.
+    std::vector<ValueEntry> mValueEntries;
+    std::unordered_map<sal_uInt64, std::pair<sal_uInt32, sal_uInt32>> mValueBuckets;
+    // Hash index for SC_EQUAL, first row for each (case-folded) string.
+    std::unordered_map<const rtl_uString*, SCROW> mStringRows;
+    std::vector<svl::SharedString> mStrings; // keep the keys of mStringRows alive
+
+    static sal_uInt64 bucketForValue(double value);
+    void buildValueIndex();
+
     // Rows sorted by their value.
     std::vector<SCROW> mSortedRows;
     std::vector<size_t> mRowToIndex; // indexed by 'SCROW - maRange.aStart.Row()'
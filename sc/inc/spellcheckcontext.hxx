@@ -55,6 +55,7 @@ public:
 
 private:
     void ensureResults(SCCOL nCol, SCROW nRow);
+    LanguageType getCellLanguage(SCCOL nCol, SCROW nRow) const;
     void resetCache(bool bContentChangeOnly = false);
     void setup();
 };
@@ -80,6 +80,7 @@ class RowHeightContext;
 class CompileFormulaContext;
 struct SetFormulaDirtyContext;
 class ColumnIterator;
+class FormulaGroupWorkStealingScheduler;
 class ScDrawObjData;
 }
 
@@ -673,6 +674,7 @@ public:
     void        SetDirtyVar();
     void        SetTableOpDirty( const ScRange& );
     void        CalcAll();
+    void        CollectReferencedTabs( std::set<SCTAB>& rTabs, bool& rUnknown ) const;
     void CalcAfterLoad( sc::CompileFormulaContext& rCxt, bool bStartListening );
     void CompileAll( sc::CompileFormulaContext& rCxt );
     void CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress );
@@ -748,6 +750,7 @@ public:
     sal_uInt32 GetNumberFormat( const ScInterpreterContext& rContext, const ScAddress& rPos ) const;
     sal_uInt32 GetNumberFormat( SCCOL nCol, SCROW nRow ) const;
     sal_uInt32 GetNumberFormat( SCCOL nCol, SCROW nStartRow, SCROW nEndRow ) const;
+    bool HasOnlyGeneralNumberFormat( SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2 ) const;
 
     void SetNumberFormat( SCCOL nCol, SCROW nRow, sal_uInt32 nNumberFormat );
 
@@ -1078,6 +1081,9 @@ public:
 
     void CalculateInColumnInThread( ScInterpreterContext& rContext, SCCOL nColStart, SCCOL nColEnd,
                                     SCROW nRowStart, SCROW nRowEnd, unsigned nThisThread, unsigned nThreadsTotal);
+    void CalculateInColumnInThread( ScInterpreterContext& rContext, SCCOL nColStart, SCCOL nColEnd,
+                                    SCROW nRowStart, SCROW nRowEnd, unsigned nThisThread,
+                                    sc::FormulaGroupWorkStealingScheduler& rScheduler );
     void HandleStuffAfterParallelCalculation( SCCOL nColStart, SCCOL nColEnd, SCROW nRow, size_t nLen, ScInterpreter* pInterpreter);
 
     /**
@@ -1235,18 +1241,19 @@ private:
 
                                 // use the global sort parameter:
     bool        IsSorted(SCCOLROW nStart, SCCOLROW nEnd) const;
-    static void DecoladeRow( ScSortInfoArray*, SCROW nRow1, SCROW nRow2 );
     short CompareCell(
         sal_uInt16 nSort,
         ScRefCellValue& rCell1, SCCOL nCell1Col, SCROW nCell1Row,
         ScRefCellValue& rCell2, SCCOL nCell2Col, SCROW nCell2Row ) const;
+    short       CompareCellStrings( const OUString& rStr1, const OUString& rStr2 ) const;
     short       Compare(SCCOLROW nIndex1, SCCOLROW nIndex2) const;
-    short       Compare( ScSortInfoArray*, SCCOLROW nIndex1, SCCOLROW nIndex2) const;
     std::unique_ptr<ScSortInfoArray> CreateSortInfoArray( const sc::ReorderParam& rParam );
     std::unique_ptr<ScSortInfoArray> CreateSortInfoArray(
         const ScSortParam& rSortParam, SCCOLROW nInd1, SCCOLROW nInd2,
         bool bKeepQuery, bool bUpdateRefs );
-    void        QuickSort( ScSortInfoArray*, SCCOLROW nLo, SCCOLROW nHi);
+    /** Sort the whole array according to aSortParam, resolving the sort
+        keys of all cells once beforehand. */
+    void        SortByKeys( ScSortInfoArray* pArray );
     void        SortReorderByColumn( const ScSortInfoArray* pArray, SCROW nRow1, SCROW nRow2,
                                      bool bPattern, ScProgress* pProgress );
     void        SortReorderAreaExtrasByColumn( const ScSortInfoArray* pArray, SCROW nDataRow1, SCROW nDataRow2,
@@ -1259,6 +1266,13 @@ private:
     void        SortReorderAreaExtrasByRow( ScSortInfoArray* pArray, SCCOL nDataCol1, SCCOL nDataCol2,
                                             const ScDataAreaExtras& rDataAreaExtras, ScProgress* pProgress );
 
+    /** Evaluate rParam for rows nRow1..nRow2 in blocks on the shared thread
+        pool, storing one result per row in rResults.  Returns false without
+        evaluating anything if the range is too small or the cells cannot be
+        read from worker threads. */
+    bool        ValidQueryThreaded( const ScQueryParam& rParam, SCROW nRow1, SCROW nRow2,
+                                    std::vector<sal_uInt8>& rResults );
+
     bool        CreateExcelQuery(SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2, ScQueryParam& rQueryParam);
     bool        CreateStarQuery(SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2, ScQueryParam& rQueryParam);
     OUString    GetUpperCellString(SCCOL nCol, SCROW nRow);
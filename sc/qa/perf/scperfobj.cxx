@@ -10,6 +10,7 @@
 #include <sal/config.h>
 
 #include <string_view>
+#include <utility>
 
 #include <test/unoapi_test.hxx>
 
@@ -76,6 +77,7 @@ public:
     CPPUNIT_TEST(testLoadingFileWithSingleBigSheet);
     CPPUNIT_TEST(testMatConcatSmall);
     CPPUNIT_TEST(testMatConcatLarge);
+    CPPUNIT_TEST(testLookups);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -97,6 +99,7 @@ private:
     void testFixedSum();
     void testMatConcatSmall();
     void testMatConcatLarge();
+    void testLookups();
 };
 
 ScPerfObj::ScPerfObj()
@@ -612,6 +615,39 @@ void ScPerfObj::testMatConcatLarge()
     callgrindDump("sc:mat_concat");
 }
 
+void ScPerfObj::testLookups()
+{
+    loadFromURL(u"empty.ods");
+    uno::Reference< sheet::XSpreadsheetDocument > xDoc(mxComponent, UNO_QUERY_THROW);
+
+    uno::Reference< sheet::XCalculatable > xCalculatable(xDoc, UNO_QUERY_THROW);
+
+    uno::Reference< sheet::XSpreadsheets > xSheets (xDoc->getSheets(), UNO_SET_THROW);
+    uno::Reference< sheet::XSpreadsheet > xSheet (xSheets->getByName("Sheet1"), UNO_QUERY);
+
+    setupBlockFormula(xDoc, "Sheet1", "A1:A1000", "=ROW()*3");
+    setupBlockFormula(xDoc, "Sheet1", "B1:B1000", "=ROW()");
+
+    // The same lookups done by the different functions, so that their
+    // costs can be compared.
+    const std::pair<const char*, OUString> aLookups[] = {
+        { "sc:lookup_vlookup", "=VLOOKUP(ROW()*3;$A$1:$B$1000;2;0)" },
+        { "sc:lookup_index_match", "=INDEX($B$1:$B$1000;MATCH(ROW()*3;$A$1:$A$1000;0))" },
+        { "sc:lookup_lookup", "=LOOKUP(ROW()*3;$A$1:$A$1000;$B$1:$B$1000)" },
+    };
+    for (const auto& [pName, aFormula] : aLookups)
+    {
+        setupBlockFormula(xDoc, "Sheet1", "C1:C1000", aFormula);
+
+        callgrindStart();
+        xCalculatable->calculateAll();
+        callgrindDump(pName);
+
+        uno::Reference< table::XCell > xCell = xSheet->getCellByPosition(2, 999);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(pName, 1000.0, xCell->getValue());
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(ScPerfObj);
 
 }
@@ -48,6 +48,7 @@
 #include <hints.hxx>
 #include <detfunc.hxx>
 #include <scerrors.hxx>
+#include <calcconfig.hxx>
 
 #include <com/sun/star/drawing/XDrawPageSupplier.hpp>
 #include <com/sun/star/drawing/XControlShape.hpp>
@@ -60,6 +61,7 @@
 #include <tools/UnitConversion.hxx>
 #include <unotools/syslocaleoptions.hxx>
 #include "helper/qahelper.hxx"
+#include <officecfg/Office/Calc.hxx>
 #include <officecfg/Office/Common.hxx>
 
 using namespace ::com::sun::star;
@@ -2838,6 +2840,29 @@ CPPUNIT_TEST_FIXTURE(ScFiltersTest2, testTdf151818_SmartArtFontColor)
     }
 }
 
+CPPUNIT_TEST_FIXTURE(ScFiltersTest2, testRecalcAlwaysOnLoadStaleCachedResult)
+{
+    const sal_Int32 nOldRecalcMode
+        = officecfg::Office::Calc::Formula::Load::ODFRecalcMode::get();
+    comphelper::ScopeGuard g([nOldRecalcMode]() {
+        std::shared_ptr<comphelper::ConfigurationChanges> pBatch(
+            comphelper::ConfigurationChanges::create());
+        officecfg::Office::Calc::Formula::Load::ODFRecalcMode::set(nOldRecalcMode, pBatch);
+        pBatch->commit();
+    });
+    std::shared_ptr<comphelper::ConfigurationChanges> pBatch(
+        comphelper::ConfigurationChanges::create());
+    officecfg::Office::Calc::Formula::Load::ODFRecalcMode::set(sal_Int32(RECALC_ALWAYS), pBatch);
+    pBatch->commit();
+
+    // A3 is =A1+A2 with a cached result of 42. The hard recalc after load
+    // only marks the formula cells dirty, so the correct result must be
+    // calculated when the cell is accessed.
+    createScDoc("ods/stale-cached-formula-result.ods");
+    ScDocument* pDoc = getScDoc();
+    CPPUNIT_ASSERT_EQUAL(3.0, pDoc->GetValue(ScAddress(0, 2, 0)));
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -370,6 +370,33 @@ CPPUNIT_TEST_FIXTURE(Test, testInput)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(Test, testInputPlainNumbers)
+{
+    m_pDoc->InsertTab(0, "Test");
+
+    // Plain numbers take the shortcut past the number scanner, the result
+    // must be the same as if they had been scanned.
+    m_pDoc->SetString(ScAddress(0,0,0), "42");
+    m_pDoc->SetString(ScAddress(0,1,0), "-12.5");
+    m_pDoc->SetString(ScAddress(0,2,0), "007");
+    m_pDoc->SetString(ScAddress(0,3,0), "0.125");
+    m_pDoc->SetString(ScAddress(0,4,0), "1,234");
+    m_pDoc->SetString(ScAddress(0,5,0), "1e3");
+    m_pDoc->SetString(ScAddress(0,6,0), "12.");
+    m_pDoc->SetString(ScAddress(0,7,0), "1.2.3");
+
+    CPPUNIT_ASSERT_EQUAL(42.0, m_pDoc->GetValue(ScAddress(0,0,0)));
+    CPPUNIT_ASSERT_EQUAL(-12.5, m_pDoc->GetValue(ScAddress(0,1,0)));
+    CPPUNIT_ASSERT_EQUAL(7.0, m_pDoc->GetValue(ScAddress(0,2,0)));
+    CPPUNIT_ASSERT_EQUAL(0.125, m_pDoc->GetValue(ScAddress(0,3,0)));
+    CPPUNIT_ASSERT_EQUAL(1234.0, m_pDoc->GetValue(ScAddress(0,4,0)));
+    CPPUNIT_ASSERT_EQUAL(1000.0, m_pDoc->GetValue(ScAddress(0,5,0)));
+    CPPUNIT_ASSERT_EQUAL(12.0, m_pDoc->GetValue(ScAddress(0,6,0)));
+    CPPUNIT_ASSERT_EQUAL(CELLTYPE_STRING, m_pDoc->GetCellType(ScAddress(0,7,0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(Test, testColumnIterator) // tdf#118620
 {
     CPPUNIT_ASSERT_MESSAGE ("failed to insert sheet",
@@ -6718,6 +6745,37 @@ CPPUNIT_TEST_FIXTURE(Test, testInsertColumnsWithFormulaCells)
 }
 
 
+CPPUNIT_TEST_FIXTURE(Test, testCalcAllTabOrder)
+{
+    m_pDoc->InsertTab(0, "Sheet1");
+    m_pDoc->InsertTab(1, "Sheet2");
+    m_pDoc->InsertTab(2, "Sheet3");
+
+    // Sheet1 uses Sheet3, which uses Sheet2.
+    m_pDoc->SetValue(ScAddress(0,0,1), 2.0);
+    m_pDoc->SetString(ScAddress(0,0,2), "=$Sheet2.A1*2");
+    m_pDoc->SetString(ScAddress(0,0,0), "=$Sheet3.A1+1");
+
+    std::vector<SCTAB> aExpected = { 1, 2, 0 };
+    CPPUNIT_ASSERT(bool(aExpected == m_pDoc->GetCalcAllTabOrder()));
+
+    m_pDoc->CalcAll();
+    CPPUNIT_ASSERT_EQUAL(5.0, m_pDoc->GetValue(ScAddress(0,0,0)));
+
+    // A circular dependency between sheets falls back to document order.
+    m_pDoc->SetString(ScAddress(1,0,1), "=$Sheet1.A1");
+    aExpected = { 0, 1, 2 };
+    CPPUNIT_ASSERT(bool(aExpected == m_pDoc->GetCalcAllTabOrder()));
+
+    // So does a reference that can't be determined without calculating.
+    m_pDoc->SetString(ScAddress(1,0,1), "=INDIRECT(\"Sheet3.A1\")");
+    CPPUNIT_ASSERT(bool(aExpected == m_pDoc->GetCalcAllTabOrder()));
+
+    m_pDoc->DeleteTab(2);
+    m_pDoc->DeleteTab(1);
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -588,6 +588,40 @@ CPPUNIT_TEST_FIXTURE(TestCondformat, testIconSet)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestCondformat, testColorScaleCachedValues)
+{
+    m_pDoc->InsertTab(0, "Test");
+    ScConditionalFormatList* pList = m_pDoc->GetCondFormList(0);
+
+    m_pDoc->SetValue(0, 0, 0, 0.0);
+    m_pDoc->SetValue(0, 1, 0, 5.0);
+    m_pDoc->SetValue(0, 2, 0, 10.0);
+
+    auto pFormat = std::make_unique<ScConditionalFormat>(1, m_pDoc);
+    pFormat->SetRange(ScRangeList(ScRange(0,0,0,0,2,0)));
+
+    ScColorScaleFormat* pEntry = new ScColorScaleFormat(m_pDoc);
+    pEntry->AddEntry(new ScColorScaleEntry(0, Color(0, 0, 0), COLORSCALE_MIN));
+    pEntry->AddEntry(new ScColorScaleEntry(0, Color(200, 200, 200), COLORSCALE_MAX));
+    pFormat->AddEntry(pEntry);
+
+    m_pDoc->AddCondFormatData(pFormat->GetRange(), 0, 1);
+    pList->InsertNew(std::move(pFormat));
+
+    std::optional<Color> oColor = pEntry->GetColor(ScAddress(0,1,0));
+    CPPUNIT_ASSERT(oColor);
+    CPPUNIT_ASSERT_EQUAL(Color(100, 100, 100), *oColor);
+
+    // The cached min/max values are kept between paints but have to follow
+    // changes of the cells in the range.
+    m_pDoc->SetValue(0, 2, 0, 20.0);
+    oColor = pEntry->GetColor(ScAddress(0,1,0));
+    CPPUNIT_ASSERT(oColor);
+    CPPUNIT_ASSERT_EQUAL(Color(50, 50, 50), *oColor);
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestCondformat, testDataBarLengthAutomaticAxis)
 {
     m_pDoc->InsertTab(0, "Test");
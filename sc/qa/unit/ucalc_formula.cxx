@@ -4876,6 +4876,37 @@ CPPUNIT_TEST_FIXTURE(TestFormula, testFuncSUMPRODUCT)
     m_pDoc->SetString(ScAddress(5,2,0), "=SUMPRODUCT(ABS(E1:E2);E1:E2+E1:E2)");
     CPPUNIT_ASSERT_EQUAL(14.0, m_pDoc->GetValue(ScAddress(5,2,0)));
 
+    // Longer arrays go through the vectorized multiply and sum, with an odd
+    // length to also cover the remainder.  Sum of i*2 for i=1..101 is 10302.
+    for (SCROW i = 0; i < 101; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(6,i,0), i + 1.0); // G
+        m_pDoc->SetValue(ScAddress(7,i,0), 2.0);     // H
+    }
+    m_pDoc->SetString(ScAddress(8,0,0), "=SUMPRODUCT(G1:G101;H1:H101)");
+    CPPUNIT_ASSERT_EQUAL(10302.0, m_pDoc->GetValue(ScAddress(8,0,0)));
+
+    // A text cell is ElementNaN and is ignored, an error propagates.
+    m_pDoc->SetString(ScAddress(7,50,0), "text");
+    CPPUNIT_ASSERT_EQUAL(10200.0, m_pDoc->GetValue(ScAddress(8,0,0)));
+    m_pDoc->SetString(ScAddress(7,60,0), "=1/0");
+    CPPUNIT_ASSERT_EQUAL(FormulaError::DivisionByZero, m_pDoc->GetErrCode(ScAddress(8,0,0)));
+
+    // Whole column references are cut to the rows with data, J has its last
+    // value further down than K.
+    m_pDoc->SetValue(ScAddress(9,0,0), 2.0);   // J1
+    m_pDoc->SetValue(ScAddress(9,999,0), 4.0); // J1000
+    m_pDoc->SetValue(ScAddress(10,0,0), 3.0);  // K1
+    m_pDoc->SetString(ScAddress(11,0,0), "=SUMPRODUCT(J:J;K:K)");
+    CPPUNIT_ASSERT_EQUAL(6.0, m_pDoc->GetValue(ScAddress(11,0,0)));
+    m_pDoc->SetValue(ScAddress(10,999,0), 5.0); // K1000
+    CPPUNIT_ASSERT_EQUAL(26.0, m_pDoc->GetValue(ScAddress(11,0,0)));
+
+    // Ranges of different height still are an error even if the rows with
+    // data would match.
+    m_pDoc->SetString(ScAddress(11,1,0), "=SUMPRODUCT(J1:J2000;K1:K3000)");
+    CPPUNIT_ASSERT_EQUAL(FormulaError::NoValue, m_pDoc->GetErrCode(ScAddress(11,1,0)));
+
     m_pDoc->DeleteTab(0);
 }
 
@@ -4955,6 +4986,12 @@ CPPUNIT_TEST_FIXTURE(TestFormula, testFuncMIN)
     m_pDoc->SetString(ScAddress(2,4,0), "=MIN(B1:B4)");
     CPPUNIT_ASSERT_EQUAL(-20.0, m_pDoc->GetValue(ScAddress(2,4,0)));
 
+    // Longer inline arrays are handled by the vectorized kernels.
+    m_pDoc->SetString(ScAddress(0,5,0), "=MIN({5;3;9;-1;7;4;8;6;2})");
+    CPPUNIT_ASSERT_EQUAL(-1.0, m_pDoc->GetValue(ScAddress(0,5,0)));
+    m_pDoc->SetString(ScAddress(0,6,0), "=MAX({5;3;9;-1;7;4;8;6;2})");
+    CPPUNIT_ASSERT_EQUAL(9.0, m_pDoc->GetValue(ScAddress(0,6,0)));
+
     m_pDoc->DeleteTab(0);
 }
 
@@ -5957,6 +5994,41 @@ CPPUNIT_TEST_FIXTURE(TestFormula, testFuncMATCH)
         CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(0,5,0)));
     }
 
+    {
+        // Exact match with duplicates, approximately equal values and
+        // case-insensitive strings.
+
+        clearRange(m_pDoc, ScRange(0,0,0,1,19,0));
+
+        // A1:A15 contain 0, 10, 20, 30, 40 three times.
+        for (SCROW i = 0; i < 15; ++i)
+            m_pDoc->SetValue(ScAddress(0,i,0), (i % 5) * 10.0);
+        m_pDoc->SetString(ScAddress(0,15,0), "=0.1+0.2");
+        m_pDoc->SetString(ScAddress(0,16,0), "abc");
+        m_pDoc->SetString(ScAddress(0,17,0), "ABC");
+        m_pDoc->SetString(ScAddress(0,18,0), "Def");
+
+        m_pDoc->SetString(ScAddress(1,0,0), "=MATCH(0;$A$1:$A$20;0)");
+        m_pDoc->SetString(ScAddress(1,1,0), "=MATCH(30;$A$1:$A$20;0)");
+        m_pDoc->SetString(ScAddress(1,2,0), "=MATCH(25;$A$1:$A$20;0)");
+        m_pDoc->SetString(ScAddress(1,3,0), "=MATCH(0.3;$A$1:$A$20;0)");
+        m_pDoc->SetString(ScAddress(1,4,0), "=MATCH(\"ABC\";$A$1:$A$20;0)");
+        m_pDoc->SetString(ScAddress(1,5,0), "=MATCH(\"def\";$A$1:$A$20;0)");
+        m_pDoc->CalcAll();
+
+        CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(1,0,0)));
+        CPPUNIT_ASSERT_EQUAL(4.0, m_pDoc->GetValue(ScAddress(1,1,0)));
+        CPPUNIT_ASSERT_EQUAL(OUString("#N/A"), m_pDoc->GetString(ScAddress(1,2,0)));
+        CPPUNIT_ASSERT_EQUAL(16.0, m_pDoc->GetValue(ScAddress(1,3,0)));
+        CPPUNIT_ASSERT_EQUAL(17.0, m_pDoc->GetValue(ScAddress(1,4,0)));
+        CPPUNIT_ASSERT_EQUAL(19.0, m_pDoc->GetValue(ScAddress(1,5,0)));
+
+        // Changing the data must not use stale results.
+        m_pDoc->SetValue(ScAddress(0,3,0), 35.0);
+        m_pDoc->CalcAll();
+        CPPUNIT_ASSERT_EQUAL(9.0, m_pDoc->GetValue(ScAddress(1,1,0)));
+    }
+
     m_pDoc->DeleteTab(0);
 }
 
@@ -6360,6 +6432,47 @@ CPPUNIT_TEST_FIXTURE(TestFormula, testFormulaDepTracking2)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestFormula, testFormulaDepTrackingTallArea)
+{
+    CPPUNIT_ASSERT_MESSAGE ("failed to insert sheet", m_pDoc->InsertTab (0, "foo"));
+
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn on auto calculation.
+
+    // Whole column and other tall ranges are listened to in separate
+    // broadcast area slots.
+    m_pDoc->SetString(ScAddress(1,0,0), "=SUM(A:A)");
+    m_pDoc->SetString(ScAddress(2,0,0), "=SUM(A2:A50000)");
+    m_pDoc->SetString(ScAddress(3,0,0), "=SUM(A2:A5)");
+
+    m_pDoc->SetValue(ScAddress(0,2,0), 1.0);
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(1,0,0)));
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(2,0,0)));
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(3,0,0)));
+
+    m_pDoc->SetValue(ScAddress(0,39999,0), 2.0);
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(1,0,0)));
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(2,0,0)));
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(3,0,0)));
+
+    // Insert 10000 rows above A4, A2:A5 grows to A2:A10005 and becomes tall.
+    m_pDoc->InsertRow(ScRange(0,3,0,m_pDoc->MaxCol(),10002,0));
+    CPPUNIT_ASSERT_EQUAL(OUString("=SUM(A2:A60000)"), m_pDoc->GetFormula(2,0,0));
+    CPPUNIT_ASSERT_EQUAL(OUString("=SUM(A2:A10005)"), m_pDoc->GetFormula(3,0,0));
+
+    m_pDoc->SetValue(ScAddress(0,4999,0), 4.0);
+    CPPUNIT_ASSERT_EQUAL(7.0, m_pDoc->GetValue(ScAddress(1,0,0)));
+    CPPUNIT_ASSERT_EQUAL(7.0, m_pDoc->GetValue(ScAddress(2,0,0)));
+    CPPUNIT_ASSERT_EQUAL(5.0, m_pDoc->GetValue(ScAddress(3,0,0)));
+
+    // The moved value is still listened to at its new position.
+    m_pDoc->SetValue(ScAddress(0,49999,0), 8.0);
+    CPPUNIT_ASSERT_EQUAL(13.0, m_pDoc->GetValue(ScAddress(1,0,0)));
+    CPPUNIT_ASSERT_EQUAL(13.0, m_pDoc->GetValue(ScAddress(2,0,0)));
+    CPPUNIT_ASSERT_EQUAL(5.0, m_pDoc->GetValue(ScAddress(3,0,0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestFormula, testFormulaDepTracking3)
 {
     sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn on auto calculation.
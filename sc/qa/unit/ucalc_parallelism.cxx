@@ -14,10 +14,18 @@
 #include <undoblk.hxx>
 #include <formulacell.hxx>
 #include <formulagroup.hxx>
+#include <formulagroupprofiler.hxx>
+#include <formulagroupscheduler.hxx>
 #include <scopetools.hxx>
+#include <dbdata.hxx>
+#include <queryentry.hxx>
+#include <queryparam.hxx>
 
+#include <formula/errorcodes.hxx>
 #include <officecfg/Office/Calc.hxx>
 
+#include <cmath>
+
 using namespace css;
 using namespace css::uno;
 
@@ -953,6 +961,174 @@ CPPUNIT_TEST_FIXTURE(ScParallelismTest, testFormulaGroupsInCyclesAndWithSelfRefe
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(ScParallelismTest, testWorkStealingScheduler)
+{
+    // Only worker 0 takes any work, so it has to steal everything the other
+    // workers were given initially, and every cell must be handed out once.
+    const size_t nTotal = 1003;
+    sc::FormulaGroupWorkStealingScheduler aScheduler(nTotal, 4, 8);
+    std::vector<int> aSeen(nTotal, 0);
+    size_t nBegin, nEnd;
+    while (aScheduler.getNextChunk(0, nBegin, nEnd))
+    {
+        CPPUNIT_ASSERT(nBegin < nEnd);
+        CPPUNIT_ASSERT(nEnd <= nTotal);
+        CPPUNIT_ASSERT(nEnd - nBegin <= 8);
+        for (size_t i = nBegin; i < nEnd; ++i)
+            ++aSeen[i];
+    }
+
+    for (size_t i = 0; i < nTotal; ++i)
+        CPPUNIT_ASSERT_EQUAL(1, aSeen[i]);
+
+    CPPUNIT_ASSERT_EQUAL(nTotal, aScheduler.getStats(0).mnCells);
+    CPPUNIT_ASSERT(aScheduler.getStats(0).mnSteals >= 3);
+    for (unsigned i = 1; i < 4; ++i)
+        CPPUNIT_ASSERT_EQUAL(size_t(0), aScheduler.getStats(i).mnCells);
+
+    // Nothing left for the other workers either.
+    CPPUNIT_ASSERT(!aScheduler.getNextChunk(2, nBegin, nEnd));
+}
+
+CPPUNIT_TEST_FIXTURE(ScParallelismTest, testFormulaGroupCPU)
+{
+    // Formula groups made up of plain arithmetic and aggregates over General
+    // formatted numbers are calculated by the CPU vector code, make sure the
+    // results are the same as those of the interpreter.
+    m_pDoc->InsertTab(0, "1");
+
+    const SCROW nRows = 200;
+    for (SCROW i = 1; i <= nRows; ++i)
+    {
+        m_pDoc->SetValue(0, i, 0, i % 5);
+        if (i % 11)
+            m_pDoc->SetValue(1, i, 0, i % 3);
+
+        const OUString aRow = OUString::number(i + 1);
+        m_pDoc->SetFormula(ScAddress(2, i, 0), "=A" + aRow + "+B" + aRow + "*2",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(3, i, 0), "=A" + aRow + "/B" + aRow,
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(4, i, 0), "=SUM(A$2:A" + aRow + ")",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(5, i, 0), "=AVERAGE(A" + aRow + ":B" + aRow + ")",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(6, i, 0), "=MAX(A" + aRow + ":B" + aRow + ")-MIN(A" + aRow + ":B" + aRow + ")",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(7, i, 0), "=COUNT(A" + aRow + ":B" + aRow + ";1/0)",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+        m_pDoc->SetFormula(ScAddress(8, i, 0), "=(A" + aRow + ">B" + aRow + ")*3",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+    }
+
+    m_xDocShell->DoHardRecalc();
+
+    double fSum = 0.0;
+    for (SCROW i = 1; i <= nRows; ++i)
+    {
+        const double fA = i % 5;
+        const bool bHasB = i % 11;
+        const double fB = bHasB ? i % 3 : 0.0;
+        fSum += fA;
+
+        CPPUNIT_ASSERT_EQUAL(fA + fB * 2, m_pDoc->GetValue(2, i, 0));
+
+        ScFormulaCell* pDiv = m_pDoc->GetFormulaCell(ScAddress(3, i, 0));
+        CPPUNIT_ASSERT(pDiv);
+        if (fB == 0.0)
+            CPPUNIT_ASSERT_EQUAL(int(FormulaError::DivisionByZero), static_cast<int>(pDiv->GetErrCode()));
+        else
+            CPPUNIT_ASSERT_EQUAL(fA / fB, m_pDoc->GetValue(3, i, 0));
+
+        CPPUNIT_ASSERT_EQUAL(fSum, m_pDoc->GetValue(4, i, 0));
+        CPPUNIT_ASSERT_EQUAL(bHasB ? (fA + fB) / 2 : fA, m_pDoc->GetValue(5, i, 0));
+        CPPUNIT_ASSERT_EQUAL(bHasB ? std::abs(fA - fB) : 0.0, m_pDoc->GetValue(6, i, 0));
+        CPPUNIT_ASSERT_EQUAL(bHasB ? 2.0 : 1.0, m_pDoc->GetValue(7, i, 0));
+        CPPUNIT_ASSERT_EQUAL(fA > fB ? 3.0 : 0.0, m_pDoc->GetValue(8, i, 0));
+    }
+
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(ScParallelismTest, testFormulaGroupProfiler)
+{
+    m_pDoc->InsertTab(0, "1");
+
+    sc::FormulaGroupProfiler& rProfiler = m_pDoc->GetFormulaGroupProfiler();
+    CPPUNIT_ASSERT(!rProfiler.isEnabled());
+    rProfiler.setEnabled(true);
+
+    const SCROW nRows = 200;
+    for (SCROW i = 1; i <= nRows; ++i)
+    {
+        m_pDoc->SetValue(0, i, 0, -i);
+        // ABS() is not done by the CPU vector code, so this is threaded.
+        m_pDoc->SetFormula(ScAddress(1, i, 0), "=ABS(A" + OUString::number(i + 1) + ")",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+    }
+
+    m_xDocShell->DoHardRecalc();
+    CPPUNIT_ASSERT_EQUAL(200.0, m_pDoc->GetValue(1, nRows, 0));
+
+    std::vector<const sc::FormulaGroupProfiler::Entry*> aEntries = rProfiler.getTopEntries(10);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), aEntries.size());
+    CPPUNIT_ASSERT_EQUAL(ScAddress(1, 1, 0), aEntries[0]->maTopPos);
+    CPPUNIT_ASSERT_EQUAL(nRows, aEntries[0]->mnLength);
+    CPPUNIT_ASSERT_EQUAL(int(sc::FormulaGroupCalcPath::Threaded), int(aEntries[0]->mePath));
+    CPPUNIT_ASSERT_EQUAL(size_t(0), aEntries[0]->mnFallbacks);
+
+    rProfiler.reset();
+    rProfiler.setEnabled(false);
+    m_xDocShell->DoHardRecalc();
+    CPPUNIT_ASSERT(rProfiler.getTopEntries(10).empty());
+
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(ScParallelismTest, testAutoFilterThreaded)
+{
+    m_pDoc->InsertTab(0, "1");
+
+    // Large enough for the query to be evaluated on several threads.
+    const SCROW nRows = 40000;
+    m_pDoc->SetString(0, 0, 0, "Value");
+    m_pDoc->SetString(1, 0, 0, "Double");
+    for (SCROW i = 1; i <= nRows; ++i)
+    {
+        m_pDoc->SetValue(0, i, 0, i % 3);
+        // Formula cells that are still dirty when the filter is applied.
+        m_pDoc->SetFormula(ScAddress(1, i, 0), "=A" + OUString::number(i + 1) + "*2",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+    }
+
+    ScDBData* pDBData = new ScDBData("NONAME", 0, 0, 0, 1, nRows);
+    m_pDoc->SetAnonymousDBData(0, std::unique_ptr<ScDBData>(pDBData));
+    pDBData->SetAutoFilter(true);
+
+    ScQueryParam aParam;
+    pDBData->GetQueryParam(aParam);
+    ScQueryEntry& rEntry = aParam.GetEntry(0);
+    rEntry.bDoQuery = true;
+    rEntry.nField = 1;
+    rEntry.eOp = SC_EQUAL;
+    rEntry.GetQueryItem().mfVal = 2;
+    pDBData->SetQueryParam(aParam);
+
+    SCSIZE nCount = m_pDoc->Query(0, aParam, true);
+    CPPUNIT_ASSERT_EQUAL(SCSIZE(nRows / 3 + 1), nCount);
+
+    for (SCROW i = 1; i <= nRows; ++i)
+    {
+        if (m_pDoc->RowHidden(i, 0) != (i % 3 != 1))
+        {
+            CPPUNIT_FAIL(OString("wrong visibility of row " + OString::number(i)).getStr());
+        }
+    }
+    CPPUNIT_ASSERT(!m_pDoc->RowHidden(0, 0));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
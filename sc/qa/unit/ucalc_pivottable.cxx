@@ -994,6 +994,45 @@ CPPUNIT_TEST_FIXTURE(TestPivottable, testPivotTableCache)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestPivottable, testPivotTableCacheLarge)
+{
+    // Enough source cells for the fields to be built on several threads.
+    m_pDoc->InsertTab(0, "Data");
+
+    const SCROW nRows = 30000;
+    m_pDoc->SetString(0, 0, 0, "Name");
+    m_pDoc->SetString(1, 0, 0, "Value");
+    m_pDoc->SetString(2, 0, 0, "Formula");
+    for (SCROW i = 1; i <= nRows; ++i)
+    {
+        m_pDoc->SetString(0, i, 0, "N" + OUString::number(i % 7));
+        m_pDoc->SetValue(1, i, 0, i % 100);
+        m_pDoc->SetFormula(ScAddress(2, i, 0), "=B" + OUString::number(i + 1) + "*2",
+                           formula::FormulaGrammar::GRAM_NATIVE_UI);
+    }
+
+    ScDPCache aCache(*m_pDoc);
+    aCache.InitFromDoc(*m_pDoc, ScRange(0, 0, 0, 2, nRows, 0));
+    CPPUNIT_ASSERT_EQUAL(tools::Long(3), aCache.GetColumnCount());
+    CPPUNIT_ASSERT_EQUAL(OUString("Formula"), aCache.GetDimensionName(2));
+    CPPUNIT_ASSERT_EQUAL(tools::Long(7), aCache.GetDimMemberCount(0));
+    CPPUNIT_ASSERT_EQUAL(tools::Long(100), aCache.GetDimMemberCount(1));
+    CPPUNIT_ASSERT_EQUAL(tools::Long(100), aCache.GetDimMemberCount(2));
+
+    // The member ids of every row point to the value of that row.
+    for (SCROW i = 0; i < nRows; ++i)
+    {
+        const ScDPItemData* pItem = aCache.GetItemDataById(1, aCache.GetItemDataId(1, i, false));
+        CPPUNIT_ASSERT(pItem);
+        CPPUNIT_ASSERT_EQUAL(double((i + 1) % 100), pItem->GetValue());
+        pItem = aCache.GetItemDataById(2, aCache.GetItemDataId(2, i, false));
+        CPPUNIT_ASSERT(pItem);
+        CPPUNIT_ASSERT_EQUAL(double((i + 1) % 100 * 2), pItem->GetValue());
+    }
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_FIXTURE(TestPivottable, testPivotTableDuplicateDataFields)
 {
     /**
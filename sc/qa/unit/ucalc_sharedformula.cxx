@@ -2787,6 +2787,90 @@ CPPUNIT_TEST_FIXTURE(TestSharedFormula, testSharedFormulaInsertShift)
     m_pDoc->DeleteTab(0);
 }
 
+CPPUNIT_TEST_FIXTURE(TestSharedFormula, testSharedFormulaCopyToUndoAndClip)
+{
+    m_pDoc->InsertTab(0, "Test");
+
+    // Values in A1:A10, two formula groups in B1:B4 and B5:B10.
+    for (SCROW i = 0; i <= 9; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(0,i,0), i);
+        OUString aRow = OUString::number(i+1);
+        m_pDoc->SetString(ScAddress(1,i,0), i < 4 ? OUString("=A" + aRow + "*2") : OUString("=A" + aRow + "+1"));
+    }
+
+    const ScFormulaCell* pFC = m_pDoc->GetFormulaCell(ScAddress(1,9,0));
+    CPPUNIT_ASSERT(pFC);
+    CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(4), pFC->GetSharedTopRow());
+    CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(6), pFC->GetSharedLength());
+
+    ScDocument aUndoDoc(SCDOCMODE_UNDO);
+    aUndoDoc.InitUndo(*m_pDoc, 0, 0);
+    m_pDoc->CopyToDocument(ScRange(0,0,0,1,9,0), InsertDeleteFlags::CONTENTS, false, aUndoDoc);
+
+    for (SCROW i = 0; i <= 9; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(static_cast<double>(i), aUndoDoc.GetValue(ScAddress(0,i,0)));
+
+        pFC = aUndoDoc.GetFormulaCell(ScAddress(1,i,0));
+        CPPUNIT_ASSERT_MESSAGE("Must be a formula cell.", pFC);
+        CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(i < 4 ? 0 : 4), pFC->GetSharedTopRow());
+        CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(i < 4 ? 4 : 6), pFC->GetSharedLength());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("The token is expected to be shared.", pFC->GetCode(), pFC->GetSharedCode());
+        CPPUNIT_ASSERT_EQUAL(m_pDoc->GetFormula(1,i,0), aUndoDoc.GetFormula(1,i,0));
+    }
+
+    // The clipboard gets the same groups, with the results.
+    ScDocument aClipDoc(SCDOCMODE_CLIP);
+    copyToClip(m_pDoc, ScRange(0,0,0,1,9,0), &aClipDoc);
+
+    for (SCROW i = 0; i <= 9; ++i)
+    {
+        pFC = aClipDoc.GetFormulaCell(ScAddress(1,i,0));
+        CPPUNIT_ASSERT_MESSAGE("Must be a formula cell.", pFC);
+        CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(i < 4 ? 0 : 4), pFC->GetSharedTopRow());
+        CPPUNIT_ASSERT_EQUAL(static_cast<SCROW>(i < 4 ? 4 : 6), pFC->GetSharedLength());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("The token is expected to be shared.", pFC->GetCode(), pFC->GetSharedCode());
+        CPPUNIT_ASSERT_EQUAL(m_pDoc->GetValue(ScAddress(1,i,0)), aClipDoc.GetValue(ScAddress(1,i,0)));
+    }
+
+    m_pDoc->DeleteTab(0);
+}
+
+CPPUNIT_TEST_FIXTURE(TestSharedFormula, testSharedFormulaSubTotalCopyToUndo)
+{
+    m_pDoc->InsertTab(0, "Test");
+
+    // Values in A1:A5, a SUBTOTAL group in B1:B5 and a date group in C1:C5.
+    for (SCROW i = 0; i <= 4; ++i)
+    {
+        m_pDoc->SetValue(ScAddress(0,i,0), i+1);
+        OUString aRow = OUString::number(i+1);
+        m_pDoc->SetString(ScAddress(1,i,0), "=SUBTOTAL(9;A1:A" + aRow + ")");
+        m_pDoc->SetString(ScAddress(2,i,0), "=DATE(2020;1;A" + aRow + ")");
+    }
+
+    ScDocument aUndoDoc(SCDOCMODE_UNDO);
+    aUndoDoc.InitUndo(*m_pDoc, 0, 0);
+    m_pDoc->CopyToDocument(ScRange(0,0,0,2,4,0), InsertDeleteFlags::CONTENTS, false, aUndoDoc);
+
+    // The cells sharing the group of the first copy must keep what the
+    // group doesn't know about.
+    for (SCROW i = 0; i <= 4; ++i)
+    {
+        const ScFormulaCell* pFC = aUndoDoc.GetFormulaCell(ScAddress(1,i,0));
+        CPPUNIT_ASSERT_MESSAGE("Must be a formula cell.", pFC);
+        CPPUNIT_ASSERT_MESSAGE("Must be a subtotal cell.", pFC->IsSubTotal());
+
+        pFC = aUndoDoc.GetFormulaCell(ScAddress(2,i,0));
+        CPPUNIT_ASSERT_MESSAGE("Must be a formula cell.", pFC);
+        CPPUNIT_ASSERT_MESSAGE("Must keep the date format type.",
+                               pFC->GetFormatType() == SvNumFormatType::DATE);
+    }
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
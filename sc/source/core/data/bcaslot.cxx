@@ -548,16 +548,21 @@ void ScBroadcastAreaSlot::FinallyEraseAreas()
 
 // --- ScBroadcastAreaSlotMachine -------------------------------------
 
-ScBroadcastAreaSlotMachine::TableSlots::TableSlots(SCSIZE nBcaSlots)
+ScBroadcastAreaSlotMachine::TableSlots::TableSlots(SCSIZE nBcaSlots, SCSIZE nTallSlots)
     : mnBcaSlots(nBcaSlots)
+    , mnTallSlots(nTallSlots)
 {
     ppSlots.reset( new ScBroadcastAreaSlot* [ nBcaSlots ] );
     memset( ppSlots.get(), 0 , sizeof( ScBroadcastAreaSlot* ) * nBcaSlots );
+    ppTallSlots.reset( new ScBroadcastAreaSlot* [ nTallSlots ] );
+    memset( ppTallSlots.get(), 0 , sizeof( ScBroadcastAreaSlot* ) * nTallSlots );
 }
 
 ScBroadcastAreaSlotMachine::TableSlots::TableSlots(TableSlots&& rOther) noexcept
     : mnBcaSlots(rOther.mnBcaSlots)
+    , mnTallSlots(rOther.mnTallSlots)
     , ppSlots( std::move(rOther.ppSlots) )
+    , ppTallSlots( std::move(rOther.ppTallSlots) )
 {
 }
 
@@ -566,6 +571,9 @@ ScBroadcastAreaSlotMachine::TableSlots::~TableSlots()
     if (ppSlots)
         for ( ScBroadcastAreaSlot** pp = ppSlots.get() + mnBcaSlots; --pp >= ppSlots.get(); /* nothing */ )
             delete *pp;
+    if (ppTallSlots)
+        for ( ScBroadcastAreaSlot** pp = ppTallSlots.get() + mnTallSlots; --pp >= ppTallSlots.get(); /* nothing */ )
+            delete *pp;
 }
 
 ScBroadcastAreaSlotMachine::ScBroadcastAreaSlotMachine(
@@ -687,6 +695,16 @@ static void ComputeNextSlot( SCSIZE & nOff, SCSIZE & nBreak, ScBroadcastAreaSlot
     }
 }
 
+ScBroadcastAreaSlotMachine::TableSlotsMap::iterator ScBroadcastAreaSlotMachine::EmplaceTableSlots( SCTAB nTab )
+{
+    TableSlotsMap::iterator iTab( aTableSlotsMap.find( nTab));
+    if (iTab == aTableSlotsMap.end())
+        iTab = aTableSlotsMap.emplace( std::piecewise_construct,
+                std::forward_as_tuple(nTab),
+                std::forward_as_tuple(mnBcaSlots, mnBcaSlots / mnBcaSlotsCol) ).first;
+    return iTab;
+}
+
 #ifdef DBG_UTIL
 static void compare(SCSIZE value1, SCSIZE value2, int line)
 {
@@ -794,13 +812,30 @@ void ScBroadcastAreaSlotMachine::StartListeningArea(
         for (SCTAB nTab = rRange.aStart.Tab();
                 !bDone && nTab <= rRange.aEnd.Tab(); ++nTab)
         {
-            TableSlotsMap::iterator iTab( aTableSlotsMap.find( nTab));
-            if (iTab == aTableSlotsMap.end())
-                iTab = aTableSlotsMap.emplace( std::piecewise_construct,
-                        std::forward_as_tuple(nTab), std::forward_as_tuple(mnBcaSlots) ).first;
-            ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
+            TableSlotsMap::iterator iTab( EmplaceTableSlots( nTab));
             SCSIZE nStart, nEnd, nRowBreak;
             ComputeAreaPoints( rRange, nStart, nEnd, nRowBreak );
+            if (IsTallArea( nRowBreak))
+            {
+                ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+                SCSIZE nTallStart, nTallEnd;
+                ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+                for (SCSIZE nTall = nTallStart; !bDone && nTall <= nTallEnd; ++nTall)
+                {
+                    ScBroadcastAreaSlot*& rpSlot = ppTallSlots[nTall];
+                    if (!rpSlot)
+                        rpSlot = new ScBroadcastAreaSlot( pDoc, this );
+                    if (!pArea)
+                    {
+                        if (!rpSlot->StartListeningArea( rRange, bGroupListening, pListener, pArea))
+                            bDone = true;
+                    }
+                    else
+                        rpSlot->InsertListeningArea( pArea);
+                }
+                continue;
+            }
+            ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
             SCSIZE nOff = nStart;
             SCSIZE nBreak = nOff + nRowBreak;
             ScBroadcastAreaSlot** pp = ppSlots + nOff;
@@ -848,10 +883,22 @@ void ScBroadcastAreaSlotMachine::EndListeningArea(
             ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
             SCSIZE nStart, nEnd, nRowBreak;
             ComputeAreaPoints( rRange, nStart, nEnd, nRowBreak );
+            ScBroadcastArea* pArea = nullptr;
+            if (IsTallArea( nRowBreak))
+            {
+                ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+                SCSIZE nTallStart, nTallEnd;
+                ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+                for (SCSIZE nTall = nTallStart; nTall <= nTallEnd; ++nTall)
+                {
+                    if (ppTallSlots[nTall])
+                        ppTallSlots[nTall]->EndListeningArea( rRange, bGroupListening, pListener, pArea);
+                }
+                continue;
+            }
             SCSIZE nOff = nStart;
             SCSIZE nBreak = nOff + nRowBreak;
             ScBroadcastAreaSlot** pp = ppSlots + nOff;
-            ScBroadcastArea* pArea = nullptr;
             if (nOff == 0 && nEnd == mnBcaSlots-1)
             {
                 // Slightly optimized for 0,0,MAXCOL,MAXROW calls as they
@@ -895,6 +942,14 @@ bool ScBroadcastAreaSlotMachine::AreaBroadcast( const ScRange& rRange, SfxHintId
                 bBroadcasted |= (*pp)->AreaBroadcast( rRange, nHint );
             ComputeNextSlot( nOff, nBreak, pp, nStart, ppSlots, nRowBreak, mnBcaSlotsCol);
         }
+        ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+        SCSIZE nTallStart, nTallEnd;
+        ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+        for (SCSIZE nTall = nTallStart; nTall <= nTallEnd; ++nTall)
+        {
+            if (ppTallSlots[nTall])
+                bBroadcasted |= ppTallSlots[nTall]->AreaBroadcast( rRange, nHint );
+        }
     }
     return bBroadcasted;
 }
@@ -933,6 +988,10 @@ bool ScBroadcastAreaSlotMachine::AreaBroadcast( const ScHint& rHint ) const
                 bBroadcasted |= (*pp)->AreaBroadcast( rHint );
             ComputeNextSlot( nOff, nBreak, pp, nStart, ppSlots, nRowBreak, mnBcaSlotsCol);
         }
+        // The hint is for one column, so there is only one tall slot to check.
+        ScBroadcastAreaSlot* pTallSlot = (*iTab).second.getTallSlots()[nStart / mnBcaSlotsCol];
+        if (pTallSlot)
+            bBroadcasted |= pTallSlot->AreaBroadcast( rHint );
         return bBroadcasted;
     }
 }
@@ -970,6 +1029,14 @@ void ScBroadcastAreaSlotMachine::DelBroadcastAreasInRange(
                 ComputeNextSlot( nOff, nBreak, pp, nStart, ppSlots, nRowBreak, mnBcaSlotsCol);
             }
         }
+        ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+        SCSIZE nTallStart, nTallEnd;
+        ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+        for (SCSIZE nTall = nTallStart; nTall <= nTallEnd; ++nTall)
+        {
+            if (ppTallSlots[nTall])
+                ppTallSlots[nTall]->DelBroadcastAreasInRange( rRange );
+        }
     }
 }
 
@@ -1009,6 +1076,14 @@ void ScBroadcastAreaSlotMachine::UpdateBroadcastAreas(
                 ComputeNextSlot( nOff, nBreak, pp, nStart, ppSlots, nRowBreak, mnBcaSlotsCol);
             }
         }
+        ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+        SCSIZE nTallStart, nTallEnd;
+        ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+        for (SCSIZE nTall = nTallStart; nTall <= nTallEnd; ++nTall)
+        {
+            if (ppTallSlots[nTall])
+                ppTallSlots[nTall]->UpdateRemove( eUpdateRefMode, rRange, nDx, nDy, nDz );
+        }
     }
 
     // Updating an area's range will modify the hash key, remove areas from all
@@ -1028,9 +1103,21 @@ void ScBroadcastAreaSlotMachine::UpdateBroadcastAreas(
                 OSL_FAIL( "UpdateBroadcastAreas: Where's the TableSlot?!?");
                 continue;   // for
             }
-            ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
             SCSIZE nStart, nEnd, nRowBreak;
             ComputeAreaPoints( aRange, nStart, nEnd, nRowBreak );
+            if (IsTallArea( nRowBreak))
+            {
+                ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+                SCSIZE nTallStart, nTallEnd;
+                ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+                for (SCSIZE nTall = nTallStart; nTall <= nTallEnd && pArea->GetRef(); ++nTall)
+                {
+                    if (ppTallSlots[nTall])
+                        ppTallSlots[nTall]->UpdateRemoveArea( pArea);
+                }
+                continue;
+            }
+            ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
             SCSIZE nOff = nStart;
             SCSIZE nBreak = nOff + nRowBreak;
             ScBroadcastAreaSlot** pp = ppSlots + nOff;
@@ -1117,13 +1204,23 @@ void ScBroadcastAreaSlotMachine::UpdateBroadcastAreas(
         // insert to slots
         for (SCTAB nTab = aRange.aStart.Tab(); nTab <= aRange.aEnd.Tab(); ++nTab)
         {
-            TableSlotsMap::iterator iTab( aTableSlotsMap.find( nTab));
-            if (iTab == aTableSlotsMap.end())
-                iTab = aTableSlotsMap.emplace( std::piecewise_construct,
-                        std::forward_as_tuple(nTab), std::forward_as_tuple(mnBcaSlots) ).first;
-            ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
+            TableSlotsMap::iterator iTab( EmplaceTableSlots( nTab));
             SCSIZE nStart, nEnd, nRowBreak;
             ComputeAreaPoints( aRange, nStart, nEnd, nRowBreak );
+            if (IsTallArea( nRowBreak))
+            {
+                ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+                SCSIZE nTallStart, nTallEnd;
+                ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+                for (SCSIZE nTall = nTallStart; nTall <= nTallEnd; ++nTall)
+                {
+                    if (!ppTallSlots[nTall])
+                        ppTallSlots[nTall] = new ScBroadcastAreaSlot( pDoc, this );
+                    ppTallSlots[nTall]->UpdateInsert( pArea );
+                }
+                continue;
+            }
+            ScBroadcastAreaSlot** ppSlots = (*iTab).second.getSlots();
             SCSIZE nOff = nStart;
             SCSIZE nBreak = nOff + nRowBreak;
             ScBroadcastAreaSlot** pp = ppSlots + nOff;
@@ -1278,6 +1375,15 @@ std::vector<sc::AreaListener> ScBroadcastAreaSlotMachine::GetAllListeners(
                 p->GetAllListeners(rRange, aRet, eType, eGroup);
             ComputeNextSlot( nOff, nBreak, pp, nStart, ppSlots, nRowBreak, mnBcaSlotsCol);
         }
+        ScBroadcastAreaSlot** ppTallSlots = (*iTab).second.getTallSlots();
+        SCSIZE nTallStart, nTallEnd;
+        ComputeTallSlots( nStart, nEnd, nTallStart, nTallEnd );
+        for (SCSIZE nTall = nTallStart; nTall <= nTallEnd; ++nTall)
+        {
+            ScBroadcastAreaSlot* p = ppTallSlots[nTall];
+            if (p)
+                p->GetAllListeners(rRange, aRet, eType, eGroup);
+        }
     }
 
     return aRet;
@@ -1302,6 +1408,16 @@ void ScBroadcastAreaSlotMachine::Dump() const
                 pSlot->Dump();
             }
         }
+        ScBroadcastAreaSlot** ppTallSlots = pTabSlots->getTallSlots();
+        for (SCSIZE i = 0; i < nBcaSlots / mnBcaSlotsCol; ++i)
+        {
+            const ScBroadcastAreaSlot* pSlot = ppTallSlots[i];
+            if (pSlot)
+            {
+                cout << "* tall slot " << i << endl;
+                pSlot->Dump();
+            }
+        }
     }
 }
 #endif
@@ -10,6 +10,7 @@
 #include <memory>
 #include <colorscale.hxx>
 #include <document.hxx>
+#include <dociter.hxx>
 #include <formulacell.hxx>
 #include <fillinfo.hxx>
 #include <bitmaps.hlst>
@@ -439,43 +440,40 @@ const ScRangeList& ScColorFormat::GetRange() const
     return mpParent->GetRange();
 }
 
+bool ScColorFormat::isCacheValid() const
+{
+    if (!mpCache)
+        return false;
+
+    if (mpCache->maRanges != GetRange())
+        return false;
+
+    // NeedsRepaint() also resets the flag, the values will be collected anew.
+    return !mpCache->mpListener || !mpCache->mpListener->NeedsRepaint();
+}
+
 std::vector<double>& ScColorFormat::getValues() const
 {
-    if(!mpCache)
+    if(!isCacheValid())
     {
         mpCache.reset(new ScColorFormatCache);
         std::vector<double>& rValues = mpCache->maValues;
 
-        size_t n = GetRange().size();
         const ScRangeList& aRanges = GetRange();
+        mpCache->maRanges = aRanges;
+        if (!mpDoc->IsClipOrUndo())
+            mpCache->mpListener.reset(new ScFormulaListener(*mpDoc, aRanges));
+
+        size_t n = aRanges.size();
         for(size_t i = 0; i < n; ++i)
         {
-            const ScRange & rRange = aRanges[i];
-            SCTAB nTab = rRange.aStart.Tab();
-
-            SCCOL nColStart = rRange.aStart.Col();
-            SCROW nRowStart = rRange.aStart.Row();
-            SCCOL nColEnd = rRange.aEnd.Col();
-            SCROW nRowEnd = rRange.aEnd.Row();
-
-            if(nRowEnd == mpDoc->MaxRow())
-            {
-                bool bShrunk = false;
-                mpDoc->ShrinkToUsedDataArea(bShrunk, nTab, nColStart, nRowStart,
-                        nColEnd, nRowEnd, false);
-            }
-            for(SCCOL nCol = nColStart; nCol <= nColEnd; ++nCol)
+            // The iterator skips empty blocks, so whole columns are cheap.
+            ScCellIterator aIter(*mpDoc, aRanges[i]);
+            for (bool bHas = aIter.first(); bHas; bHas = aIter.next())
             {
-                for(SCROW nRow = nRowStart; nRow <= nRowEnd; ++nRow)
-                {
-                    ScAddress aAddr(nCol, nRow, nTab);
-                    ScRefCellValue rCell(*mpDoc, aAddr);
-                    if(rCell.hasNumeric())
-                    {
-                        double aVal = rCell.getValue();
-                        rValues.push_back(aVal);
-                    }
-                }
+                ScRefCellValue aCell = aIter.getRefCellValue();
+                if (aCell.hasNumeric())
+                    rValues.push_back(aCell.getValue());
             }
         }
 
@@ -503,12 +501,15 @@ double ScColorFormat::getMaxValue() const
 
 void ScColorFormat::startRendering()
 {
-    mpCache.reset();
+    // Without a listener nothing tells us about changed cells.
+    if (mpCache && !mpCache->mpListener)
+        mpCache.reset();
 }
 
 void ScColorFormat::endRendering()
 {
-    mpCache.reset();
+    if (mpCache && !mpCache->mpListener)
+        mpCache.reset();
 }
 
 namespace {
@@ -374,6 +374,21 @@ sal_uInt32 ScColumnData::GetNumberFormat( SCROW nStartRow, SCROW nEndRow ) const
     return nFormat;
 }
 
+bool ScColumnData::HasOnlyGeneralNumberFormat( SCROW nStartRow, SCROW nEndRow ) const
+{
+    SvNumberFormatter* pFormatter = GetDoc().GetFormatTable();
+    SCROW nPatStartRow, nPatEndRow;
+    do
+    {
+        const ScPatternAttr* pPattern = pAttrArray->GetPatternRange(nPatStartRow, nPatEndRow, nStartRow);
+        if ((pPattern->GetNumberFormat(pFormatter) % SV_COUNTRY_LANGUAGE_OFFSET) != 0)
+            return false;
+        nStartRow = nPatEndRow + 1;
+    }
+    while (nPatEndRow < nEndRow);
+    return true;
+}
+
 SCROW ScColumn::ApplySelectionCache( SfxItemPoolCache* pCache, const ScMarkData& rMark, ScEditDataArray* pDataArray,
                                      bool* const pIsChanged )
 {
@@ -789,6 +804,47 @@ void ScColumn::InsertRow( SCROW nStartRow, SCSIZE nSize )
 
 namespace {
 
+/**
+ * Whether the copy of rSrcCell to rDestPos can share the token array of
+ * pPrevDest, the copy of pPrevSrc to the row above, instead of getting its
+ * own.
+ */
+bool canShareClonedCode(
+    const ScFormulaCell& rSrcCell, const ScFormulaCell* pPrevSrc, const ScFormulaCell* pPrevDest,
+    const ScAddress& rDestPos)
+{
+    if (!pPrevSrc || !pPrevDest)
+        return false;
+
+    const ScFormulaCellGroupRef& xSrcGroup = rSrcCell.GetCellGroup();
+    if (!xSrcGroup || xSrcGroup != pPrevSrc->GetCellGroup())
+        return false;
+
+    if (pPrevDest->aPos.Row() + 1 != rDestPos.Row() || rSrcCell.aPos.Row() != rDestPos.Row())
+        return false;
+
+    if (rSrcCell.GetMatrixFlag() != ScMatrixMode::NONE)
+        return false;
+
+    if (pPrevDest->GetDocument().GetPool() != rSrcCell.GetDocument().GetPool())
+        return false;
+
+    // These get adjusted or recompiled per cell on copy.
+    const ScTokenArray* pCode = rSrcCell.GetCode();
+    return !pCode->HasExternalRef() && !pCode->HasOpCode(ocName) && !pCode->HasOpCode(ocColRowName);
+}
+
+ScFormulaCell* cloneIntoGroupOf(ScFormulaCell& rPrevDest, const ScFormulaCell& rSrcCell, const ScAddress& rDestPos)
+{
+    ScFormulaCellGroupRef xGroup = rPrevDest.GetCellGroup();
+    if (!xGroup)
+        xGroup = rPrevDest.CreateCellGroup(1, rSrcCell.GetCellGroup()->mbInvariant);
+
+    ScFormulaCell* pCell = new ScFormulaCell(rSrcCell, rPrevDest.GetDocument(), rDestPos, xGroup);
+    ++xGroup->mnLength;
+    return pCell;
+}
+
 class CopyToClipHandler
 {
     const ScDocument& mrSrcDoc;
@@ -873,19 +929,28 @@ public:
                 std::vector<ScFormulaCell*> aCloned;
                 aCloned.reserve(nDataSize);
                 ScAddress aDestPos(mrDestCol.GetCol(), nTopRow, mrDestCol.GetTab());
+                const ScFormulaCell* pPrevOld = nullptr;
                 for (; it != itEnd; ++it, aDestPos.IncRow())
                 {
                     const ScFormulaCell& rOld = **it;
                     if (rOld.GetDirty() && mrSrcCol.GetDoc().GetAutoCalc())
                         const_cast<ScFormulaCell&>(rOld).Interpret();
 
-                    aCloned.push_back(new ScFormulaCell(rOld, mrDestCol.GetDoc(), aDestPos));
+                    // Cells of a source group share the token array of its
+                    // first copy right away.
+                    ScFormulaCell* pPrev = aCloned.empty() ? nullptr : aCloned.back();
+                    if (canShareClonedCode(rOld, pPrevOld, pPrev, aDestPos))
+                        aCloned.push_back(cloneIntoGroupOf(*pPrev, rOld, aDestPos));
+                    else
+                    {
+                        aCloned.push_back(new ScFormulaCell(rOld, mrDestCol.GetDoc(), aDestPos));
+                        // Group the cloned formula cell with the one above.
+                        if (pPrev)
+                            sc::SharedFormulaUtil::groupFormulaCells(aCloned.end() - 2, aCloned.end());
+                    }
+                    pPrevOld = &rOld;
                 }
 
-                // Group the cloned formula cells.
-                if (!aCloned.empty())
-                    sc::SharedFormulaUtil::groupFormulaCells(aCloned.begin(), aCloned.end());
-
                 sc::CellStoreType& rDestCells = mrDestCol.GetCellStore();
                 maDestPos.miCellPos = rDestCells.set(
                     maDestPos.miCellPos, nTopRow, aCloned.begin(), aCloned.end());
@@ -1312,6 +1377,10 @@ class CopyByCloneHandler
     sc::StartListeningType meListenType;
     ScCloneFlags mnFormulaCellCloneFlags;
 
+    /// Last formula cell cloned, and its source, to share token arrays in undo documents.
+    const ScFormulaCell* mpLastSrcFormula;
+    ScFormulaCell* mpLastDestFormula;
+
     void setDefaultAttrToDest(size_t nRow)
     {
         maDestPos.miCellTextAttrPos = mrDestCol.GetCellAttrStore().set(
@@ -1353,10 +1422,18 @@ class CopyByCloneHandler
         if (bForceFormula || bCloneFormula)
         {
             // Clone as formula cell.
-            ScFormulaCell* pCell = new ScFormulaCell(rSrcCell, mrDestCol.GetDoc(), aDestPos, mnFormulaCellCloneFlags);
+            // Undo documents group the cloned cells again anyway, skip the
+            // token array copies that grouping would discard.
+            ScFormulaCell* pCell;
+            if (mrDestCol.GetDoc().IsUndo() && canShareClonedCode(rSrcCell, mpLastSrcFormula, mpLastDestFormula, aDestPos))
+                pCell = cloneIntoGroupOf(*mpLastDestFormula, rSrcCell, aDestPos);
+            else
+                pCell = new ScFormulaCell(rSrcCell, mrDestCol.GetDoc(), aDestPos, mnFormulaCellCloneFlags);
             pCell->SetDirtyVar();
             mrDestCol.SetFormulaCell(maDestPos, nRow, pCell, meListenType, rSrcCell.NeedsNumberFormat());
             setDefaultAttrToDest(nRow);
+            mpLastSrcFormula = &rSrcCell;
+            mpLastDestFormula = pCell;
             return;
         }
 
@@ -1426,7 +1503,9 @@ public:
         mpSharedStringPool(pSharedStringPool),
         mnCopyFlags(nCopyFlags),
         meListenType(sc::SingleCellListening),
-        mnFormulaCellCloneFlags(bGlobalNamesToLocal ? ScCloneFlags::NamesToLocal : ScCloneFlags::Default)
+        mnFormulaCellCloneFlags(bGlobalNamesToLocal ? ScCloneFlags::NamesToLocal : ScCloneFlags::Default),
+        mpLastSrcFormula(nullptr),
+        mpLastDestFormula(nullptr)
     {
         if (mpDestPos)
             maDestPos = *mpDestPos;
@@ -1485,6 +1564,15 @@ public:
                 sc::numeric_block::const_iterator itEnd = it;
                 std::advance(itEnd, nDataSize);
 
+                if ((mnCopyFlags & (InsertDeleteFlags::DATETIME|InsertDeleteFlags::VALUE)) ==
+                    (InsertDeleteFlags::DATETIME|InsertDeleteFlags::VALUE))
+                {
+                    // All values get copied regardless of their number format.
+                    maDestPos.miCellPos = mrDestCol.GetCellStore().set(maDestPos.miCellPos, nRow, it, itEnd);
+                    setDefaultAttrsToDest(nRow, nDataSize);
+                    return;
+                }
+
                 ScAddress aSrcPos(mrSrcCol.GetCol(), nRow, mrSrcCol.GetTab());
                 for (; it != itEnd; ++it, aSrcPos.IncRow(), ++nRow)
                 {
@@ -2882,11 +2970,13 @@ class CompileXMLHandler
     sc::CompileFormulaContext& mrCxt;
     ScProgress& mrProgress;
     const ScColumn& mrCol;
+    const ScFormulaCell* mpLastCell;
 public:
     CompileXMLHandler( sc::CompileFormulaContext& rCxt, ScProgress& rProgress, const ScColumn& rCol) :
         mrCxt(rCxt),
         mrProgress(rProgress),
-        mrCol(rCol) {}
+        mrCol(rCol),
+        mpLastCell(nullptr) {}
 
     void operator() (size_t nRow, ScFormulaCell* pCell)
     {
@@ -2900,7 +2990,8 @@ public:
         if (pCell->GetMatrixFlag() != ScMatrixMode::NONE)
             pCell->SetDirtyVar();
 
-        pCell->CompileXML(mrCxt, mrProgress);
+        pCell->CompileXML(mrCxt, mrProgress, mpLastCell);
+        mpLastCell = pCell;
     }
 };
 
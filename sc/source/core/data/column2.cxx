@@ -68,6 +68,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <unordered_map>
 
 // factor from font size to optimal cell height (text width)
 #define SC_ROT_BREAK_FACTOR     6
@@ -1051,6 +1052,17 @@ void ScColumn::GetOptimalHeight(
             {
                 ScNeededSizeOptions aOptions;
 
+                // Plain string cells of the same pattern with the same
+                // (pooled) text need the same height, measure only the first
+                // of them. Not with conditional formats or a preview font or
+                // style, which may apply to single cells only.
+                const bool bCacheHeights =
+                    pPattern->GetItem(ATTR_CONDITIONAL).GetCondFormatData().empty() &&
+                    !rDocument.GetPreviewFont() && !rDocument.GetPreviewCellStyle();
+                std::unordered_map<const rtl_uString*, sal_uInt16> aStringHeights;
+                const ScPatternAttr* pHeightsPattern = pPattern;
+                sc::CellStoreType::const_iterator itCell = maCells.begin();
+
                 for (const auto& rSpan : aSpans)
                 {
                     for (SCROW nRow = rSpan.mnRow1; nRow <= rSpan.mnRow2; ++nRow)
@@ -1059,22 +1071,45 @@ void ScColumn::GetOptimalHeight(
 
                         if (rCxt.isForceAutoSize() || !(rDocument.GetRowFlags(nRow, nTab) & CRFlags::ManualSize) )
                         {
-                            aOptions.pPattern = pPattern;
-                            const ScPatternAttr* pOldPattern = pPattern;
-                            sal_uInt16 nHeight = static_cast<sal_uInt16>(
-                                std::min(
-                                    GetNeededSize( nRow, rCxt.getOutputDevice(), rCxt.getPPTX(), rCxt.getPPTY(),
-                                                   rCxt.getZoomX(), rCxt.getZoomY(), false, aOptions,
-                                                   &pPattern) / rCxt.getPPTY(),
-                                    double(std::numeric_limits<sal_uInt16>::max())));
-                            if (nHeight > rHeights.GetValue(nRow))
-                                rHeights.SetValue(nRow, nRow, nHeight);
-                            // Pattern changed due to calculation? => sync.
-                            if (pPattern != pOldPattern)
+                            const rtl_uString* pText = nullptr;
+                            if (bCacheHeights)
                             {
-                                pPattern = aIter.Resync( nRow, nStart, nEnd);
-                                nNextEnd = 0;
+                                if (pHeightsPattern != pPattern)
+                                {
+                                    aStringHeights.clear();
+                                    pHeightsPattern = pPattern;
+                                }
+                                std::pair<sc::CellStoreType::const_iterator,size_t> aPos = maCells.position(itCell, nRow);
+                                itCell = aPos.first;
+                                if (itCell->type == sc::element_type_string)
+                                    pText = sc::string_block::at(*itCell->data, aPos.second).getData();
                             }
+
+                            sal_uInt16 nHeight;
+                            auto itHeight = pText ? aStringHeights.find(pText) : aStringHeights.end();
+                            if (itHeight != aStringHeights.end())
+                                nHeight = itHeight->second;
+                            else
+                            {
+                                aOptions.pPattern = pPattern;
+                                const ScPatternAttr* pOldPattern = pPattern;
+                                nHeight = static_cast<sal_uInt16>(
+                                    std::min(
+                                        GetNeededSize( nRow, rCxt.getOutputDevice(), rCxt.getPPTX(), rCxt.getPPTY(),
+                                                       rCxt.getZoomX(), rCxt.getZoomY(), false, aOptions,
+                                                       &pPattern) / rCxt.getPPTY(),
+                                        double(std::numeric_limits<sal_uInt16>::max())));
+                                if (pText && pPattern == pOldPattern)
+                                    aStringHeights.emplace(pText, nHeight);
+                                // Pattern changed due to calculation? => sync.
+                                if (pPattern != pOldPattern)
+                                {
+                                    pPattern = aIter.Resync( nRow, nStart, nEnd);
+                                    nNextEnd = 0;
+                                }
+                            }
+                            if (nHeight > rHeights.GetValue(nRow))
+                                rHeights.SetValue(nRow, nRow, nHeight);
                         }
                     }
                 }
@@ -57,6 +57,10 @@
 #include <o3tl/deleter.hxx>
 
 #include <rtl/tencinfo.h>
+#include <rtl/math.hxx>
+#include <rtl/character.hxx>
+#include <i18nlangtag/languagetag.hxx>
+#include <unotools/localedatawrapper.hxx>
 
 #include <svl/numformat.hxx>
 #include <svl/zforlist.hxx>
@@ -2068,6 +2072,49 @@ void applyTextNumFormat( ScColumn& rCol, SCROW nRow, SvNumberFormatter* pFormatt
     rCol.ApplyPattern(nRow, aNewAttrs);
 }
 
+/**
+ * Parse the most common numeric input, an optionally negative integer or
+ * decimal number without group separators, exponent or surrounding spaces,
+ * that the number scanner would read as plain number in the General format
+ * anyway.  Avoids the full input scan for e.g. columns of imported CSV data.
+ */
+bool parsePlainDecimal( const OUString& rStr, const LocaleDataWrapper& rLocale, double& rVal )
+{
+    const sal_Int32 nLen = rStr.getLength();
+    if (nLen == 0 || nLen > 16)
+        return false;
+
+    const OUString& rDecSep = rLocale.getNumDecimalSep();
+    if (rDecSep.getLength() != 1)
+        return false;
+
+    // A separator shared with dates may also start a date, leave that to
+    // the scanner.
+    const sal_Unicode cDecSep = (rLocale.getDateSep() == rDecSep) ? 0 : rDecSep[0];
+
+    sal_Int32 i = (rStr[0] == '-') ? 1 : 0;
+    sal_Int32 nDigits = 0;
+    bool bDecSep = false;
+    for (; i < nLen; ++i)
+    {
+        const sal_Unicode c = rStr[i];
+        if (rtl::isAsciiDigit(c))
+            ++nDigits;
+        else if (c == cDecSep && !bDecSep && nDigits > 0 && i < nLen - 1)
+            bDecSep = true;
+        else
+            return false;
+    }
+
+    // Up to 15 digits every correctly rounded conversion yields the same value.
+    if (nDigits == 0 || nDigits > 15)
+        return false;
+
+    rtl_math_ConversionStatus eStatus;
+    rVal = rtl::math::stringToDouble(rStr, cDecSep ? cDecSep : '.', 0, &eStatus);
+    return eStatus == rtl_math_ConversionStatus_Ok && (rVal != 0.0 || rStr[0] != '-');
+}
+
 }
 
 bool ScColumn::ParseString(
@@ -2150,6 +2197,20 @@ bool ScColumn::ParseString(
         {
             if (aParam.mbDetectNumberFormat)
             {
+                if ((nOldIndex % SV_COUNTRY_LANGUAGE_OFFSET) == 0)
+                {
+                    // General format, a plain number keeps it.
+                    const LocaleDataWrapper* pLocale = aParam.mpNumFormatter->GetLocaleData();
+                    const SvNumberformat* pOldFormat = aParam.mpNumFormatter->GetEntry(nOldIndex);
+                    if (pLocale && pOldFormat
+                            && pLocale->getLanguageTag().getLanguageType() == pOldFormat->GetLanguage()
+                            && parsePlainDecimal(rString, *pLocale, nVal))
+                    {
+                        rCell.set(nVal);
+                        break;
+                    }
+                }
+
                 // Editing a date prefers the format's locale's edit date
                 // format's date acceptance patterns and YMD order.
                 /* TODO: this could be determined already far above when
@@ -2425,9 +2486,12 @@ ScFormulaCell* ScColumn::SetFormulaCell(
 {
     std::vector<SCROW> aNewSharedRows;
     sc::CellStoreType::iterator it = GetPositionToInsert(nRow, aNewSharedRows, true);
-    sal_uInt32 nCellFormat = GetNumberFormat(GetDoc().GetNonThreadedContext(), nRow);
-    if( (nCellFormat % SV_COUNTRY_LANGUAGE_OFFSET) == 0 && bInheritNumFormatIfNeeded )
-        pCell->SetNeedNumberFormat(true);
+    if (bInheritNumFormatIfNeeded)
+    {
+        sal_uInt32 nCellFormat = GetNumberFormat(GetDoc().GetNonThreadedContext(), nRow);
+        if ((nCellFormat % SV_COUNTRY_LANGUAGE_OFFSET) == 0)
+            pCell->SetNeedNumberFormat(true);
+    }
     it = maCells.set(it, nRow, pCell);
     maCellTextAttrs.set(nRow, sc::CellTextAttr());
 
@@ -2445,9 +2509,12 @@ void ScColumn::SetFormulaCell(
 {
     std::vector<SCROW> aNewSharedRows;
     rBlockPos.miCellPos = GetPositionToInsert(rBlockPos.miCellPos, nRow, aNewSharedRows, true);
-    sal_uInt32 nCellFormat = GetNumberFormat(GetDoc().GetNonThreadedContext(), nRow);
-    if( (nCellFormat % SV_COUNTRY_LANGUAGE_OFFSET) == 0 && bInheritNumFormatIfNeeded )
-        pCell->SetNeedNumberFormat(true);
+    if (bInheritNumFormatIfNeeded)
+    {
+        sal_uInt32 nCellFormat = GetNumberFormat(GetDoc().GetNonThreadedContext(), nRow);
+        if ((nCellFormat % SV_COUNTRY_LANGUAGE_OFFSET) == 0)
+            pCell->SetNeedNumberFormat(true);
+    }
     rBlockPos.miCellPos = maCells.set(rBlockPos.miCellPos, nRow, pCell);
     rBlockPos.miCellTextAttrPos = maCellTextAttrs.set(
         rBlockPos.miCellTextAttrPos, nRow, sc::CellTextAttr());
@@ -2202,6 +2202,83 @@ void ScColumn::RestoreFromCache(SvStream& rStrm)
     }
 }
 
+void ScColumn::CollectReferencedTabs( std::set<SCTAB>& rTabs, bool& rUnknown ) const
+{
+    if (!mnBlkCountFormula)
+        return;
+
+    const ScDocument& rDoc = GetDoc();
+    for (const auto& rBlock : maCells)
+    {
+        if (rBlock.type != sc::element_type_formula)
+            continue;
+
+        sc::formula_block::const_iterator it = sc::formula_block::begin(*rBlock.data);
+        sc::formula_block::const_iterator itEnd = sc::formula_block::end(*rBlock.data);
+        for (; it != itEnd; ++it)
+        {
+            const ScFormulaCell& rCell = **it;
+            // Relative sheet references are the same for all cells of a group.
+            if (rCell.IsShared() && !rCell.IsSharedTop())
+                continue;
+
+            const ScTokenArray& rCode = *rCell.GetCode();
+            // Use the RPN code if available, named expressions are resolved there.
+            const bool bRPN = rCode.GetCodeLen() > 0;
+            formula::FormulaToken* const* pTokens = bRPN ? rCode.GetCode() : rCode.GetArray();
+            const sal_uInt16 nLen = bRPN ? rCode.GetCodeLen() : rCode.GetLen();
+            for (sal_uInt16 i = 0; i < nLen; ++i)
+            {
+                const formula::FormulaToken* p = pTokens[i];
+                switch (p->GetOpCode())
+                {
+                    case ocIndirect:
+                    case ocOffset:
+                    case ocTableOp:
+                    case ocMacro:
+                    case ocExternal:
+                    case ocName:
+                    case ocDBArea:
+                    case ocTableRef:
+                        rUnknown = true;
+                        return;
+                    default:
+                        ;
+                }
+
+                switch (p->GetType())
+                {
+                    case formula::svSingleRef:
+                    {
+                        const ScSingleRefData& rRef = *p->GetSingleRef();
+                        if (rRef.IsDeleted())
+                            break;
+                        const SCTAB nTab = rRef.toAbs(rDoc, rCell.aPos).Tab();
+                        if (ValidTab(nTab))
+                            rTabs.insert(nTab);
+                    }
+                    break;
+                    case formula::svDoubleRef:
+                    {
+                        const ScComplexRefData& rRef = *p->GetDoubleRef();
+                        if (rRef.IsDeleted())
+                            break;
+                        const ScRange aRange = rRef.toAbs(rDoc, rCell.aPos);
+                        for (SCTAB nTab = aRange.aStart.Tab(); nTab <= aRange.aEnd.Tab(); ++nTab)
+                        {
+                            if (ValidTab(nTab))
+                                rTabs.insert(nTab);
+                        }
+                    }
+                    break;
+                    default:
+                        ;
+                }
+            }
+        }
+    }
+}
+
 void ScColumn::CheckIntegrity() const
 {
     const ScColumn* pColTest = maCells.event_handler().getColumn();
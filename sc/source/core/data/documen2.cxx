@@ -76,6 +76,7 @@
 #include <clipparam.hxx>
 #include <macromgr.hxx>
 #include <formulacell.hxx>
+#include <formulagroupprofiler.hxx>
 #include <clipcontext.hxx>
 #include <refupdatecontext.hxx>
 #include <refreshtimerprotector.hxx>
@@ -138,6 +139,7 @@ ScDocument::ScDocument( ScDocumentMode eMode, SfxObjectShell* pDocShell ) :
         nMacroInterpretLevel(0),
         nInterpreterTableOpLevel(0),
         maInterpreterContext( *this, nullptr ),
+        mxScLookupCache(new ScLookupCacheMap),
         mxScSortedRangeCache(new ScSortedRangeCacheMap),
         nFormulaTrackCount(0),
         eHardRecalcState(HardRecalcState::OFF),
@@ -1191,27 +1193,29 @@ void ScDocument::DisposeFieldEditEngine(std::unique_ptr<ScFieldEditEngine>& rpEd
         rpEditEngine.reset();
 }
 
-ScLookupCache & ScDocument::GetLookupCache( const ScRange & rRange, ScInterpreterContext* pContext )
+ScLookupCache & ScDocument::GetLookupCache( const ScRange & rRange )
 {
-    ScLookupCache* pCache = nullptr;
-    if (!pContext->mxScLookupCache)
-        pContext->mxScLookupCache.reset(new ScLookupCacheMap);
-    ScLookupCacheMap* pCacheMap = pContext->mxScLookupCache.get();
+    assert(mxScLookupCache);
+    // Shared by all threads like the sorted range cache below, so that
+    // lookups done by one thread benefit the others. Most calls find an
+    // existing cache, try that with read-only access first.
+    {
+        std::shared_lock guard( mScLookupMutex );
+        auto findIt = mxScLookupCache->aCacheMap.find(rRange);
+        if (findIt != mxScLookupCache->aCacheMap.end())
+            return *findIt->second;
+    }
+    // The StartListeningArea() call is not thread-safe, as all threads
+    // would access the same SvtBroadcaster.
+    std::unique_lock guard( mScLookupMutex );
     // insert with temporary value to avoid doing two lookups
-    auto [findIt, bInserted] = pCacheMap->aCacheMap.emplace(rRange, nullptr);
+    auto [findIt, bInserted] = mxScLookupCache->aCacheMap.emplace(rRange, nullptr);
     if (bInserted)
     {
-        findIt->second = std::make_unique<ScLookupCache>(this, rRange, *pCacheMap);
-        pCache = findIt->second.get();
-        // The StartListeningArea() call is not thread-safe, as all threads
-        // would access the same SvtBroadcaster.
-        std::unique_lock guard( mScLookupMutex );
-        StartListeningArea(rRange, false, pCache);
+        findIt->second = std::make_unique<ScLookupCache>(this, rRange, *mxScLookupCache);
+        StartListeningArea(rRange, false, findIt->second.get());
     }
-    else
-        pCache = (*findIt).second.get();
-
-    return *pCache;
+    return *findIt->second;
 }
 
 ScSortedRangeCache& ScDocument::GetSortedRangeCache( const ScRange & rRange, const ScQueryParam& param,
@@ -1288,10 +1292,8 @@ void ScDocument::RemoveSortedRangeCache( ScSortedRangeCache & rCache )
 void ScDocument::ClearLookupCaches()
 {
     assert(!IsThreadedGroupCalcInProgress());
-    GetNonThreadedContext().mxScLookupCache.reset();
+    mxScLookupCache->aCacheMap.clear();
     mxScSortedRangeCache->aCacheMap.clear();
-    // Clear lookup cache in all interpreter-contexts in the (threaded/non-threaded) pools.
-    ScInterpreterContextPool::ClearLookupCaches(this);
 }
 
 bool ScDocument::IsCellInChangeTrack(const ScAddress &cell,Color *pColCellBorder)
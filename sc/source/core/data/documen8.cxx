@@ -428,6 +428,24 @@ void ScDocument::CalculateInColumnInThread( ScInterpreterContext& rContext, cons
         maThreadSpecific.xRecursionHelper->Clear();
 }
 
+void ScDocument::CalculateInColumnInThread( ScInterpreterContext& rContext, const ScRange& rCalcRange, unsigned nThisThread,
+                                            sc::FormulaGroupWorkStealingScheduler& rScheduler )
+{
+    ScTable* pTab = FetchTable(rCalcRange.aStart.Tab());
+    if (!pTab)
+        return;
+
+    assert(IsThreadedGroupCalcInProgress());
+
+    maThreadSpecific.pContext = &rContext;
+    pTab->CalculateInColumnInThread(rContext, rCalcRange.aStart.Col(), rCalcRange.aEnd.Col(), rCalcRange.aStart.Row(), rCalcRange.aEnd.Row(), nThisThread, rScheduler);
+
+    assert(IsThreadedGroupCalcInProgress());
+    maThreadSpecific.pContext = nullptr;
+    if(maThreadSpecific.xRecursionHelper)
+        maThreadSpecific.xRecursionHelper->Clear();
+}
+
 void ScDocument::HandleStuffAfterParallelCalculation( SCCOL nColStart, SCCOL nColEnd, SCROW nRow, size_t nLen, SCTAB nTab, ScInterpreter* pInterpreter )
 {
     assert(!IsThreadedGroupCalcInProgress());
@@ -813,6 +831,8 @@ void ScDocument::UpdateExternalRefLinks(weld::Window* pWin)
     weld::WaitObject aWaitSwitch(pWin);
 
     pExternalRefMgr->enableDocTimer(false);
+    // Cells referencing several of the documents are updated only once, after the loop.
+    pExternalRefMgr->deferRefCellRefresh(true);
     ScProgress aProgress(GetDocumentShell(), ScResId(SCSTR_UPDATE_EXTDOCS), aRefLinks.size(), true);
     for (size_t i = 0, n = aRefLinks.size(); i < n; ++i)
     {
@@ -842,6 +862,7 @@ void ScDocument::UpdateExternalRefLinks(weld::Window* pWin)
         xBox->run();
     }
 
+    pExternalRefMgr->deferRefCellRefresh(false);
     pExternalRefMgr->enableDocTimer(true);
 
     if (!bAny)
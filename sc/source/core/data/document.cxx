@@ -84,6 +84,7 @@
 #include <scopetools.hxx>
 #include <refupdatecontext.hxx>
 #include <formulagroup.hxx>
+#include <formulagroupprofiler.hxx>
 #include <tokenstringcontext.hxx>
 #include <compressedarray.hxx>
 #include <recursionhelper.hxx>
@@ -93,8 +94,10 @@
 
 #include <formula/vectortoken.hxx>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include <comphelper/lok.hxx>
@@ -3582,6 +3585,22 @@ std::shared_ptr<sc::FormulaGroupContext>& ScDocument::GetFormulaGroupContext()
     return mpFormulaGroupCxt;
 }
 
+sc::FormulaGroupProfiler& ScDocument::GetFormulaGroupProfiler()
+{
+    if (!mpFormulaGroupProfiler)
+        mpFormulaGroupProfiler.reset(new sc::FormulaGroupProfiler);
+
+    return *mpFormulaGroupProfiler;
+}
+
+sc::FormulaGroupProfiler* ScDocument::GetRecordingFormulaGroupProfiler()
+{
+    if (!mpFormulaGroupProfiler || !mpFormulaGroupProfiler->isEnabled() || IsThreadedGroupCalcInProgress())
+        return nullptr;
+
+    return mpFormulaGroupProfiler.get();
+}
+
 void ScDocument::DiscardFormulaGroupContext()
 {
     assert(!IsThreadedGroupCalcInProgress());
@@ -3720,6 +3739,21 @@ sal_uInt32 ScDocument::GetNumberFormat( const ScRange& rRange ) const
     return nFormat;
 }
 
+bool ScDocument::HasOnlyGeneralNumberFormat( const ScRange& rRange ) const
+{
+    for (SCTAB nTab = rRange.aStart.Tab(); nTab <= rRange.aEnd.Tab(); ++nTab)
+    {
+        const ScTable* pTab = FetchTable(nTab);
+        if (!pTab)
+            return false;
+
+        if (!pTab->HasOnlyGeneralNumberFormat(rRange.aStart.Col(), rRange.aStart.Row(),
+                                              rRange.aEnd.Col(), rRange.aEnd.Row()))
+            return false;
+    }
+    return true;
+}
+
 sal_uInt32 ScDocument::GetNumberFormat( const ScInterpreterContext& rContext, const ScAddress& rPos ) const
 {
     SCTAB nTab = rPos.Tab();
@@ -4004,11 +4038,8 @@ void ScDocument::CalcAll()
         if (a)
             a->SetDirtyVar();
     }
-    for (const auto& a : maTabs)
-    {
-        if (a)
-            a->CalcAll();
-    }
+    for (SCTAB nTab : GetCalcAllTabOrder())
+        maTabs[nTab]->CalcAll();
     ClearFormulaTree();
 
     // In eternal hard recalc state caches were not added as listeners,
@@ -4018,6 +4049,82 @@ void ScDocument::CalcAll()
         ClearLookupCaches();
 }
 
+std::vector<SCTAB> ScDocument::GetCalcAllTabOrder() const
+{
+    const SCTAB nTabCount = GetTableCount();
+    std::vector<SCTAB> aOrder;
+    aOrder.reserve(nTabCount);
+    for (SCTAB nTab = 0; nTab < nTabCount; ++nTab)
+    {
+        if (maTabs[nTab])
+            aOrder.push_back(nTab);
+    }
+
+    // Calculating a sheet a formula depends on from within that formula
+    // means deep recursion, and the formula groups encountered there can't
+    // be calculated threaded.  Iterative calculation results may depend on
+    // the order, keep that as it always was.
+    if (aOrder.size() < 2 || GetDocOptions().IsIter())
+        return aOrder;
+
+    // aUsedBy[nTab] are the sheets with formulas referencing sheet nTab.
+    std::vector<std::vector<SCTAB>> aUsedBy(nTabCount);
+    std::vector<size_t> aInDegree(nTabCount, 0);
+    for (SCTAB nTab : aOrder)
+    {
+        std::set<SCTAB> aRefTabs;
+        bool bUnknown = false;
+        maTabs[nTab]->CollectReferencedTabs(aRefTabs, bUnknown);
+        if (bUnknown)
+            return aOrder;
+
+        for (SCTAB nRefTab : aRefTabs)
+        {
+            if (nRefTab == nTab || nRefTab >= nTabCount || !maTabs[nRefTab])
+                continue;
+            aUsedBy[nRefTab].push_back(nTab);
+            ++aInDegree[nTab];
+        }
+    }
+
+    // Kahn's algorithm, level by level, each level in document order.
+    std::vector<SCTAB> aSorted;
+    aSorted.reserve(aOrder.size());
+    std::vector<SCTAB> aLevel;
+    for (SCTAB nTab : aOrder)
+    {
+        if (aInDegree[nTab] == 0)
+            aLevel.push_back(nTab);
+    }
+
+    size_t nLevels = 0;
+    while (!aLevel.empty())
+    {
+        ++nLevels;
+        aSorted.insert(aSorted.end(), aLevel.begin(), aLevel.end());
+        std::vector<SCTAB> aNextLevel;
+        for (SCTAB nTab : aLevel)
+        {
+            for (SCTAB nUser : aUsedBy[nTab])
+            {
+                if (--aInDegree[nUser] == 0)
+                    aNextLevel.push_back(nUser);
+            }
+        }
+        std::sort(aNextLevel.begin(), aNextLevel.end());
+        aLevel.swap(aNextLevel);
+    }
+
+    if (aSorted.size() != aOrder.size())
+    {
+        SAL_INFO("sc.core", "GetCalcAllTabOrder: sheets depend on each other circularly, using document order");
+        return aOrder;
+    }
+
+    SAL_INFO("sc.core", "GetCalcAllTabOrder: " << aSorted.size() << " sheets in " << nLevels << " dependency levels");
+    return aSorted;
+}
+
 void ScDocument::CompileAll()
 {
     sc::CompileFormulaContext aCxt(*this);
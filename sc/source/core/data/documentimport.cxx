@@ -261,6 +261,14 @@ void ScDocumentImport::setNumericCell(const ScAddress& rPos, double fVal)
 
 void ScDocumentImport::setStringCell(const ScAddress& rPos, const OUString& rStr)
 {
+    setStringCell(rPos, mpImpl->mrDoc.GetSharedStringPool().intern(rStr));
+}
+
+void ScDocumentImport::setStringCell(const ScAddress& rPos, const svl::SharedString& rStr)
+{
+    if (!rStr.getData())
+        return;
+
     ScTable* pTab = mpImpl->mrDoc.FetchTable(rPos.Tab());
     if (!pTab)
         return;
@@ -270,12 +278,8 @@ void ScDocumentImport::setStringCell(const ScAddress& rPos, const OUString& rStr
     if (!pBlockPos)
         return;
 
-    svl::SharedString aSS = mpImpl->mrDoc.GetSharedStringPool().intern(rStr);
-    if (!aSS.getData())
-        return;
-
     sc::CellStoreType& rCells = pTab->aCol[rPos.Col()].maCells;
-    pBlockPos->miCellPos = rCells.set(pBlockPos->miCellPos, rPos.Row(), aSS);
+    pBlockPos->miCellPos = rCells.set(pBlockPos->miCellPos, rPos.Row(), rStr);
 }
 
 void ScDocumentImport::setEditCell(const ScAddress& rPos, std::unique_ptr<EditTextObject> pEditText)
@@ -784,6 +788,12 @@ void ScDocumentImport::initColumn(ScColumn& rCol)
     std::for_each(rCol.maCells.begin(), rCol.maCells.end(), aFunc);
     aFunc.swap(rCol.maCellTextAttrs);
 
+    // Cells are appended one at a time during import, which leaves the
+    // element blocks with up to twice the capacity they need. Trim them,
+    // this matters for large documents and is cheap compared to the import.
+    rCol.maCells.shrink_to_fit();
+    rCol.maCellTextAttrs.shrink_to_fit();
+
     rCol.CellStorageModified();
 }
 
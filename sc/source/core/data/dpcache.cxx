@@ -31,8 +31,11 @@
 #include <dpnumgroupinfo.hxx>
 #include <columniterator.hxx>
 #include <cellvalue.hxx>
+#include <interpretercontext.hxx>
+#include <rangelst.hxx>
 
 #include <comphelper/parallelsort.hxx>
+#include <comphelper/threadpool.hxx>
 #include <rtl/math.hxx>
 #include <unotools/charclass.hxx>
 #include <unotools/textsearch.hxx>
@@ -47,17 +50,6 @@
 #include <com/sun/star/sheet/DataPilotFieldGroupBy.hpp>
 #endif
 
-// TODO : Threaded pivot cache operation is disabled until we can figure out
-// ways to make the edit engine and number formatter codes thread-safe in a
-// proper fashion.
-#define ENABLE_THREADED_PIVOT_CACHE 0
-
-#if ENABLE_THREADED_PIVOT_CACHE
-#include <thread>
-#include <future>
-#include <queue>
-#endif
-
 using namespace ::com::sun::star;
 
 using ::com::sun::star::uno::Exception;
@@ -141,20 +133,20 @@ OUString createLabelString( const ScDocument& rDoc, SCCOL nCol, const ScRefCellV
 }
 
 void initFromCell(
-    ScDPCache::StringSetType& rStrPool, const ScDocument& rDoc, const ScAddress& rPos,
-    const ScRefCellValue& rCell, ScDPItemData& rData, sal_uInt32& rNumFormat)
+    ScDPCache::StringSetType& rStrPool, const ScDocument& rDoc, const ScInterpreterContext& rContext,
+    const ScAddress& rPos, const ScRefCellValue& rCell, ScDPItemData& rData, sal_uInt32& rNumFormat)
 {
     OUString aDocStr = rCell.getRawString(rDoc);
     rNumFormat = 0;
 
     if (rCell.hasError())
     {
-        rData.SetErrorStringInterned(internString(rStrPool, rDoc.GetString(rPos.Col(), rPos.Row(), rPos.Tab())));
+        rData.SetErrorStringInterned(internString(rStrPool, rDoc.GetString(rPos.Col(), rPos.Row(), rPos.Tab(), &rContext)));
     }
     else if (rCell.hasNumeric())
     {
         double fVal = rCell.getRawValue();
-        rNumFormat = rDoc.GetNumberFormat(rPos);
+        rNumFormat = rDoc.GetNumberFormat(rContext, rPos);
         rData.SetValue(fVal);
     }
     else if (!rCell.isEmpty())
@@ -245,13 +237,26 @@ public:
     }
 };
 
-void processBuckets(std::vector<Bucket>& aBuckets, ScDPCache::Field& rField)
+/**
+ * Sort the buckets, on the shared thread pool unless the caller itself
+ * already runs in one of its workers.
+ */
+template<typename Compare>
+void sortBuckets(std::vector<Bucket>& aBuckets, Compare aComp, bool bParallel)
+{
+    if (bParallel)
+        comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), aComp);
+    else
+        std::sort(aBuckets.begin(), aBuckets.end(), aComp);
+}
+
+void processBuckets(std::vector<Bucket>& aBuckets, ScDPCache::Field& rField, bool bParallelSort = true)
 {
     if (aBuckets.empty())
         return;
 
     // Sort by the value.
-    comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), LessByValue());
+    sortBuckets(aBuckets, LessByValue(), bParallelSort);
 
     {
         // Set order index such that unique values have identical index value.
@@ -270,14 +275,14 @@ void processBuckets(std::vector<Bucket>& aBuckets, ScDPCache::Field& rField)
     }
 
     // Re-sort the bucket this time by the data index.
-    comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), LessByDataIndex());
+    sortBuckets(aBuckets, LessByDataIndex(), bParallelSort);
 
     // Copy the order index series into the field object.
     rField.maData.reserve(aBuckets.size());
     std::for_each(aBuckets.begin(), aBuckets.end(), PushBackOrderIndex(rField.maData));
 
     // Sort by the value again.
-    comphelper::parallelSort(aBuckets.begin(), aBuckets.end(), LessByOrderIndex());
+    sortBuckets(aBuckets, LessByOrderIndex(), bParallelSort);
 
     // Unique by value.
     std::vector<Bucket>::iterator itUniqueEnd =
@@ -385,7 +390,13 @@ std::vector<OUString> normalizeLabels(const ScDPCache::DBConnector& rDB, const s
     return aLabels;
 }
 
-void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
+/**
+ * Fill the field of one column.  The column label has already been taken
+ * from the first cell by the caller; this may run on a worker thread, so
+ * everything that needs the number formatter goes through rContext.
+ */
+void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData,
+                        const ScInterpreterContext& rContext, bool bParallelSort )
 {
     ScDPCache::Field& rField = *rColData.mpField;
     ScDocument& rDoc = rDocData.mrDoc;
@@ -402,8 +413,7 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
 
     ScDPItemData aData;
 
-    rColData.maLabel = createLabelString(rDoc, nCol, pIter->getCell());
-    pIter->next();
+    pIter->next(); // skip the label cell.
 
     std::vector<Bucket> aBuckets;
     aBuckets.reserve(nEndRow-nStartRow); // skip the topmost label cell.
@@ -415,7 +425,7 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
 
         sal_uInt32 nNumFormat = 0;
         ScAddress aPos(nCol, pIter->getRow(), nDocTab);
-        initFromCell(*rColData.mpStrPool, rDoc, aPos, pIter->getCell(), aData, nNumFormat);
+        initFromCell(*rColData.mpStrPool, rDoc, rContext, aPos, pIter->getCell(), aData, nNumFormat);
 
         aBuckets.emplace_back(aData, i);
 
@@ -428,7 +438,7 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
         }
     }
 
-    processBuckets(aBuckets, rField);
+    processBuckets(aBuckets, rField, bParallelSort);
 
     if (bTailEmptyRows)
     {
@@ -442,68 +452,26 @@ void initColumnFromDoc( InitDocData& rDocData, InitColumnData &rColData )
     }
 }
 
-#if ENABLE_THREADED_PIVOT_CACHE
-
-class ThreadQueue
+class InitColumnTask : public comphelper::ThreadTask
 {
-    using FutureType = std::future<void>;
-    std::queue<FutureType> maQueue;
-    std::mutex maMutex;
-    std::condition_variable maCond;
-
-    size_t mnMaxQueue;
+    InitDocData& mrDocData;
+    InitColumnData& mrColData;
+    const ScInterpreterContext& mrContext;
 
 public:
-    ThreadQueue( size_t nMaxQueue ) : mnMaxQueue(nMaxQueue) {}
+    InitColumnTask(const std::shared_ptr<comphelper::ThreadTaskTag>& rTag, InitDocData& rDocData,
+                   InitColumnData& rColData, const ScInterpreterContext& rContext) :
+        comphelper::ThreadTask(rTag), mrDocData(rDocData), mrColData(rColData), mrContext(rContext) {}
 
-    void push( std::function<void()> aFunc )
+    virtual void doWork() override
     {
-        std::unique_lock<std::mutex> lock(maMutex);
-
-        while (maQueue.size() >= mnMaxQueue)
-            maCond.wait(lock);
-
-        FutureType f = std::async(std::launch::async, aFunc);
-        maQueue.push(std::move(f));
-        lock.unlock();
-
-        maCond.notify_one();
-    }
-
-    void waitForOne()
-    {
-        std::unique_lock<std::mutex> lock(maMutex);
-
-        while (maQueue.empty())
-            maCond.wait(lock);
-
-        FutureType ret = std::move(maQueue.front());
-        maQueue.pop();
-        lock.unlock();
-
-        ret.get(); // This may throw if an exception was thrown on the async thread.
-
-        maCond.notify_one();
+        // Already on a worker, so the buckets cannot be sorted on the pool as well.
+        initColumnFromDoc(mrDocData, mrColData, mrContext, false);
     }
 };
 
-class ThreadScopedGuard
-{
-    std::thread maThread;
-public:
-    ThreadScopedGuard(std::thread thread) : maThread(std::move(thread)) {}
-    ThreadScopedGuard(ThreadScopedGuard&& other) : maThread(std::move(other.maThread)) {}
-
-    ThreadScopedGuard(const ThreadScopedGuard&) = delete;
-    ThreadScopedGuard& operator= (const ThreadScopedGuard&) = delete;
-
-    ~ThreadScopedGuard()
-    {
-        maThread.join();
-    }
-};
-
-#endif
+/// Below this many source cells building the fields one after the other is fast enough.
+constexpr size_t nMinCellsForThreadedInit = 65536;
 
 }
 
@@ -562,46 +530,54 @@ void ScDPCache::InitFromDoc(ScDocument& rDoc, const ScRange& rRange)
     // Ensure that none of the formula cells in the data range are dirty.
     rDoc.EnsureFormulaCellResults(rRange);
 
-#if ENABLE_THREADED_PIVOT_CACHE
-    ThreadQueue aQueue(std::thread::hardware_concurrency());
+    for (SCCOL nCol = nStartCol; nCol <= nEndCol; ++nCol)
+    {
+        size_t nDim = nCol - nStartCol;
+        InitColumnData& rColData = aColData[nDim];
+        rColData.init(nCol, &maStringPools[nDim], maFields[nDim].get());
+        rColData.maLabel = createLabelString(
+            rDoc, nCol, rDoc.GetRefCellValue(ScAddress(nCol, aDocData.mnStartRow, aDocData.mnDocTab)));
+    }
 
-    auto aFuncLaunchFieldThreads = [&]()
+    comphelper::ThreadPool& rThreadPool(comphelper::ThreadPool::getSharedOptimalPool());
+    const sal_Int32 nThreadCount = rThreadPool.getWorkerCount();
+
+    // One task per column; the workers only read the cells, so every formula
+    // cell has to have its result already.
+    bool bThreaded = mnColumnCount > 1 && nThreadCount > 1
+        && static_cast<size_t>(mnColumnCount) * (aDocData.mnEndRow - aDocData.mnStartRow) >= nMinCellsForThreadedInit
+        && !rDoc.IsThreadedGroupCalcInProgress()
+        && rDoc.InterpretCellsIfNeeded(ScRangeList(rRange));
+
+    if (bThreaded)
     {
-        for (sal_uInt16 nCol = nStartCol; nCol <= nEndCol; ++nCol)
+        SvNumberFormatter* pNonThreadedFormatter = rDoc.GetNonThreadedContext().GetFormatTable();
+        rDoc.SetThreadedGroupCalcInProgress(true);
         {
-            size_t nDim = nCol - nStartCol;
-            InitColumnData& rColData = aColData[nDim];
-            rColData.init(nCol, &maStringPools[nDim], maFields[nDim].get());
+            ScMutationDisable aGuard(rDoc, ScMutationGuardFlags::CORE);
 
-            auto func = [&aDocData,&rColData]()
+            std::shared_ptr<comphelper::ThreadTaskTag> aTag = comphelper::ThreadPool::createThreadTaskTag();
+            ScThreadedInterpreterContextGetterGuard aContextGetterGuard(mnColumnCount, rDoc, pNonThreadedFormatter);
+            for (SCCOL i = 0; i < mnColumnCount; ++i)
             {
-                initColumnFromDoc(aDocData, rColData);
-            };
-
-            aQueue.push(std::move(func));
-        }
-    };
+                ScInterpreterContext* pContext = aContextGetterGuard.GetInterpreterContextForThreadIdx(i);
+                rDoc.SetupContextFromNonThreadedContext(*pContext, i);
+                rThreadPool.pushTask(std::make_unique<InitColumnTask>(aTag, aDocData, aColData[i], *pContext));
+            }
+            rThreadPool.waitUntilDone(aTag, false);
 
-    {
-        // Launch a separate thread that in turn spawns async threads to populate the fields.
-        std::thread t(aFuncLaunchFieldThreads);
-        ThreadScopedGuard sg(std::move(t));
+            rDoc.SetThreadedGroupCalcInProgress(false);
 
-        // Wait for all the async threads to complete on the main thread.
-        for (SCCOL i = 0; i < mnColumnCount; ++i)
-            aQueue.waitForOne();
+            for (SCCOL i = 0; i < mnColumnCount; ++i)
+                rDoc.MergeContextBackIntoNonThreadedContext(
+                    *aContextGetterGuard.GetInterpreterContextForThreadIdx(i), i);
+        }
     }
-
-#else
-    for (sal_uInt16 nCol = nStartCol; nCol <= nEndCol; ++nCol)
+    else
     {
-        size_t nDim = nCol - nStartCol;
-        InitColumnData& rColData = aColData[nDim];
-        rColData.init(nCol, &maStringPools[nDim], maFields[nDim].get());
-
-        initColumnFromDoc(aDocData, rColData);
+        for (InitColumnData& rColData : aColData)
+            initColumnFromDoc(aDocData, rColData, rDoc.GetNonThreadedContext(), true);
     }
-#endif
 
     maLabelNames = normalizeLabels(aColData);
 
@@ -55,6 +55,8 @@
 #include <svl/intitem.hxx>
 #include <svl/numformat.hxx>
 #include <formulagroup.hxx>
+#include <formulagroupprofiler.hxx>
+#include <formulagroupscheduler.hxx>
 #include <listenercontext.hxx>
 #include <types.hxx>
 #include <scopetools.hxx>
@@ -913,6 +915,43 @@ ScFormulaCell::ScFormulaCell(const ScFormulaCell& rCell, ScDocument& rDoc, const
         rDocument.AddSubTotalCell(this);
 }
 
+ScFormulaCell::ScFormulaCell(const ScFormulaCell& rCell, ScDocument& rDoc, const ScAddress& rPos,
+        const ScFormulaCellGroupRef& xGroup) :
+    mxGroup(xGroup),
+    bDirty( rCell.bDirty ),
+    bTableOpDirty( false ),
+    bChanged( rCell.bChanged ),
+    bRunning( false ),
+    bCompile( false ),
+    bSubTotal( rCell.bSubTotal ),
+    bIsIterCell( false ),
+    bInChangeTrack( false ),
+    bNeedListening( false ),
+    mbNeedsNumberFormat( rCell.mbNeedsNumberFormat ),
+    mbAllowNumberFormatChange(false),
+    mbPostponedDirty(false),
+    mbIsExtRef(false),
+    mbSeenInPath(false),
+    mbFreeFlying(false),
+    cMatrixFlag ( rCell.cMatrixFlag ),
+    nSeenInIteration(0),
+    nFormatType( rCell.nFormatType ),
+    aResult( rCell.aResult ),
+    eTempGrammar( rCell.eTempGrammar),
+    pCode( &*xGroup->mpCode ),
+    rDocument( rDoc ),
+    pPrevious(nullptr),
+    pNext(nullptr),
+    pPreviousTrack(nullptr),
+    pNextTrack(nullptr),
+    aPos(rPos)
+{
+    assert(xGroup->mpCode);
+
+    if (bSubTotal)
+        rDocument.AddSubTotalCell(this);
+}
+
 ScFormulaCell::~ScFormulaCell()
 {
     rDocument.RemoveFromFormulaTrack( this );
@@ -1246,7 +1285,8 @@ void ScFormulaCell::CompileTokenArray( sc::CompileFormulaContext& rCxt, bool bNo
     }
 }
 
-void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress )
+void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress,
+                                const ScFormulaCell* pLastCell )
 {
     if ( cMatrixFlag == ScMatrixMode::Reference )
     {   // is already token code via ScDocFunc::EnterMatrix, ScDocument::InsertMatrixFormula
@@ -1277,21 +1317,27 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
 
     if ( !mxGroup && aFormulaNmsp.isEmpty() ) // optimization
     {
-        ScAddress aPreviousCell( aPos );
-        aPreviousCell.IncRow( -1 );
-        ScFormulaCell *pPreviousCell = rDocument.GetFormulaCell( aPreviousCell );
-        if (pPreviousCell && pPreviousCell->GetCode()->IsShareable())
+        // Whether rCell has the same formula as this cell relative to its position.
+        auto lcl_IsSameFormula = [&](const ScFormulaCell& rCell)
         {
-            // Build formula string using the tokens from the previous cell,
-            // but use the current cell position.
-            ScCompiler aBackComp( rCxt, aPos, *(pPreviousCell->pCode) );
+            // Build formula string using the tokens from rCell, but use the
+            // current cell position.
+            ScCompiler aBackComp( rCxt, aPos, *rCell.pCode );
             OUStringBuffer aShouldBeBuf;
             aBackComp.CreateStringFromTokenArray( aShouldBeBuf );
 
             // The initial '=' is optional in ODFF.
             const sal_Int32 nLeadingEqual = (aFormula.getLength() > 0 && aFormula[0] == '=') ? 1 : 0;
-            if (aFormula.getLength() == aShouldBeBuf.getLength() + nLeadingEqual &&
-                    aFormula.match( aShouldBeBuf, nLeadingEqual))
+            return aFormula.getLength() == aShouldBeBuf.getLength() + nLeadingEqual &&
+                    aFormula.match( aShouldBeBuf, nLeadingEqual);
+        };
+
+        ScAddress aPreviousCell( aPos );
+        aPreviousCell.IncRow( -1 );
+        ScFormulaCell *pPreviousCell = rDocument.GetFormulaCell( aPreviousCell );
+        if (pPreviousCell && pPreviousCell->GetCode()->IsShareable())
+        {
+            if (lcl_IsSameFormula(*pPreviousCell))
             {
                 // Put them in the same formula group.
                 ScFormulaCellGroupRef xGroup = pPreviousCell->GetCellGroup();
@@ -1316,6 +1362,25 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
                     rDocument.GetExternalRefManager()->insertRefCellFromTemplate( pPreviousCell, this );
             }
         }
+        else if (!pPreviousCell && pLastCell && pLastCell->GetCode()->IsShareable()
+                 && !pLastCell->mbIsExtRef && pLastCell->pCode->GetCodeError() == FormulaError::NONE
+                 && cMatrixFlag == ScMatrixMode::NONE && pLastCell->cMatrixFlag == ScMatrixMode::NONE
+                 && lcl_IsSameFormula(*pLastCell))
+        {
+            // Same formula further up, but not adjacent, so can't be in the
+            // same group. Copy its compiled tokens instead of compiling again.
+            nFormatType = pLastCell->nFormatType;
+            bSubTotal = pLastCell->bSubTotal;
+            bChanged = true;
+            bCompile = false;
+
+            if (bSubTotal)
+                rDocument.AddSubTotalCell(this);
+
+            bDoCompile = false;
+            delete pCode;
+            pCode = pLastCell->pCode->Clone().release();
+        }
     }
 
     if (bDoCompile)
@@ -2581,7 +2646,7 @@ void ScFormulaCell::ResetTableOpDirtyVar()
     bTableOpDirty = false;
 }
 
-void ScFormulaCell::SetTableOpDirty()
+void ScFormulaCell::SetTableOpDirty( bool bTrack )
 {
     if ( IsInChangeTrack() )
         return;
@@ -2598,7 +2663,8 @@ void ScFormulaCell::SetTableOpDirty()
                 bTableOpDirty = true;
             }
             rDocument.AppendToFormulaTrack( this );
-            rDocument.TrackFormulas( SfxHintId::ScTableOpDirty );
+            if ( bTrack )
+                rDocument.TrackFormulas( SfxHintId::ScTableOpDirty );
         }
     }
 }
@@ -4597,6 +4663,12 @@ struct ScDependantsCalculator
 
 } // anonymous namespace
 
+static void lcl_SetFallbackReason(ScDocument& rDoc, const char* pReason)
+{
+    if (sc::FormulaGroupProfiler* pProfiler = rDoc.GetRecordingFormulaGroupProfiler())
+        pProfiler->setFallbackReason(pReason);
+}
+
 bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
 {
     if (!mxGroup || !pCode)
@@ -4605,9 +4677,14 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     auto aScope = sc::FormulaLogger::get().enterGroup(rDocument, *this);
     ScRecursionHelper& rRecursionHelper = rDocument.GetRecursionHelper();
 
+    sc::FormulaGroupProfiler::GroupScope aProfileScope;
+    if (sc::FormulaGroupProfiler* pProfiler = rDocument.GetRecordingFormulaGroupProfiler())
+        aProfileScope.start(*pProfiler, mxGroup->mpTopCell->aPos, mxGroup->mnLength);
+
     if (mxGroup->mbPartOfCycle)
     {
         aScope.addMessage("This formula-group is part of a cycle");
+        lcl_SetFallbackReason(rDocument, "part of a cycle");
         return false;
     }
 
@@ -4615,6 +4692,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     {
         static constexpr OUStringLiteral MESSAGE = u"group calc disabled";
         aScope.addMessage(MESSAGE);
+        lcl_SetFallbackReason(rDocument, "group calc disabled");
         return false;
     }
 
@@ -4627,6 +4705,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         aScope.addGroupSizeThresholdMessage(*this);
+        lcl_SetFallbackReason(rDocument, "group too small");
         return false;
     }
 
@@ -4634,6 +4713,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         aScope.addMessage("matrix skipped");
+        lcl_SetFallbackReason(rDocument, "matrix formula");
         return false;
     }
 
@@ -4648,6 +4728,7 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
         {
             mxGroup->meCalcState = sc::GroupCalcDisabled;
             aScope.addMessage("cell not in document");
+            lcl_SetFallbackReason(rDocument, "cell not in document");
             return false;
         }
     }
@@ -4664,7 +4745,10 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     }
 
     if (nEndOffset == nStartOffset && forceType == ForceCalculationNone)
+    {
+        lcl_SetFallbackReason(rDocument, "single row");
         return false; // Do not use threads for a single row.
+    }
 
     // Guard against endless recursion of Interpret() calls, for this to work
     // ScFormulaCell::InterpretFormulaGroup() must never be called through
@@ -4675,14 +4759,34 @@ bool ScFormulaCell::InterpretFormulaGroup(SCROW nStartOffset, SCROW nEndOffset)
     bool bDependencyComputed = false;
     bool bDependencyCheckFailed = false;
 
-    // Preference order: First try OpenCL, then threading.
+    // Preference order: First try OpenCL, then the CPU vector code, then threading.
     // TODO: Do formula-group span computation for OCL too if nStartOffset/nEndOffset are non default.
     if( InterpretFormulaGroupOpenCL(aScope, bDependencyComputed, bDependencyCheckFailed))
+    {
+        aProfileScope.setPath(sc::FormulaGroupCalcPath::OpenCL);
+        return true;
+    }
+
+    if( InterpretFormulaGroupCPU(aScope, bDependencyComputed, bDependencyCheckFailed))
+    {
+        aProfileScope.setPath(sc::FormulaGroupCalcPath::Vector);
         return true;
+    }
 
     if( InterpretFormulaGroupThreading(aScope, bDependencyComputed, bDependencyCheckFailed, nStartOffset, nEndOffset))
+    {
+        aProfileScope.setPath(sc::FormulaGroupCalcPath::Threaded);
         return true;
+    }
 
+    // A failed dependency check gave its own reason already.
+    if (!bDependencyCheckFailed)
+    {
+        if (!pCode->IsEnabledForThreading())
+            lcl_SetFallbackReason(rDocument, "formula not supported by threaded calculation");
+        else
+            lcl_SetFallbackReason(rDocument, "threaded calculation disabled");
+    }
     return false;
 }
 
@@ -4711,6 +4815,7 @@ bool ScFormulaCell::CheckComputeDependencies(sc::FormulaLogger::GroupScope& rSco
         {
             mxGroup->meCalcState = sc::GroupCalcDisabled;
             rScope.addMessage("found circular formula-group dependencies");
+            lcl_SetFallbackReason(rDocument, "circular formula group dependencies");
             return false;
         }
 
@@ -4724,6 +4829,7 @@ bool ScFormulaCell::CheckComputeDependencies(sc::FormulaLogger::GroupScope& rSco
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         rScope.addMessage("Recursion limit reached, cannot thread this formula group now");
+        lcl_SetFallbackReason(rDocument, "recursion limit reached");
         return false;
     }
 
@@ -4731,6 +4837,7 @@ bool ScFormulaCell::CheckComputeDependencies(sc::FormulaLogger::GroupScope& rSco
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         rScope.addMessage("found circular formula-group dependencies");
+        lcl_SetFallbackReason(rDocument, "circular formula group dependencies");
         return false;
     }
 
@@ -4739,6 +4846,7 @@ bool ScFormulaCell::CheckComputeDependencies(sc::FormulaLogger::GroupScope& rSco
         // This call resulted from a dependency calculation for a multigroup-threading attempt,
         // but found dependency among the groups.
         rScope.addMessage("multi-group-dependency failed");
+        lcl_SetFallbackReason(rDocument, "dependency among neighbouring groups");
         return false;
     }
 
@@ -4746,6 +4854,7 @@ bool ScFormulaCell::CheckComputeDependencies(sc::FormulaLogger::GroupScope& rSco
     {
         mxGroup->meCalcState = sc::GroupCalcDisabled;
         rScope.addMessage("could not do new dependencies calculation thing");
+        lcl_SetFallbackReason(rDocument, "dependencies could not be calculated");
         return false;
     }
 
@@ -4845,6 +4954,7 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
             SCCOL mnEndCol;
             SCROW mnStartOffset;
             SCROW mnEndOffset;
+            sc::FormulaGroupWorkStealingScheduler* mpScheduler;
 
         public:
             Executor(const std::shared_ptr<comphelper::ThreadTaskTag>& rTag,
@@ -4856,7 +4966,8 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                      SCCOL nStartCol,
                      SCCOL nEndCol,
                      SCROW nStartOff,
-                     SCROW nEndOff) :
+                     SCROW nEndOff,
+                     sc::FormulaGroupWorkStealingScheduler* pScheduler) :
                 comphelper::ThreadTask(rTag),
                 mnThisThread(nThisThread),
                 mnThreadsTotal(nThreadsTotal),
@@ -4866,7 +4977,8 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                 mnStartCol(nStartCol),
                 mnEndCol(nEndCol),
                 mnStartOffset(nStartOff),
-                mnEndOffset(nEndOff)
+                mnEndOffset(nEndOff),
+                mpScheduler(pScheduler)
             {
             }
 
@@ -4874,7 +4986,10 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
             {
                 ScRange aCalcRange(mnStartCol, mrTopPos.Row() + mnStartOffset, mrTopPos.Tab(),
                                    mnEndCol, mrTopPos.Row() + mnEndOffset, mrTopPos.Tab());
-                mpDocument->CalculateInColumnInThread(*mpContext, aCalcRange, mnThisThread, mnThreadsTotal);
+                if (mpScheduler)
+                    mpDocument->CalculateInColumnInThread(*mpContext, aCalcRange, mnThisThread, *mpScheduler);
+                else
+                    mpDocument->CalculateInColumnInThread(*mpContext, aCalcRange, mnThisThread, mnThreadsTotal);
             }
 
         };
@@ -4916,6 +5031,17 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
             }
         }
 
+        // With uneven per-row costs the fixed interleaved distribution leaves
+        // threads idle, so optionally let the workers take small chunks and
+        // steal from each other.
+        static const bool bWorkStealing = std::getenv("SC_THREADED_CALC_WORK_STEALING");
+        std::unique_ptr<sc::FormulaGroupWorkStealingScheduler> pScheduler;
+        if (bWorkStealing)
+        {
+            const size_t nCellCount = static_cast<size_t>(nEndOffset - nStartOffset + 1) * (nColEnd - nColStart + 1);
+            pScheduler = std::make_unique<sc::FormulaGroupWorkStealingScheduler>(nCellCount, nThreadCount);
+        }
+
         std::vector<std::unique_ptr<ScInterpreter>> aInterpreters(nThreadCount);
         {
             assert(!rDocument.IsThreadedGroupCalcInProgress());
@@ -4936,7 +5062,8 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
                 context->pInterpreter = aInterpreters[i].get();
                 rDocument.SetupContextFromNonThreadedContext(*context, i);
                 rThreadPool.pushTask(std::make_unique<Executor>(aTag, i, nThreadCount, &rDocument, context, mxGroup->mpTopCell->aPos,
-                                                                nColStart, nColEnd, nStartOffset, nEndOffset));
+                                                                nColStart, nColEnd, nStartOffset, nEndOffset,
+                                                                pScheduler.get()));
             }
 
             SAL_INFO("sc.threaded", "Waiting for threads to finish work");
@@ -4946,6 +5073,13 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
 
             rDocument.SetThreadedGroupCalcInProgress(false);
 
+            if (pScheduler)
+            {
+                const std::string aStats = pScheduler->dumpStats();
+                SAL_INFO("sc.threaded", aStats);
+                aScope.addMessage(OUString::createFromAscii(aStats.c_str()));
+            }
+
             for (int i = 0; i < nThreadCount; ++i)
             {
                 context = aContextGetterGuard.GetInterpreterContextForThreadIdx(i);
@@ -4970,6 +5104,116 @@ bool ScFormulaCell::InterpretFormulaGroupThreading(sc::FormulaLogger::GroupScope
     return false;
 }
 
+// To be called only from InterpretFormulaGroup().
+bool ScFormulaCell::InterpretFormulaGroupCPU(sc::FormulaLogger::GroupScope& aScope,
+                                             bool& bDependencyComputed,
+                                             bool& bDependencyCheckFailed)
+{
+    // Forcing a kind of calculation, e.g. for unit tests, means exactly that
+    // one, so the CPU vector code is used only when nothing is forced.
+    static const bool bCPUProhibited = std::getenv("SC_NO_CPU_GROUP_CALCULATION");
+    if (bCPUProhibited || bDependencyCheckFailed
+        || ScCalcConfig::getForceCalculationType() != ForceCalculationNone)
+        return false;
+
+    // TableOp does tricks with using a cell with different values, just bail out.
+    if (rDocument.IsInInterpreterTableOp() || rDocument.IsThreadedGroupCalcInProgress()
+        || rDocument.GetDocOptions().IsCalcAsShown())
+        return false;
+
+    bool bLogicalResult = false;
+    if (!sc::FormulaGroupInterpreterCPU::isSupported(*pCode, bLogicalResult))
+        return false;
+
+    // The results are set without the number format handling of
+    // InterpretTail(), so make sure that would not change anything: with
+    // only General input an arithmetic result is of type NUMBER, and a
+    // boolean result is fine if the cells are already of type LOGICAL.
+    if (bLogicalResult ? (nFormatType != SvNumFormatType::LOGICAL || mbNeedsNumberFormat)
+                       : nFormatType != SvNumFormatType::NUMBER)
+    {
+        aScope.addMessage("cpu group calc skipped, result number format may change");
+        return false;
+    }
+
+    const ScAddress aTopPos = mxGroup->mpTopCell->aPos;
+    const SCROW nLen = mxGroup->mnLength;
+    formula::FormulaTokenArrayPlainIterator aIter(*pCode);
+    for (const formula::FormulaToken* p = aIter.First(); p; p = aIter.Next())
+    {
+        ScRange aRange;
+        switch (p->GetType())
+        {
+            case svSingleRef:
+            {
+                const ScSingleRefData& rRef = *p->GetSingleRef();
+                if (rRef.IsDeleted())
+                    return false;
+                aRange.aStart = aRange.aEnd = rRef.toAbs(rDocument, aTopPos);
+                if (rRef.IsRowRel())
+                    aRange.aEnd.IncRow(nLen - 1);
+            }
+            break;
+            case svDoubleRef:
+            {
+                const ScComplexRefData& rRef = *p->GetDoubleRef();
+                if (rRef.IsDeleted())
+                    return false;
+                aRange = rRef.toAbs(rDocument, aTopPos);
+                const SCROW nEndRow = aRange.aEnd.Row();
+                if (rRef.Ref1.IsRowRel())
+                    aRange.aEnd.SetRow(std::max(nEndRow, aRange.aStart.Row() + nLen - 1));
+                if (rRef.Ref2.IsRowRel())
+                    aRange.aEnd.SetRow(std::max(aRange.aEnd.Row(), nEndRow + nLen - 1));
+            }
+            break;
+            case svIndex:
+                // Named expressions and the like, their references are not checked here.
+                return false;
+            default:
+                continue;
+        }
+
+        if (aRange.aEnd.Row() > rDocument.MaxRow())
+            aRange.aEnd.SetRow(rDocument.MaxRow());
+        if (!rDocument.HasOnlyGeneralNumberFormat(aRange))
+        {
+            aScope.addMessage("cpu group calc skipped, input not in General number format");
+            return false;
+        }
+    }
+
+    if (!bDependencyComputed && !CheckComputeDependencies(aScope, true, 0, nLen - 1))
+    {
+        bDependencyComputed = true;
+        bDependencyCheckFailed = true;
+        return false;
+    }
+
+    bDependencyComputed = true;
+
+    ScTokenArray aCode(rDocument);
+    ScGroupTokenConverter aConverter(aCode, rDocument, *this, aTopPos);
+    if (!aConverter.convert(*pCode, aScope))
+    {
+        aScope.addMessage("cpu group token conversion failed");
+        return false;
+    }
+
+    mxGroup->meCalcState = sc::GroupCalcRunning;
+    if (!sc::FormulaGroupInterpreterCPU::get().interpret(rDocument, aTopPos, mxGroup, aCode))
+    {
+        // Not disabled, threading may still handle it.
+        mxGroup->meCalcState = sc::GroupCalcEnabled;
+        aScope.addMessage("cpu group interpretation unsuccessful");
+        return false;
+    }
+
+    aScope.setCalcComplete();
+    mxGroup->meCalcState = sc::GroupCalcEnabled;
+    return true;
+}
+
 // To be called only from InterpretFormulaGroup().
 bool ScFormulaCell::InterpretFormulaGroupOpenCL(sc::FormulaLogger::GroupScope& aScope,
                                                 bool& bDependencyComputed,
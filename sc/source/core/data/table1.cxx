@@ -52,7 +52,9 @@
 
 #include <formula/vectortoken.hxx>
 #include <token.hxx>
+#include <formulagroupscheduler.hxx>
 
+#include <chrono>
 #include <vector>
 #include <memory>
 
@@ -2647,6 +2649,37 @@ void ScTable::CalculateInColumnInThread( ScInterpreterContext& rContext,
     }
 }
 
+void ScTable::CalculateInColumnInThread( ScInterpreterContext& rContext,
+                                         SCCOL nColStart, SCCOL nColEnd,
+                                         SCROW nRowStart, SCROW nRowEnd,
+                                         unsigned nThisThread,
+                                         sc::FormulaGroupWorkStealingScheduler& rScheduler )
+{
+    if (!ValidCol(nColStart) || !ValidCol(nColEnd))
+        return;
+
+    const auto aStartTime = std::chrono::steady_clock::now();
+
+    // The scheduler hands out indices into the cells of all columns, counted
+    // column by column, the same way the interleaved variant uses nOffset.
+    const size_t nLen = nRowEnd - nRowStart + 1;
+    size_t nBegin, nEnd;
+    while (rScheduler.getNextChunk(nThisThread, nBegin, nEnd))
+    {
+        while (nBegin < nEnd)
+        {
+            const SCCOL nCol = nColStart + static_cast<SCCOL>(nBegin / nLen);
+            const size_t nRowOffset = nBegin % nLen;
+            const size_t nCount = std::min(nEnd - nBegin, nLen - nRowOffset);
+            assert(nCol <= nColEnd);
+            aCol[nCol].CalculateInThread( rContext, nRowStart + nRowOffset, nCount, 0, 0, 0 );
+            nBegin += nCount;
+        }
+    }
+
+    rScheduler.addBusyTime(nThisThread, std::chrono::steady_clock::now() - aStartTime);
+}
+
 void ScTable::HandleStuffAfterParallelCalculation( SCCOL nColStart, SCCOL nColEnd, SCROW nRow, size_t nLen,
                                                    ScInterpreter* pInterpreter)
 {
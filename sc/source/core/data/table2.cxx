@@ -2182,6 +2182,12 @@ void ScTable::CalcAll()
     mpCondFormatList->CalcAll();
 }
 
+void ScTable::CollectReferencedTabs( std::set<SCTAB>& rTabs, bool& rUnknown ) const
+{
+    for (SCCOL i = 0; i < aCol.size() && !rUnknown; ++i)
+        aCol[i].CollectReferencedTabs(rTabs, rUnknown);
+}
+
 void ScTable::CompileAll( sc::CompileFormulaContext& rCxt )
 {
     for (SCCOL i = 0; i < aCol.size(); ++i)
@@ -2270,6 +2276,19 @@ sal_uInt32 ScTable::GetNumberFormat( SCCOL nCol, SCROW nStartRow, SCROW nEndRow
     return ColumnData(nCol).GetNumberFormat(nStartRow, nEndRow);
 }
 
+bool ScTable::HasOnlyGeneralNumberFormat( SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2 ) const
+{
+    if (!ValidCol(nCol1) || !ValidCol(nCol2) || !ValidRow(nRow1) || !ValidRow(nRow2))
+        return false;
+
+    for (SCCOL nCol = nCol1; nCol <= nCol2; ++nCol)
+    {
+        if (!ColumnData(nCol).HasOnlyGeneralNumberFormat(nRow1, nRow2))
+            return false;
+    }
+    return true;
+}
+
 void ScTable::SetNumberFormat( SCCOL nCol, SCROW nRow, sal_uInt32 nNumberFormat )
 {
     if (!ValidColRow(nCol, nRow))
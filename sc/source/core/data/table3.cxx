@@ -17,8 +17,9 @@
  *   the License at http://www.apache.org/licenses/LICENSE-2.0 .
  */
 
+#include <comphelper/parallelsort.hxx>
 #include <comphelper/processfactory.hxx>
-#include <comphelper/random.hxx>
+#include <comphelper/threadpool.hxx>
 #include <svl/numformat.hxx>
 #include <svl/zforlist.hxx>
 #include <svl/zformat.hxx>
@@ -63,10 +64,15 @@
 #include <drwlayer.hxx>
 #include <queryevaluator.hxx>
 #include <scopetools.hxx>
+#include <calcconfig.hxx>
+#include <interpretercontext.hxx>
+#include <conditio.hxx>
 
 #include <svl/sharedstringpool.hxx>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <unordered_set>
 #include <vector>
@@ -339,6 +345,39 @@ public:
         }
     }
 
+    /**
+     * Call this only during normal sorting, not from reordering.
+     *
+     * @param rOrder new order of the entries, as offsets from the start.
+     */
+    void Reorder( const std::vector<SCCOLROW>& rOrder )
+    {
+        const size_t nCount = rOrder.size();
+        for (auto & ppInfo : mvppInfo)
+        {
+            std::unique_ptr<ScSortInfo[]> ppSorted(new ScSortInfo[nCount]);
+            for (size_t i = 0; i < nCount; ++i)
+                ppSorted[i] = ppInfo[rOrder[i]];
+            ppInfo = std::move(ppSorted);
+        }
+
+        std::vector<SCCOLROW> aOrderIndices;
+        aOrderIndices.reserve(nCount);
+        for (SCCOLROW nPos : rOrder)
+            aOrderIndices.push_back(maOrderIndices[nPos]);
+        maOrderIndices.swap(aOrderIndices);
+
+        if (mpRows)
+        {
+            RowsType& rRows = *mpRows;
+            RowsType aRows;
+            aRows.reserve(nCount);
+            for (SCCOLROW nPos : rOrder)
+                aRows.push_back(std::move(rRows[nPos]));
+            rRows.swap(aRows);
+        }
+    }
+
     void SetOrderIndices( std::vector<SCCOLROW>&& rIndices )
     {
         maOrderIndices = std::move(rIndices);
@@ -1578,33 +1617,7 @@ short ScTable::CompareCell(
                 else
                     aStr2 = GetString(nCell2Col, nCell2Row);
 
-                bool bUserDef     = aSortParam.bUserDef;        // custom sort order
-                bool bNaturalSort = aSortParam.bNaturalSort;    // natural sort
-                bool bCaseSens    = aSortParam.bCaseSens;       // case sensitivity
-
-                ScUserList* pList = ScGlobal::GetUserList();
-                if (bUserDef && pList && pList->size() > aSortParam.nUserIndex )
-                {
-                    const ScUserListData& rData = (*pList)[aSortParam.nUserIndex];
-
-                    if ( bNaturalSort )
-                        nRes = naturalsort::Compare( aStr1, aStr2, bCaseSens, &rData, pSortCollator );
-                    else
-                    {
-                        if ( bCaseSens )
-                            nRes = sal::static_int_cast<short>( rData.Compare(aStr1, aStr2) );
-                        else
-                            nRes = sal::static_int_cast<short>( rData.ICompare(aStr1, aStr2) );
-                    }
-
-                }
-                if (!bUserDef)
-                {
-                    if ( bNaturalSort )
-                        nRes = naturalsort::Compare( aStr1, aStr2, bCaseSens, nullptr, pSortCollator );
-                    else
-                        nRes = static_cast<short>( pSortCollator->compareString( aStr1, aStr2 ) );
-                }
+                nRes = CompareCellStrings( aStr1, aStr2 );
             }
             else if ( bStr1 )               // String <-> Number or Error
             {
@@ -1657,75 +1670,153 @@ short ScTable::CompareCell(
     return nRes;
 }
 
-short ScTable::Compare( ScSortInfoArray* pArray, SCCOLROW nIndex1, SCCOLROW nIndex2 ) const
+short ScTable::CompareCellStrings( const OUString& rStr1, const OUString& rStr2 ) const
 {
-    short nRes;
-    sal_uInt16 nSort = 0;
-    do
+    short nRes = 0;
+    bool bUserDef     = aSortParam.bUserDef;        // custom sort order
+    bool bNaturalSort = aSortParam.bNaturalSort;    // natural sort
+    bool bCaseSens    = aSortParam.bCaseSens;       // case sensitivity
+
+    ScUserList* pList = ScGlobal::GetUserList();
+    if (bUserDef && pList && pList->size() > aSortParam.nUserIndex )
     {
-        ScSortInfo& rInfo1 = pArray->Get( nSort, nIndex1 );
-        ScSortInfo& rInfo2 = pArray->Get( nSort, nIndex2 );
-        if ( aSortParam.bByRow )
-            nRes = CompareCell( nSort,
-                rInfo1.maCell, static_cast<SCCOL>(aSortParam.maKeyState[nSort].nField), rInfo1.nOrg,
-                rInfo2.maCell, static_cast<SCCOL>(aSortParam.maKeyState[nSort].nField), rInfo2.nOrg );
+        const ScUserListData& rData = (*pList)[aSortParam.nUserIndex];
+
+        if ( bNaturalSort )
+            nRes = naturalsort::Compare( rStr1, rStr2, bCaseSens, &rData, pSortCollator );
         else
-            nRes = CompareCell( nSort,
-                rInfo1.maCell, static_cast<SCCOL>(rInfo1.nOrg), aSortParam.maKeyState[nSort].nField,
-                rInfo2.maCell, static_cast<SCCOL>(rInfo2.nOrg), aSortParam.maKeyState[nSort].nField );
-    } while ( nRes == 0 && ++nSort < pArray->GetUsedSorts() );
-    if( nRes == 0 )
-    {
-        ScSortInfo& rInfo1 = pArray->Get( 0, nIndex1 );
-        ScSortInfo& rInfo2 = pArray->Get( 0, nIndex2 );
-        if( rInfo1.nOrg < rInfo2.nOrg )
-            nRes = -1;
-        else if( rInfo1.nOrg > rInfo2.nOrg )
-            nRes = 1;
+        {
+            if ( bCaseSens )
+                nRes = sal::static_int_cast<short>( rData.Compare(rStr1, rStr2) );
+            else
+                nRes = sal::static_int_cast<short>( rData.ICompare(rStr1, rStr2) );
+        }
+
+    }
+    if (!bUserDef)
+    {
+        if ( bNaturalSort )
+            nRes = naturalsort::Compare( rStr1, rStr2, bCaseSens, nullptr, pSortCollator );
+        else
+            nRes = static_cast<short>( pSortCollator->compareString( rStr1, rStr2 ) );
     }
     return nRes;
 }
 
-void ScTable::QuickSort( ScSortInfoArray* pArray, SCCOLROW nLo, SCCOLROW nHi )
+namespace {
+
+/** Sort key of one cell, resolved once before sorting. */
+struct SortKey
 {
-    if ((nHi - nLo) == 1)
-    {
-        if (Compare(pArray, nLo, nHi) > 0)
-            pArray->Swap( nLo, nHi );
-    }
-    else
+    /// In ascending sort order, empty cells always go last.
+    enum class Type : sal_uInt8 { Value, String, Error, Empty };
+
+    OUString maString;
+    double mfValue = 0.0;
+    Type meType = Type::Empty;
+};
+
+}
+
+void ScTable::SortByKeys( ScSortInfoArray* pArray )
+{
+    const SCCOLROW nStart = pArray->GetStart();
+    const size_t nCount = pArray->GetLast() - nStart + 1;
+    const sal_uInt16 nUsedSorts = pArray->GetUsedSorts();
+
+    // Resolve cell types, formula results and strings once instead of for
+    // each comparison.  This is the same classification as in CompareCell().
+    std::vector<std::vector<SortKey>> aKeys(nUsedSorts);
+    for (sal_uInt16 nSort = 0; nSort < nUsedSorts; ++nSort)
     {
-        SCCOLROW ni = nLo;
-        SCCOLROW nj = nHi;
-        do
+        std::vector<SortKey>& rKeys = aKeys[nSort];
+        rKeys.resize(nCount);
+        for (size_t i = 0; i < nCount; ++i)
         {
-            while ((ni <= nHi) && (Compare(pArray, ni, nLo)) < 0)
-                ni++;
-            while ((nj >= nLo) && (Compare(pArray, nLo, nj)) < 0)
-                nj--;
-            if (ni <= nj)
+            const ScSortInfo& rInfo = pArray->Get( nSort, nStart + i );
+            const ScRefCellValue& rCell = rInfo.maCell;
+            if (rCell.isEmpty())
+                continue;
+
+            SortKey& rKey = rKeys[i];
+            const CellType eType = rCell.getType();
+            bool bStr = (eType != CELLTYPE_VALUE);
+            bool bErr = false;
+            if (eType == CELLTYPE_FORMULA)
             {
-                if (ni != nj)
-                    pArray->Swap( ni, nj );
-                ni++;
-                nj--;
+                if (rCell.getFormula()->GetErrCode() != FormulaError::NONE)
+                {
+                    bErr = true;
+                    bStr = false;
+                }
+                else if (rCell.getFormula()->IsValue())
+                {
+                    bStr = false;
+                }
+            }
+
+            if (bStr)
+            {
+                rKey.meType = SortKey::Type::String;
+                if (eType == CELLTYPE_STRING)
+                    rKey.maString = rCell.getSharedString()->getString();
+                else if (aSortParam.bByRow)
+                    rKey.maString = GetString( static_cast<SCCOL>(aSortParam.maKeyState[nSort].nField), rInfo.nOrg );
+                else
+                    rKey.maString = GetString( static_cast<SCCOL>(rInfo.nOrg), aSortParam.maKeyState[nSort].nField );
+            }
+            else if (bErr)
+                rKey.meType = SortKey::Type::Error;
+            else
+            {
+                rKey.meType = SortKey::Type::Value;
+                rKey.mfValue = rCell.getValue();
             }
-        } while (ni < nj);
-        if ((nj - nLo) < (nHi - ni))
-        {
-            if (nLo < nj)
-                QuickSort(pArray, nLo, nj);
-            if (ni < nHi)
-                QuickSort(pArray, ni, nHi);
         }
-        else
+    }
+
+    auto aLess = [this, &aKeys, nUsedSorts]( SCCOLROW n1, SCCOLROW n2 )
+    {
+        for (sal_uInt16 nSort = 0; nSort < nUsedSorts; ++nSort)
         {
-            if (ni < nHi)
-                QuickSort(pArray, ni, nHi);
-            if (nLo < nj)
-                QuickSort(pArray, nLo, nj);
+            const SortKey& rKey1 = aKeys[nSort][n1];
+            const SortKey& rKey2 = aKeys[nSort][n2];
+            short nRes = 0;
+            if (rKey1.meType == SortKey::Type::Empty || rKey2.meType == SortKey::Type::Empty)
+            {
+                // Empty cells go last regardless of the sort direction.
+                if (rKey1.meType != rKey2.meType)
+                    return rKey2.meType == SortKey::Type::Empty;
+                continue;
+            }
+            if (rKey1.meType != rKey2.meType)
+                nRes = (rKey1.meType < rKey2.meType ? -1 : 1);
+            else if (rKey1.meType == SortKey::Type::String)
+                nRes = CompareCellStrings( rKey1.maString, rKey2.maString );
+            else if (rKey1.meType == SortKey::Type::Value)
+            {
+                if (rKey1.mfValue < rKey2.mfValue)
+                    nRes = -1;
+                else if (rKey1.mfValue > rKey2.mfValue)
+                    nRes = 1;
+            }
+            if (nRes != 0)
+                return aSortParam.maKeyState[nSort].bAscending ? nRes < 0 : nRes > 0;
         }
-    }
+        // Keep the original order of equal entries.
+        return n1 < n2;
+    };
+
+    std::vector<SCCOLROW> aOrder(nCount);
+    std::iota(aOrder.begin(), aOrder.end(), 0);
+    // Natural sort and user lists go through the (not thread-safe) character
+    // classification, only plain collator comparisons are done in parallel.
+    if (aSortParam.bNaturalSort || aSortParam.bUserDef)
+        std::sort(aOrder.begin(), aOrder.end(), aLess);
+    else
+        comphelper::parallelSort(aOrder.begin(), aOrder.end(), aLess);
+
+    pArray->Reorder(aOrder);
 }
 
 short ScTable::Compare(SCCOLROW nIndex1, SCCOLROW nIndex2) const
@@ -1775,17 +1866,6 @@ bool ScTable::IsSorted( SCCOLROW nStart, SCCOLROW nEnd ) const   // over aSortPa
     return true;
 }
 
-void ScTable::DecoladeRow( ScSortInfoArray* pArray, SCROW nRow1, SCROW nRow2 )
-{
-    SCROW nRow;
-    int nMax = nRow2 - nRow1;
-    for (SCROW i = nRow1; (i + 4) <= nRow2; i += 4)
-    {
-        nRow = comphelper::rng::uniform_int_distribution(0, nMax-1);
-        pArray->Swap(i, nRow1 + nRow);
-    }
-}
-
 void ScTable::Sort(
     const ScSortParam& rSortParam, bool bKeepQuery, bool bUpdateRefs,
     ScProgress* pProgress, sc::ReorderParam* pUndo )
@@ -1819,10 +1899,7 @@ void ScTable::Sort(
             std::unique_ptr<ScSortInfoArray> pArray( CreateSortInfoArray(
                         aSortParam, nRow1, nLastRow, bKeepQuery, bUpdateRefs));
 
-            if ( nLastRow - nRow1 > 255 )
-                DecoladeRow(pArray.get(), nRow1, nLastRow);
-
-            QuickSort(pArray.get(), nRow1, nLastRow);
+            SortByKeys(pArray.get());
             if (pArray->IsUpdateRefs())
                 SortReorderByRowRefUpdate(pArray.get(), aSortParam.nCol1, aSortParam.nCol2, pProgress);
             else
@@ -1854,7 +1931,7 @@ void ScTable::Sort(
             std::unique_ptr<ScSortInfoArray> pArray( CreateSortInfoArray(
                         aSortParam, nCol1, nLastCol, bKeepQuery, bUpdateRefs));
 
-            QuickSort(pArray.get(), nCol1, nLastCol);
+            SortByKeys(pArray.get());
             SortReorderByColumn(pArray.get(), rSortParam.nRow1, rSortParam.nRow2,
                     rSortParam.aDataAreaExtras.mbCellFormats, pProgress);
             if (rSortParam.aDataAreaExtras.anyExtrasWanted() && !pArray->IsUpdateRefs())
@@ -2375,8 +2452,7 @@ void ScTable::TopTenQuery( ScQueryParam& rParam )
                         InitSortCollator(aLocalSortParam);
                     }
                     std::unique_ptr<ScSortInfoArray> pArray(CreateSortInfoArray(aSortParam, nRow1, rParam.nRow2, bGlobalKeepQuery, false));
-                    DecoladeRow(pArray.get(), nRow1, rParam.nRow2);
-                    QuickSort(pArray.get(), nRow1, rParam.nRow2);
+                    SortByKeys(pArray.get());
                     std::unique_ptr<ScSortInfo[]> const& ppInfo = pArray->GetFirstArray();
                     SCSIZE nValidCount = nCount;
                     // Don't count note or blank cells, they are sorted to the end
@@ -2587,6 +2663,126 @@ void lcl_PrepareQuery( const ScDocument* pDoc, ScTable* pTab, ScQueryParam& rPar
     }
 }
 
+/// Below this many rows starting the worker threads costs more than it saves.
+constexpr SCROW nMinRowsForThreadedQuery = 16384;
+
+class QueryEvaluateTask : public comphelper::ThreadTask
+{
+private:
+    ScDocument& mrDoc;
+    const ScTable& mrTab;
+    const ScQueryParam& mrParam;
+    ScInterpreterContext& mrContext;
+    SCROW mnRow1;
+    SCROW mnRow2;
+    SCROW mnFirstRow;
+    std::vector<sal_uInt8>& mrResults;
+
+public:
+    QueryEvaluateTask(const std::shared_ptr<comphelper::ThreadTaskTag>& rTag,
+                      ScDocument& rDoc, const ScTable& rTab, const ScQueryParam& rParam,
+                      ScInterpreterContext& rContext, SCROW nRow1, SCROW nRow2,
+                      SCROW nFirstRow, std::vector<sal_uInt8>& rResults)
+        : comphelper::ThreadTask(rTag)
+        , mrDoc(rDoc)
+        , mrTab(rTab)
+        , mrParam(rParam)
+        , mrContext(rContext)
+        , mnRow1(nRow1)
+        , mnRow2(nRow2)
+        , mnFirstRow(nFirstRow)
+        , mrResults(rResults)
+    {
+    }
+
+    virtual void doWork() override
+    {
+        // The query entries cache their search text, so every task works on its own copy.
+        ScQueryParam aParam(mrParam);
+        sc::TableColumnBlockPositionSet aBlockPos(mrDoc, mrTab.GetTab());
+        ScQueryEvaluator aEvaluator(mrDoc, mrTab, aParam, &mrContext);
+        for (SCROW nRow = mnRow1; nRow <= mnRow2; ++nRow)
+            mrResults[nRow - mnFirstRow] = aEvaluator.ValidQuery(nRow, nullptr, &aBlockPos);
+    }
+};
+
+}
+
+bool ScTable::ValidQueryThreaded( const ScQueryParam& rParam, SCROW nRow1, SCROW nRow2,
+                                  std::vector<sal_uInt8>& rResults )
+{
+    if (nRow2 - nRow1 + 1 < nMinRowsForThreadedQuery || !ScCalcConfig::isThreadingEnabled()
+        || rDocument.IsThreadedGroupCalcInProgress())
+        return false;
+
+    comphelper::ThreadPool& rThreadPool(comphelper::ThreadPool::getSharedOptimalPool());
+    const sal_Int32 nThreadCount = rThreadPool.getWorkerCount();
+    if (nThreadCount <= 1)
+        return false;
+
+    // The workers may only read the cells, so make sure the queried columns
+    // exist and hold no formula cells that still need to be calculated.
+    // Color filters and conditional formats evaluate formulas on demand
+    // and fill shared caches, which is not safe on the worker threads.
+    SCSIZE nEntryCount = rParam.GetEntryCount();
+    for (SCSIZE i = 0; i < nEntryCount; ++i)
+    {
+        const ScQueryEntry& rEntry = rParam.GetEntry(i);
+        if (!rEntry.bDoQuery)
+            break;
+        if (!ValidCol(rEntry.nField))
+            return false;
+        for (const ScQueryEntry::Item& rItem : rEntry.GetQueryItems())
+        {
+            if (rItem.meType == ScQueryEntry::ByTextColor
+                || rItem.meType == ScQueryEntry::ByBackgroundColor)
+                return false;
+        }
+        if (mpCondFormatList)
+        {
+            const ScRange aColRange(rEntry.nField, nRow1, nTab, rEntry.nField, nRow2, nTab);
+            for (const auto& rxFormat : *mpCondFormatList)
+            {
+                if (rxFormat->GetRange().Intersects(aColRange))
+                    return false;
+            }
+        }
+        CreateColumnIfNotExists(rEntry.nField);
+        if (!aCol[rEntry.nField].InterpretCellsIfNeeded(nRow1, nRow2))
+            return false;
+    }
+
+    rResults.assign(nRow2 - nRow1 + 1, 0);
+
+    SvNumberFormatter* pNonThreadedFormatter = rDocument.GetNonThreadedContext().GetFormatTable();
+    rDocument.SetThreadedGroupCalcInProgress(true);
+    {
+        ScMutationDisable aGuard(rDocument, ScMutationGuardFlags::CORE);
+
+        std::shared_ptr<comphelper::ThreadTaskTag> aTag = comphelper::ThreadPool::createThreadTaskTag();
+        ScThreadedInterpreterContextGetterGuard aContextGetterGuard(nThreadCount, rDocument, pNonThreadedFormatter);
+        const SCROW nRows = nRow2 - nRow1 + 1;
+        for (sal_Int32 i = 0; i < nThreadCount; ++i)
+        {
+            const SCROW nStart = nRow1 + static_cast<sal_Int64>(nRows) * i / nThreadCount;
+            const SCROW nEnd = nRow1 + static_cast<sal_Int64>(nRows) * (i + 1) / nThreadCount - 1;
+            if (nStart > nEnd)
+                continue;
+            ScInterpreterContext* pContext = aContextGetterGuard.GetInterpreterContextForThreadIdx(i);
+            rDocument.SetupContextFromNonThreadedContext(*pContext, i);
+            rThreadPool.pushTask(std::make_unique<QueryEvaluateTask>(aTag, rDocument, *this, rParam, *pContext,
+                                                                     nStart, nEnd, nRow1, rResults));
+        }
+        rThreadPool.waitUntilDone(aTag, false);
+
+        rDocument.SetThreadedGroupCalcInProgress(false);
+
+        for (sal_Int32 i = 0; i < nThreadCount; ++i)
+            rDocument.MergeContextBackIntoNonThreadedContext(
+                *aContextGetterGuard.GetInterpreterContextForThreadIdx(i), i);
+    }
+
+    return true;
 }
 
 void ScTable::PrepareQuery( ScQueryParam& rQueryParam )
@@ -2619,14 +2815,36 @@ SCSIZE ScTable::Query(const ScQueryParam& rParamOrg, bool bKeepSub)
                             aParam.nDestCol, aParam.nDestRow, aParam.nDestTab );
     }
 
+    SCROW nRealRow2 = aParam.nRow2;
+    SCROW nFirstRow = aParam.nRow1 + nHeader;
+
+    // Evaluate the query for all rows up front on several threads, unless
+    // copying the results may change the cells still to be queried.
+    std::vector<sal_uInt8> aValidRows;
+    bool bHaveValidRows = (aParam.bInplace || aParam.nDestTab != nTab)
+        && ValidQueryThreaded(aParam, nFirstRow, nRealRow2, aValidRows);
+
     sc::TableColumnBlockPositionSet blockPos( GetDoc(), nTab ); // cache mdds access
     ScQueryEvaluator queryEvaluator(GetDoc(), *this, aParam);
 
-    SCROW nRealRow2 = aParam.nRow2;
-    for (SCROW j = aParam.nRow1 + nHeader; j <= nRealRow2; ++j)
+    // Cached column positions and buffer for building the keys of the rows
+    // when duplicates are to be removed.
+    std::vector<sc::ColumnBlockConstPosition> aKeyBlockPos;
+    OUStringBuffer aKeyBuf;
+    auto initKeyBlockPos = [&]()
+    {
+        aKeyBlockPos.assign(aParam.nCol2 - aParam.nCol1 + 1, sc::ColumnBlockConstPosition());
+        for (SCCOL k = aParam.nCol1; k <= aParam.nCol2 && k < GetAllocatedColumnsCount(); ++k)
+            aCol[k].InitBlockPosition(aKeyBlockPos[k - aParam.nCol1]);
+    };
+    if (!aParam.bDuplicate)
+        initKeyBlockPos();
+
+    for (SCROW j = nFirstRow; j <= nRealRow2; ++j)
     {
         bool bResult;                                   // Filter result
-        bool bValid = queryEvaluator.ValidQuery(j, nullptr, &blockPos);
+        bool bValid = bHaveValidRows ? aValidRows[j - nFirstRow] != 0
+                                     : queryEvaluator.ValidQuery(j, nullptr, &blockPos);
         if (!bValid && bKeepSub)                        // Keep subtotals
         {
             for (SCCOL nCol=aParam.nCol1; nCol<=aParam.nCol2 && !bValid; nCol++)
@@ -2648,14 +2866,14 @@ SCSIZE ScTable::Query(const ScQueryParam& rParamOrg, bool bKeepSub)
                 bResult = true;
             else
             {
-                OUStringBuffer aStr;
                 for (SCCOL k=aParam.nCol1; k <= aParam.nCol2; k++)
                 {
-                    OUString aCellStr = GetString(k, j);
-                    aStr.append(aCellStr + u"\x0001");
+                    if (k < GetAllocatedColumnsCount())
+                        aKeyBuf.append(aCol[k].GetString(aKeyBlockPos[k - aParam.nCol1], j));
+                    aKeyBuf.append(u'\x0001');
                 }
 
-                bResult = aStrSet.insert(aStr.makeStringAndClear()).second; // unique if inserted.
+                bResult = aStrSet.insert(aKeyBuf.makeStringAndClear()).second; // unique if inserted.
             }
         }
         else
@@ -2680,7 +2898,11 @@ SCSIZE ScTable::Query(const ScQueryParam& rParamOrg, bool bKeepSub)
             {
                 CopyData( aParam.nCol1,j, aParam.nCol2,j, aParam.nDestCol,nOutRow,aParam.nDestTab );
                 if( nTab == aParam.nDestTab ) // copy to self, changes may invalidate caching position hints
+                {
                     blockPos.invalidate();
+                    if (!aParam.bDuplicate)
+                        initKeyBlockPos();
+                }
                 ++nOutRow;
             }
         }
@@ -755,7 +755,10 @@ SCROW ScTable::CountVisibleRows(SCROW nStartRow, SCROW nEndRow) const
     ScFlatBoolRowSegments::RangeData aData;
     while (nRow <= nEndRow)
     {
-        if (!mpHiddenRows->getRangeData(nRow, aData))
+        // Only the first segment needs a tree search, the following ones
+        // are the neighbours of the previously found one.
+        if (!(nRow == nStartRow ? mpHiddenRows->getRangeData(nRow, aData)
+                                : mpHiddenRows->getRangeDataLeaf(nRow, aData)))
             break;
 
         if (aData.mnRow2 > nEndRow)
@@ -776,7 +779,8 @@ tools::Long ScTable::GetTotalRowHeight(SCROW nStartRow, SCROW nEndRow, bool bHid
     ScFlatBoolRowSegments::RangeData aData;
     while (nRow <= nEndRow)
     {
-        if (!mpHiddenRows->getRangeData(nRow, aData))
+        if (!(nRow == nStartRow ? mpHiddenRows->getRangeData(nRow, aData)
+                                : mpHiddenRows->getRangeDataLeaf(nRow, aData)))
             break;
 
         if (aData.mnRow2 > nEndRow)
@@ -987,7 +991,8 @@ SCROW ScTable::CountNonFilteredRows(SCROW nStartRow, SCROW nEndRow) const
     ScFlatBoolRowSegments::RangeData aData;
     while (nRow <= nEndRow)
     {
-        if (!mpFilteredRows->getRangeData(nRow, aData))
+        if (!(nRow == nStartRow ? mpFilteredRows->getRangeData(nRow, aData)
+                                : mpFilteredRows->getRangeDataLeaf(nRow, aData)))
             break;
 
         if (aData.mnRow2 > nEndRow)
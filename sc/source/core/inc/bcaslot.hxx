@@ -257,19 +257,30 @@ private:
         +---+---+
         | 2 | 5 |
         +---+---+
+
+        Areas that span many row slots (e.g. whole column references) are
+        not inserted into each of the slots they cover, but into one tall
+        slot per column slice instead, see IsTallArea().
+
+        +---+---+
+        | 0 | 1 |
+        +---+---+
      */
 
     class TableSlots
     {
     public:
-                                        TableSlots(SCSIZE nBcaSlots);
+                                        TableSlots(SCSIZE nBcaSlots, SCSIZE nTallSlots);
                                         TableSlots(TableSlots&&) noexcept;
                                         ~TableSlots();
         ScBroadcastAreaSlot**    getSlots() const { return ppSlots.get(); }
+        ScBroadcastAreaSlot**    getTallSlots() const { return ppTallSlots.get(); }
 
     private:
         SCSIZE                                    mnBcaSlots;
+        SCSIZE                                    mnTallSlots;
         std::unique_ptr<ScBroadcastAreaSlot*[]>   ppSlots;
+        std::unique_ptr<ScBroadcastAreaSlot*[]>   ppTallSlots;
 
         TableSlots( const TableSlots& ) = delete;
         TableSlots& operator=( const TableSlots& ) = delete;
@@ -319,6 +330,21 @@ private:
     void                 ComputeAreaPoints( const ScRange& rRange,
                                             SCSIZE& nStart, SCSIZE& nEnd,
                                             SCSIZE& nRowBreak ) const;
+
+    /** Areas covering at least this many row slots go to the tall slots. */
+    static constexpr SCSIZE TALL_AREA_ROW_SLOTS = 32;
+
+    /** Whether an area with the given ComputeAreaPoints() result is kept in
+        the tall slots. Depends only on the range, so that an area is always
+        looked up where it was inserted. */
+    static bool          IsTallArea( SCSIZE nRowBreak )
+                            { return nRowBreak + 1 >= TALL_AREA_ROW_SLOTS; }
+    /** Tall slots [rTallStart,rTallEnd] of the column slices covered by the
+        slot range [nStart,nEnd]. */
+    void                 ComputeTallSlots( SCSIZE nStart, SCSIZE nEnd,
+                                           SCSIZE& rTallStart, SCSIZE& rTallEnd ) const
+                            { rTallStart = nStart / mnBcaSlotsCol; rTallEnd = nEnd / mnBcaSlotsCol; }
+    TableSlotsMap::iterator EmplaceTableSlots( SCTAB nTab );
 #ifdef DBG_UTIL
     void                 DoChecks();
 #endif
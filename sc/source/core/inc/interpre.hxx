@@ -388,6 +388,7 @@ private:
 
     formula::FormulaToken* CreateFormulaDoubleToken( double fVal, SvNumFormatType nFmt = SvNumFormatType::NUMBER );
     formula::FormulaToken* CreateDoubleOrTypedToken( double fVal );
+    formula::FormulaToken* CreateFormulaStringToken( const svl::SharedString& rString );
 
     void PushDouble(double nVal);
     void PushInt( int nVal );
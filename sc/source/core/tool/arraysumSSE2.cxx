@@ -14,6 +14,8 @@
 
 #include <tools/simdsupport.hxx>
 
+#include <algorithm>
+
 #include <stdlib.h>
 
 #if SC_USE_SSE2
@@ -115,6 +117,88 @@ KahanSum executeSSE2(size_t& i, size_t nSize, const double* pCurrent)
     return { 0.0, 0.0 };
 }
 
+/** All ones for finite values, zero for infinities and NaNs (x - x is NaN for those).
+  */
+static inline __m128d finiteMaskSSE2(const __m128d& value)
+{
+    return _mm_cmpeq_pd(_mm_sub_pd(value, value), _mm_setzero_pd());
+}
+
+/** Skip over leading finite elements, 4 at a time.  The caller checks the rest.
+  */
+size_t findNonFiniteSSE2(size_t i, size_t nSize, const double* pCurrent)
+{
+    for (; i + 3 < nSize; i += 4)
+    {
+        __m128d mask1 = finiteMaskSSE2(_mm_loadu_pd(pCurrent + i));
+        __m128d mask2 = finiteMaskSSE2(_mm_loadu_pd(pCurrent + i + 2));
+        if (_mm_movemask_pd(_mm_and_pd(mask1, mask2)) != 3)
+            break;
+    }
+    return i;
+}
+
+/** Minimum or maximum of fInit and the finite elements, 4 at a time.
+  */
+template <bool bMax>
+static double executeExtremeSSE2(size_t& i, size_t nSize, const double* pCurrent, double fInit)
+{
+    __m128d acc1 = _mm_set1_pd(fInit);
+    __m128d acc2 = acc1;
+    for (; i + 3 < nSize; i += 4)
+    {
+        __m128d value1 = _mm_loadu_pd(pCurrent + i);
+        __m128d value2 = _mm_loadu_pd(pCurrent + i + 2);
+        // Non-finite elements are replaced by the accumulator, i.e. ignored.
+        __m128d mask1 = finiteMaskSSE2(value1);
+        __m128d mask2 = finiteMaskSSE2(value2);
+        value1 = _mm_or_pd(_mm_and_pd(mask1, value1), _mm_andnot_pd(mask1, acc1));
+        value2 = _mm_or_pd(_mm_and_pd(mask2, value2), _mm_andnot_pd(mask2, acc2));
+        if constexpr (bMax)
+        {
+            acc1 = _mm_max_pd(acc1, value1);
+            acc2 = _mm_max_pd(acc2, value2);
+        }
+        else
+        {
+            acc1 = _mm_min_pd(acc1, value1);
+            acc2 = _mm_min_pd(acc2, value2);
+        }
+    }
+
+    double results[4];
+    _mm_storeu_pd(&results[0], acc1);
+    _mm_storeu_pd(&results[2], acc2);
+    if constexpr (bMax)
+        return std::max({ results[0], results[1], results[2], results[3] });
+    else
+        return std::min({ results[0], results[1], results[2], results[3] });
+}
+
+double executeMaxSSE2(size_t& i, size_t nSize, const double* pCurrent, double fInit)
+{
+    return executeExtremeSSE2<true>(i, nSize, pCurrent, fInit);
+}
+
+double executeMinSSE2(size_t& i, size_t nSize, const double* pCurrent, double fInit)
+{
+    return executeExtremeSSE2<false>(i, nSize, pCurrent, fInit);
+}
+
+/** Elementwise multiplication into pResult, keeping NaN elements of pResult.
+  */
+void executeMultiplySSE2(size_t& i, size_t nSize, double* pResult, const double* pCurrent)
+{
+    for (; i + 1 < nSize; i += 2)
+    {
+        __m128d value = _mm_loadu_pd(pResult + i);
+        __m128d ordered = _mm_cmpord_pd(value, value);
+        __m128d product = _mm_mul_pd(value, _mm_loadu_pd(pCurrent + i));
+        _mm_storeu_pd(pResult + i,
+                      _mm_or_pd(_mm_and_pd(ordered, product), _mm_andnot_pd(ordered, value)));
+    }
+}
+
 } // namespace
 
 #endif
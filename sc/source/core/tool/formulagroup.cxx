@@ -11,17 +11,30 @@
 
 #include <formulagroup.hxx>
 #include <formulagroupcl.hxx>
+#include <arraysumfunctor.hxx>
+#include <compare.hxx>
+#include <compiler.hxx>
 #include <document.hxx>
 #include <formulacell.hxx>
 #include <interpre.hxx>
 #include <globalnames.hxx>
+#include <kahan.hxx>
+#include <math.hxx>
+#include <tokenarray.hxx>
+
+#include <formula/errorcodes.hxx>
+#include <formula/vectortoken.hxx>
 
 #include <officecfg/Office/Common.hxx>
 #if HAVE_FEATURE_OPENCL
 #include <opencl/platforminfo.hxx>
 #endif
+#include <rtl/math.hxx>
 #include <sal/log.hxx>
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <cstdio>
 #include <limits>
 #include <unordered_map>
@@ -169,6 +182,486 @@ FormulaGroupInterpreter *FormulaGroupInterpreter::getStatic()
     return msInstance;
 }
 
+namespace {
+
+/// Kind of the entries on the stack while checking the code for FormulaGroupInterpreterCPU.
+enum class CPUStackKind
+{
+    Value,   ///< one number per row
+    Logical, ///< one number per row, result of a comparison
+    Range    ///< range reference, only valid as argument of an aggregate
+};
+
+/**
+ * Check the RPN code for what FormulaGroupInterpreterCPU can handle, and
+ * collect the tokens to execute in pProgram if not null.
+ */
+bool compileForCPU(const ScTokenArray& rCode, std::vector<const formula::FormulaToken*>* pProgram,
+                   bool& rLogicalResult)
+{
+    std::vector<CPUStackKind> aStack;
+    bool bHasOperation = false;
+    for (const formula::FormulaToken* p : rCode.RPNTokens())
+    {
+        const OpCode eOp = p->GetOpCode();
+        if (eOp == ocPush)
+        {
+            switch (p->GetType())
+            {
+                case formula::svDouble:
+                case formula::svSingleRef:
+                case formula::svSingleVectorRef:
+                    aStack.push_back(CPUStackKind::Value);
+                break;
+                case formula::svDoubleRef:
+                case formula::svDoubleVectorRef:
+                    aStack.push_back(CPUStackKind::Range);
+                break;
+                default:
+                    return false;
+            }
+        }
+        else
+        {
+            CPUStackKind eResult = CPUStackKind::Value;
+            size_t nParams;
+            bool bRangeArgs = false;
+            switch (eOp)
+            {
+                case ocEqual:
+                case ocNotEqual:
+                case ocLess:
+                case ocGreater:
+                case ocLessEqual:
+                case ocGreaterEqual:
+                    eResult = CPUStackKind::Logical;
+                    nParams = 2;
+                break;
+                case ocAdd:
+                case ocSub:
+                case ocMul:
+                case ocDiv:
+                    nParams = 2;
+                break;
+                case ocNegSub:
+                    nParams = 1;
+                break;
+                case ocSum:
+                case ocAverage:
+                case ocMin:
+                case ocMax:
+                case ocCount:
+                    nParams = p->GetParamCount();
+                    bRangeArgs = true;
+                break;
+                default:
+                    return false;
+            }
+
+            if (nParams == 0 || aStack.size() < nParams)
+                return false;
+
+            for (size_t i = aStack.size() - nParams; i < aStack.size(); ++i)
+            {
+                // A range outside of an aggregate would need implicit intersection.
+                if (aStack[i] == CPUStackKind::Range && !bRangeArgs)
+                    return false;
+            }
+
+            // Unary minus keeps the number format type of its argument.
+            if (eOp == ocNegSub)
+                eResult = aStack.back();
+
+            aStack.resize(aStack.size() - nParams);
+            aStack.push_back(eResult);
+            bHasOperation = true;
+        }
+
+        if (pProgram)
+            pProgram->push_back(p);
+    }
+
+    // A formula that is nothing but a reference can result in an empty cell,
+    // leave that to the interpreter.
+    if (!bHasOperation || aStack.size() != 1 || aStack.back() == CPUStackKind::Range)
+        return false;
+
+    rLogicalResult = aStack.back() == CPUStackKind::Logical;
+    return true;
+}
+
+/// Turn a non-finite result into an error value, like ScInterpreter::PushDouble() does.
+double finiteOrError(double fVal)
+{
+    if (std::isfinite(fVal))
+        return fVal;
+    return CreateDoubleError(GetDoubleErrorValue(fVal));
+}
+
+/**
+ * Stack entry of CompiledFormulaCPU.  Either a vector reference token, a
+ * scalar value, or the computed values of all rows with errors encoded as
+ * NaN.  NaN in the numeric array of a reference denotes an empty cell.
+ */
+struct CPUOperand
+{
+    const formula::FormulaToken* mpRef = nullptr;
+    double mfScalar = 0.0;
+    std::vector<double> maValues;
+
+    bool isScalar() const { return !mpRef && maValues.empty(); }
+
+    /// Value of row nRow, or NaN if it is an error or (for references) empty.
+    double get(size_t nRow) const
+    {
+        if (mpRef)
+        {
+            const auto* pRef = static_cast<const formula::SingleVectorRefToken*>(mpRef);
+            const double* pNum = pRef->GetArray().mpNumericArray;
+            return (pNum && nRow < pRef->GetArrayLength())
+                ? pNum[nRow] : std::numeric_limits<double>::quiet_NaN();
+        }
+        return maValues.empty() ? mfScalar : maValues[nRow];
+    }
+};
+
+/**
+ * Window of a range reference at a given row of the group, as
+ * [rStart, rEnd) into the arrays of the DoubleVectorRefToken.
+ */
+void getRangeWindow(const formula::DoubleVectorRefToken& rRef, size_t nRow, size_t& rStart, size_t& rEnd)
+{
+    rStart = rRef.IsStartFixed() ? 0 : nRow;
+    rEnd = rRef.IsEndFixed() ? rRef.GetRefRowSize() : nRow + rRef.GetRefRowSize();
+    rEnd = std::min(rEnd, rRef.GetArrayLength());
+    rStart = std::min(rStart, rEnd);
+}
+
+/**
+ * The code of a formula group compiled for FormulaGroupInterpreterCPU, a
+ * sequence of tokens executed as a stack machine whose entries are whole
+ * columns of values rather than single values.
+ */
+class CompiledFormulaCPU : public CompiledFormula
+{
+    std::vector<const formula::FormulaToken*> maProgram;
+
+    static bool checkReference(const formula::FormulaToken& rToken, size_t nLength);
+    static void binaryOperation(OpCode eOp, const CPUOperand& rLeft, const CPUOperand& rRight,
+                                size_t nLength, CPUOperand& rResult);
+    static void aggregate(OpCode eOp, const CPUOperand* pArgs, size_t nArgs, size_t nLength,
+                          CPUOperand& rResult);
+
+public:
+    bool compile(const ScTokenArray& rCode)
+    {
+        bool bLogicalResult;
+        return compileForCPU(rCode, &maProgram, bLogicalResult);
+    }
+
+    /// Calculate nLength rows into rResults, false if the input data can't be handled.
+    bool calculate(size_t nLength, std::vector<double>& rResults) const;
+};
+
+bool CompiledFormulaCPU::checkReference(const formula::FormulaToken& rToken, size_t nLength)
+{
+    if (rToken.GetType() == formula::svSingleVectorRef)
+    {
+        const auto& rRef = static_cast<const formula::SingleVectorRefToken&>(rToken);
+        return !rRef.GetArray().mpStringArray;
+    }
+
+    const auto& rRef = static_cast<const formula::DoubleVectorRefToken&>(rToken);
+    // With a relative start and an absolute end the range is swapped once
+    // the start passes the end, and the arrays don't cover the rows below.
+    if (!rRef.IsStartFixed() && rRef.IsEndFixed() && nLength > rRef.GetRefRowSize())
+        return false;
+
+    for (const formula::VectorRefArray& rArray : rRef.GetArrays())
+    {
+        if (rArray.mpStringArray)
+            return false;
+    }
+    return true;
+}
+
+void CompiledFormulaCPU::binaryOperation(OpCode eOp, const CPUOperand& rLeft, const CPUOperand& rRight,
+                                         size_t nLength, CPUOperand& rResult)
+{
+    rResult.maValues.resize(nLength);
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        // References to empty cells are 0 here, computed NaN values are errors.
+        double fLeft = rLeft.get(i);
+        double fRight = rRight.get(i);
+        if (std::isnan(fLeft) && rLeft.mpRef)
+            fLeft = 0.0;
+        if (std::isnan(fRight) && rRight.mpRef)
+            fRight = 0.0;
+
+        // ScInterpreter stops at the first error, i.e. that of the left operand.
+        if (std::isnan(fLeft))
+        {
+            rResult.maValues[i] = fLeft;
+            continue;
+        }
+        if (std::isnan(fRight))
+        {
+            rResult.maValues[i] = fRight;
+            continue;
+        }
+
+        double fVal;
+        switch (eOp)
+        {
+            case ocAdd:
+                fVal = rtl::math::approxAdd(fLeft, fRight);
+            break;
+            case ocSub:
+                fVal = rtl::math::approxSub(fLeft, fRight);
+            break;
+            case ocMul:
+                fVal = fLeft * fRight;
+            break;
+            case ocDiv:
+                fVal = sc::div(fLeft, fRight);
+            break;
+            default:
+            {
+                const double fCompare = sc::CompareFunc(fLeft, fRight);
+                bool bRes;
+                switch (eOp)
+                {
+                    case ocEqual:        bRes = fCompare == 0.0; break;
+                    case ocNotEqual:     bRes = fCompare != 0.0; break;
+                    case ocLess:         bRes = fCompare < 0.0;  break;
+                    case ocGreater:      bRes = fCompare > 0.0;  break;
+                    case ocLessEqual:    bRes = fCompare <= 0.0; break;
+                    case ocGreaterEqual: bRes = fCompare >= 0.0; break;
+                    default:
+                        assert(!"CompiledFormulaCPU: unexpected binary operation");
+                        bRes = false;
+                }
+                fVal = bRes ? 1.0 : 0.0;
+            }
+        }
+        rResult.maValues[i] = finiteOrError(fVal);
+    }
+}
+
+void CompiledFormulaCPU::aggregate(OpCode eOp, const CPUOperand* pArgs, size_t nArgs, size_t nLength,
+                                   CPUOperand& rResult)
+{
+    rResult.maValues.resize(nLength);
+    for (size_t nRow = 0; nRow < nLength; ++nRow)
+    {
+        // Arguments are processed last to first, like ScInterpreter pops
+        // them, so that the sums are accumulated in the same order.  The
+        // error of the first argument having one wins.
+        KahanSum fSum = 0.0;
+        double fMin = std::numeric_limits<double>::max();
+        double fMax = std::numeric_limits<double>::lowest();
+        size_t nCount = 0;
+        double fError = 0.0;
+        bool bError = false;
+
+        auto addValue = [&](double fVal)
+        {
+            fSum += fVal;
+            fMin = std::min(fMin, fVal);
+            fMax = std::max(fMax, fVal);
+            ++nCount;
+        };
+
+        for (size_t nArg = nArgs; nArg-- > 0; )
+        {
+            const CPUOperand& rArg = pArgs[nArg];
+            if (!rArg.mpRef || rArg.mpRef->GetType() == formula::svSingleVectorRef)
+            {
+                const double fVal = rArg.get(nRow);
+                if (!std::isnan(fVal))
+                    addValue(fVal);
+                else if (!rArg.mpRef && eOp != ocCount)
+                {
+                    fError = fVal;
+                    bError = true;
+                }
+                continue;
+            }
+
+            const auto* pRef = static_cast<const formula::DoubleVectorRefToken*>(rArg.mpRef);
+            size_t nStart, nEnd;
+            getRangeWindow(*pRef, nRow, nStart, nEnd);
+            KahanSum fRangeSum = 0.0;
+            for (const formula::VectorRefArray& rArray : pRef->GetArrays())
+            {
+                const double* pNum = rArray.mpNumericArray;
+                if (!pNum || nStart == nEnd)
+                    continue;
+
+                switch (eOp)
+                {
+                    case ocSum:
+                    {
+                        // Sum runs of non-empty cells at once, like the
+                        // interpreter does with the blocks of numeric cells.
+                        KahanSum fColSum = 0.0;
+                        for (size_t i = nStart; i < nEnd; )
+                        {
+                            const size_t nRun = sc::op::findNonFinite(pNum + i, nEnd - i);
+                            if (nRun)
+                                fColSum += sc::op::sumArray(pNum + i, nRun);
+                            i += nRun + 1;
+                        }
+                        fRangeSum += fColSum;
+                    }
+                    break;
+                    case ocMin:
+                        fMin = sc::op::minArray(pNum + nStart, nEnd - nStart, fMin);
+                        nCount += std::count_if(pNum + nStart, pNum + nEnd,
+                                                [](double f) { return !std::isnan(f); });
+                    break;
+                    case ocMax:
+                        fMax = sc::op::maxArray(pNum + nStart, nEnd - nStart, fMax);
+                        nCount += std::count_if(pNum + nStart, pNum + nEnd,
+                                                [](double f) { return !std::isnan(f); });
+                    break;
+                    default:
+                        for (size_t i = nStart; i < nEnd; ++i)
+                        {
+                            if (!std::isnan(pNum[i]))
+                                addValue(pNum[i]);
+                        }
+                }
+            }
+            if (eOp == ocSum)
+                fSum += fRangeSum;
+        }
+
+        double fVal;
+        switch (eOp)
+        {
+            case ocSum:
+                fVal = fSum.get();
+            break;
+            case ocAverage:
+                fVal = sc::div(fSum.get(), nCount);
+            break;
+            case ocMin:
+                fVal = nCount ? fMin : 0.0;
+            break;
+            case ocMax:
+                fVal = nCount ? fMax : 0.0;
+            break;
+            default:
+                fVal = nCount;
+        }
+        rResult.maValues[nRow] = bError ? fError : finiteOrError(fVal);
+    }
+}
+
+bool CompiledFormulaCPU::calculate(size_t nLength, std::vector<double>& rResults) const
+{
+    std::vector<CPUOperand> aStack;
+    for (const formula::FormulaToken* p : maProgram)
+    {
+        const OpCode eOp = p->GetOpCode();
+        if (eOp == ocPush)
+        {
+            CPUOperand aOperand;
+            if (p->GetType() == formula::svDouble)
+                aOperand.mfScalar = p->GetDouble();
+            else if (p->GetType() == formula::svSingleVectorRef || p->GetType() == formula::svDoubleVectorRef)
+            {
+                if (!checkReference(*p, nLength))
+                    return false;
+                aOperand.mpRef = p;
+            }
+            else
+                // Plain references are left only if the group conversion did not happen.
+                return false;
+            aStack.push_back(std::move(aOperand));
+            continue;
+        }
+
+        CPUOperand aResult;
+        switch (eOp)
+        {
+            case ocNegSub:
+            {
+                const CPUOperand& rArg = aStack.back();
+                aResult.maValues.resize(nLength);
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    double fVal = rArg.get(i);
+                    if (std::isnan(fVal) && rArg.mpRef)
+                        fVal = 0.0;
+                    aResult.maValues[i] = std::isnan(fVal) ? fVal : -fVal;
+                }
+                aStack.pop_back();
+            }
+            break;
+            case ocSum:
+            case ocAverage:
+            case ocMin:
+            case ocMax:
+            case ocCount:
+            {
+                const size_t nArgs = p->GetParamCount();
+                aggregate(eOp, aStack.data() + aStack.size() - nArgs, nArgs, nLength, aResult);
+                aStack.resize(aStack.size() - nArgs);
+            }
+            break;
+            default:
+                binaryOperation(eOp, aStack[aStack.size() - 2], aStack.back(), nLength, aResult);
+                aStack.resize(aStack.size() - 2);
+        }
+        aStack.push_back(std::move(aResult));
+    }
+
+    assert(aStack.size() == 1 && !aStack.back().mpRef && !aStack.back().isScalar());
+    rResults = std::move(aStack.back().maValues);
+    return true;
+}
+
+}
+
+FormulaGroupInterpreterCPU& FormulaGroupInterpreterCPU::get()
+{
+    static FormulaGroupInterpreterCPU aInstance;
+    return aInstance;
+}
+
+bool FormulaGroupInterpreterCPU::isSupported(const ScTokenArray& rCode, bool& rLogicalResult)
+{
+    return compileForCPU(rCode, nullptr, rLogicalResult);
+}
+
+ScMatrixRef FormulaGroupInterpreterCPU::inverseMatrix(const ScMatrix& /*rMat*/)
+{
+    return ScMatrixRef();
+}
+
+bool FormulaGroupInterpreterCPU::interpret(ScDocument& rDoc, const ScAddress& rTopPos,
+                                           ScFormulaCellGroupRef& xGroup, ScTokenArray& rCode)
+{
+    // The converted code does not have RPN tokens yet.
+    ScCompiler aComp(rDoc, rTopPos, rCode, rDoc.GetGrammar());
+    aComp.EnableJumpCommandReorder(false);
+    aComp.CompileTokenArray();
+
+    CompiledFormulaCPU aFormula;
+    if (!aFormula.compile(rCode))
+        return false;
+
+    std::vector<double> aResults;
+    if (!aFormula.calculate(xGroup->mnLength, aResults))
+        return false;
+
+    rDoc.SetFormulaResults(rTopPos, aResults.data(), aResults.size());
+    return true;
+}
+
 #if HAVE_FEATURE_OPENCL
 void FormulaGroupInterpreter::fillOpenCLInfo(std::vector<OpenCLPlatformInfo>& rPlatforms)
 {
@@ -62,6 +62,7 @@
 #include <queryparam.hxx>
 #include <queryentry.hxx>
 #include <queryiter.hxx>
+#include <rangecache.hxx>
 #include <tokenarray.hxx>
 #include <compare.hxx>
 
@@ -10094,6 +10095,29 @@ static bool lcl_LookupQuery( ScAddress & o_rResultPos, ScDocument& rDoc, ScInter
     {
         if( ScQueryCellIteratorSortedCache::CanBeUsed( rDoc, rParam, rParam.nTab, cell, refData, rContext ))
         {
+            // Exact match, use the hash index of the caches instead of searching.
+            const ScQueryEntry::Item& rItem = rParam.GetEntry(0).GetQueryItem();
+            bool bUseIndex = true;
+            for (SCCOL nCol : rDoc.GetAllocatedColumnsRange(rParam.nTab, rParam.nCol1, rParam.nCol2))
+            {
+                ScRange aSortedRangeRange( nCol, rParam.nRow1, rParam.nTab, nCol, rParam.nRow2, rParam.nTab);
+                const ScSortedRangeCache& rCache = rDoc.GetSortedRangeCache( aSortedRangeRange, rParam, &rContext );
+                if (!rCache.canFindEqual(rItem))
+                {
+                    bUseIndex = false;
+                    break;
+                }
+                SCROW nRow = rCache.findFirstEqualRow(rItem);
+                if (nRow >= 0)
+                {
+                    o_rResultPos.SetCol( nCol);
+                    o_rResultPos.SetRow( nRow);
+                    return true;
+                }
+            }
+            if (bUseIndex)
+                return false;
+
             ScQueryCellIteratorSortedCache aCellIter( rDoc, rContext, rParam.nTab, rParam, false);
             if (aCellIter.GetFirst())
             {
@@ -10173,7 +10197,7 @@ bool ScInterpreter::LookupQueryWithCache( ScAddress & o_rResultPos,
     {
         ScRange aLookupRange( rParam.nCol1, rParam.nRow1, rParam.nTab,
                 rParam.nCol2, rParam.nRow2, rParam.nTab);
-        ScLookupCache& rCache = mrDoc.GetLookupCache( aLookupRange, &mrContext );
+        ScLookupCache& rCache = mrDoc.GetLookupCache( aLookupRange );
         ScLookupCache::QueryCriteria aCriteria( rEntry);
         ScLookupCache::Result eCacheResult = rCache.lookup( o_rResultPos,
                 aCriteria, aPos);
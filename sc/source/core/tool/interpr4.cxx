@@ -1776,6 +1776,30 @@ formula::FormulaToken* ScInterpreter::CreateFormulaDoubleToken( double fVal, SvN
     return p;
 }
 
+formula::FormulaToken* ScInterpreter::CreateFormulaStringToken( const svl::SharedString& rString )
+{
+    assert( mrContext.maStringTokens.size() == TOKEN_CACHE_SIZE );
+
+    // Find a spare token, like CreateFormulaDoubleToken() does.
+    for ( auto p : mrContext.maStringTokens )
+    {
+        if (p && p->GetRef() == 1)
+        {
+            p->SetString( rString );
+            return p;
+        }
+    }
+
+    // Allocate a new token
+    auto p = new FormulaStringToken( rString );
+    if ( mrContext.maStringTokens[mrContext.mnStringTokenCachePos] )
+        mrContext.maStringTokens[mrContext.mnStringTokenCachePos]->DecRef();
+    mrContext.maStringTokens[mrContext.mnStringTokenCachePos] = p;
+    p->IncRef();
+    mrContext.mnStringTokenCachePos = (mrContext.mnStringTokenCachePos + 1) % TOKEN_CACHE_SIZE;
+    return p;
+}
+
 formula::FormulaToken* ScInterpreter::CreateDoubleOrTypedToken( double fVal )
 {
     // NumberFormat::NUMBER is the default untyped double.
@@ -1818,7 +1842,7 @@ void ScInterpreter::PushString( const OUString& rStr )
 void ScInterpreter::PushString( const svl::SharedString& rString )
 {
     if (!IfErrorPushError())
-        PushTempTokenWithoutError( new FormulaStringToken( rString ) );
+        PushTempTokenWithoutError( CreateFormulaStringToken( rString ) );
 }
 
 void ScInterpreter::PushSingleRef(SCCOL nCol, SCROW nRow, SCTAB nTab)
@@ -3614,8 +3638,9 @@ void ScInterpreter::ScTableOp()
         {   // emulate broadcast and indirectly collect cell pointers
             ScRefCellValue aCell(mrDoc, rPos);
             if (aCell.getType() == CELLTYPE_FORMULA)
-                aCell.getFormula()->SetTableOpDirty();
+                aCell.getFormula()->SetTableOpDirty( false );
         }
+        mrDoc.TrackFormulas( SfxHintId::ScTableOpDirty );
     }
     else
     {   // broadcast and indirectly collect cell pointers and positions
@@ -3649,8 +3674,9 @@ void ScInterpreter::ScTableOp()
     // set dirty again once more to be able to recalculate original
     for ( const auto& pCell : aTableOp.aNotifiedFormulaCells )
     {
-        pCell->SetTableOpDirty();
+        pCell->SetTableOpDirty( false );
     }
+    mrDoc.TrackFormulas( SfxHintId::ScTableOpDirty );
 
     // save these params for next incarnation
     if ( !bReuseLastParams )
@@ -38,6 +38,7 @@
 #include <scresid.hxx>
 #include <cellkeytranslator.hxx>
 #include <formulagroup.hxx>
+#include <arraysumfunctor.hxx>
 #include <vcl/svapp.hxx> //Application::
 
 #include <vector>
@@ -1662,11 +1663,62 @@ void ScInterpreter::ScSumProduct()
     // array of references. We calculate the proper individual arrays if sizes
     // match.
 
+    // Whole column references like SUMPRODUCT(A:A;B:B) would create mostly
+    // empty matrices of a million rows each. Rows below the data of all the
+    // ranges contribute nothing to the sum, so with plain ranges of equal
+    // height cut all of them by the same number of rows, which keeps the
+    // dimensions equal.
+    std::vector<ScRange> aRanges;
+    bool bTrim = true;
+    for (short i = 1; i <= nParamCount && bTrim; ++i)
+        bTrim = GetStackType(i) == svDoubleRef;
+    if (bTrim)
+    {
+        aRanges.resize(nParamCount);
+        for (short i = nParamCount; i-- > 0; )
+            PopDoubleRef(aRanges[i]);
+        if (nGlobalError != FormulaError::NONE)
+        {
+            PushError(nGlobalError);
+            return;
+        }
+
+        const SCROW nRows = aRanges[0].aEnd.Row() - aRanges[0].aStart.Row() + 1;
+        SCROW nDataRows = 1;
+        for (const ScRange& rRange : aRanges)
+        {
+            if (rRange.aStart.Tab() != rRange.aEnd.Tab()
+                    || rRange.aEnd.Row() - rRange.aStart.Row() + 1 != nRows)
+            {
+                nDataRows = nRows;
+                break;
+            }
+            const SCROW nLastRow = mrDoc.GetLastDataRow(rRange.aStart.Tab(), rRange.aStart.Col(),
+                                                        rRange.aEnd.Col(), rRange.aEnd.Row());
+            nDataRows = std::max(nDataRows, nLastRow - rRange.aStart.Row() + 1);
+        }
+        if (nDataRows < nRows)
+        {
+            for (ScRange& rRange : aRanges)
+                rRange.aEnd.SetRow(rRange.aStart.Row() + nDataRows - 1);
+        }
+    }
+
     size_t nInRefList = 0;
+    auto getMatrix = [&](short& rParam) -> ScMatrixRef
+    {
+        if (aRanges.empty())
+            return GetMatrix(rParam, nInRefList);
+        const ScRange& rRange = aRanges[rParam];
+        return CreateMatrixFromDoubleRef(nullptr, rRange.aStart.Col(), rRange.aStart.Row(),
+                                         rRange.aStart.Tab(), rRange.aEnd.Col(), rRange.aEnd.Row(),
+                                         rRange.aEnd.Tab());
+    };
+
     ScMatrixRef pMatLast;
     ScMatrixRef pMat;
 
-    pMatLast = GetMatrix( --nParamCount, nInRefList);
+    pMatLast = getMatrix( --nParamCount);
     if (!pMatLast)
     {
         PushIllegalParameter();
@@ -1680,7 +1732,7 @@ void ScInterpreter::ScSumProduct()
 
     while (nParamCount--)
     {
-        pMat = GetMatrix( nParamCount, nInRefList);
+        pMat = getMatrix( nParamCount);
         if (!pMat)
         {
             PushIllegalParameter();
@@ -1696,7 +1748,19 @@ void ScInterpreter::ScSumProduct()
         pMat->MergeDoubleArrayMultiply(aResArray);
     }
 
-    KahanSum fSum = 0.0;
+    // Vectorized fast path, only if that hits an error or ElementNaN go
+    // through the elements one by one to find out which.
+    size_t nFast = 0;
+    KahanSum fSum = sc::op::executeFast(nFast, aResArray.size(), aResArray.data());
+    for (; nFast < aResArray.size(); ++nFast)
+        fSum += aResArray[nFast];
+    if (std::isfinite(fSum.get()))
+    {
+        PushDouble(fSum.get());
+        return;
+    }
+
+    fSum = 0.0;
     for( double fPosArray : aResArray )
     {
         FormulaError nErr = GetDoubleErrorValue(fPosArray);
@@ -23,8 +23,6 @@
 
 #include <document.hxx>
 #include <formula/token.hxx>
-#include <lookupcache.hxx>
-#include <rangecache.hxx>
 #include <algorithm>
 
 ScInterpreterContextPool ScInterpreterContextPool::aThreadedInterpreterPool(true);
@@ -34,6 +32,8 @@ ScInterpreterContext::ScInterpreterContext(const ScDocument& rDoc, SvNumberForma
     : mpDoc(&rDoc)
     , mnTokenCachePos(0)
     , maTokens(TOKEN_CACHE_SIZE, nullptr)
+    , mnStringTokenCachePos(0)
+    , maStringTokens(TOKEN_CACHE_SIZE, nullptr)
     , pInterpreter(nullptr)
     , mpFormatter(pFormatter)
 {
@@ -49,15 +49,18 @@ void ScInterpreterContext::ResetTokens()
 
     mnTokenCachePos = 0;
     std::fill(maTokens.begin(), maTokens.end(), nullptr);
+
+    for (auto p : maStringTokens)
+        if (p)
+            p->DecRef();
+
+    mnStringTokenCachePos = 0;
+    std::fill(maStringTokens.begin(), maStringTokens.end(), nullptr);
 }
 
 void ScInterpreterContext::SetDocAndFormatter(const ScDocument& rDoc, SvNumberFormatter* pFormatter)
 {
-    if (mpDoc != &rDoc)
-    {
-        mxScLookupCache.reset();
-        mpDoc = &rDoc;
-    }
+    mpDoc = &rDoc;
     mpFormatter = pFormatter;
 }
 
@@ -68,18 +71,11 @@ void ScInterpreterContext::initFormatTable()
 
 void ScInterpreterContext::Cleanup()
 {
-    // Do not disturb mxScLookupCache.
     maConditions.clear();
     maDelayedSetNumberFormat.clear();
     ResetTokens();
 }
 
-void ScInterpreterContext::ClearLookupCache(const ScDocument* pDoc)
-{
-    if (pDoc == mpDoc)
-        mxScLookupCache.reset();
-}
-
 SvNumFormatType ScInterpreterContext::GetNumberFormatType(sal_uInt32 nFIndex) const
 {
     if (!mpDoc->IsThreadedGroupCalcInProgress())
@@ -164,15 +160,6 @@ void ScInterpreterContextPool::ReturnToPool()
     }
 }
 
-// static
-void ScInterpreterContextPool::ClearLookupCaches(const ScDocument* pDoc)
-{
-    for (auto& rPtr : aThreadedInterpreterPool.maPool)
-        rPtr->ClearLookupCache(pDoc);
-    for (auto& rPtr : aNonThreadedInterpreterPool.maPool)
-        rPtr->ClearLookupCache(pDoc);
-}
-
 /* ScThreadedInterpreterContextGetterGuard */
 
 ScThreadedInterpreterContextGetterGuard::ScThreadedInterpreterContextGetterGuard(
@@ -71,6 +71,7 @@ ScLookupCache::QueryCriteria::~QueryCriteria()
 ScLookupCache::Result ScLookupCache::lookup( ScAddress & o_rResultAddress,
         const QueryCriteria & rCriteria, const ScAddress & rQueryAddress ) const
 {
+    std::shared_lock aGuard( maMutex );
     auto it( maQueryMap.find( QueryKey( rQueryAddress,
                     rCriteria.getQueryOp())));
     if (it == maQueryMap.end())
@@ -86,6 +87,7 @@ ScLookupCache::Result ScLookupCache::lookup( ScAddress & o_rResultAddress,
 
 SCROW ScLookupCache::lookup( const QueryCriteria & rCriteria ) const
 {
+    std::shared_lock aGuard( maMutex );
     // try to find the row index for which we have already performed lookup
     auto it = std::find_if(maQueryMap.begin(), maQueryMap.end(),
         [&rCriteria](const std::pair<QueryKey, QueryCriteriaAndResult>& rEntry) {
@@ -106,6 +108,7 @@ bool ScLookupCache::insert( const ScAddress & rResultAddress,
     QueryCriteriaAndResult aResult( rCriteria, rResultAddress);
     if (!bAvailable)
         aResult.maAddress.SetRow(-1);
+    std::unique_lock aGuard( maMutex );
     bool bInserted = maQueryMap.insert( ::std::pair< const QueryKey,
             QueryCriteriaAndResult>( aKey, aResult)).second;
 
@@ -24,8 +24,12 @@
 #include <queryevaluator.hxx>
 #include <queryparam.hxx>
 
+#include <cstring>
+
+#include <rtl/math.hxx>
 #include <sal/log.hxx>
 #include <svl/numformat.hxx>
+#include <svl/sharedstringpool.hxx>
 #include <unotools/collatorwrapper.hxx>
 
 static bool needsDescending(ScQueryOp op)
@@ -113,6 +117,13 @@ ScSortedRangeCache::ScSortedRangeCache(ScDocument* pDoc, const ScRange& rRange,
                     return;
             }
         }
+        if (mQueryOp == SC_EQUAL)
+        {
+            mValueEntries.reserve(rowData.size());
+            for (const RowData& d : rowData)
+                mValueEntries.push_back(ValueEntry{ d.value, d.row });
+            buildValueIndex();
+        }
         std::stable_sort(rowData.begin(), rowData.end(),
                          [](const RowData& d1, const RowData& d2) { return d1.value < d2.value; });
         if (needsDescending(entry.eOp))
@@ -150,6 +161,17 @@ ScSortedRangeCache::ScSortedRangeCache(ScDocument* pDoc, const ScRange& rRange,
                 OUString string = evaluator.getCellString(cell, nRow, nCol, &sharedString);
                 if (sharedString)
                     string = sharedString->getString();
+                if (mQueryOp == SC_EQUAL)
+                {
+                    svl::SharedString key = sharedString
+                                                ? *sharedString
+                                                : pDoc->GetSharedStringPool().intern(string);
+                    const rtl_uString* data = mValueType == ValueType::StringsCaseSensitive
+                                                  ? key.getData()
+                                                  : key.getDataIgnoreCase();
+                    if (mStringRows.emplace(data, nRow).second)
+                        mStrings.push_back(std::move(key));
+                }
                 rowData.push_back(RowData{ nRow, string });
             }
         }
@@ -173,6 +195,83 @@ ScSortedRangeCache::ScSortedRangeCache(ScDocument* pDoc, const ScRange& rRange,
     mValid = true;
 }
 
+sal_uInt64 ScSortedRangeCache::bucketForValue(double value)
+{
+    // rtl::math::approxEqual() considers values equal if they differ by less than
+    // 2^-48 of their magnitude, i.e. by less than 32 units in the last place. Dropping
+    // the low 6 bits of the representation makes such values end up in the same
+    // or an adjacent bucket (the representation of same-signed doubles is monotonic).
+    if (value == 0.0)
+        value = 0.0; // -0.0
+    sal_uInt64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits >> 6;
+}
+
+void ScSortedRangeCache::buildValueIndex()
+{
+    // mValueEntries are in row order, stable sort keeps that inside a bucket.
+    std::stable_sort(mValueEntries.begin(), mValueEntries.end(),
+                     [](const ValueEntry& e1, const ValueEntry& e2) {
+                         return bucketForValue(e1.value) < bucketForValue(e2.value);
+                     });
+    mValueBuckets.reserve(mValueEntries.size());
+    for (size_t i = 0; i < mValueEntries.size();)
+    {
+        const sal_uInt64 bucket = bucketForValue(mValueEntries[i].value);
+        size_t end = i + 1;
+        while (end < mValueEntries.size() && bucketForValue(mValueEntries[end].value) == bucket)
+            ++end;
+        mValueBuckets.emplace(bucket, std::make_pair(sal_uInt32(i), sal_uInt32(end)));
+        i = end;
+    }
+}
+
+bool ScSortedRangeCache::canFindEqual(const ScQueryEntry::Item& item) const
+{
+    if (mQueryOp != SC_EQUAL || item.mbMatchEmpty || item.mbRoundForFilter)
+        return false;
+    if (mValueType == ValueType::Values)
+        return true;
+    // Strings not from the string pool cannot be compared by identity.
+    return item.maString.getData() != nullptr && item.maString.getDataIgnoreCase() != nullptr;
+}
+
+SCROW ScSortedRangeCache::findFirstEqualRow(const ScQueryEntry::Item& item) const
+{
+    assert(canFindEqual(item));
+    if (mValueType != ValueType::Values)
+    {
+        const rtl_uString* data = mValueType == ValueType::StringsCaseSensitive
+                                      ? item.maString.getData()
+                                      : item.maString.getDataIgnoreCase();
+        auto it = mStringRows.find(data);
+        return it != mStringRows.end() ? it->second : -1;
+    }
+
+    const double value = item.mfVal;
+    const sal_uInt64 bucket = bucketForValue(value);
+    SCROW firstRow = -1;
+    for (sal_uInt64 b : { bucket - 1, bucket, bucket + 1 })
+    {
+        auto it = mValueBuckets.find(b);
+        if (it == mValueBuckets.end())
+            continue;
+        for (sal_uInt32 i = it->second.first; i < it->second.second; ++i)
+        {
+            const ValueEntry& entry = mValueEntries[i];
+            if (firstRow >= 0 && entry.row >= firstRow)
+                break;
+            if (rtl::math::approxEqual(entry.value, value))
+            {
+                firstRow = entry.row;
+                break;
+            }
+        }
+    }
+    return firstRow;
+}
+
 void ScSortedRangeCache::Notify(const SfxHint& rHint)
 {
     if (!mpDoc->IsInDtorClear())
@@ -25,6 +25,7 @@
 #include <mtvelements.hxx>
 #include <compare.hxx>
 #include <matrixoperators.hxx>
+#include <arraysumfunctor.hxx>
 #include <math.hxx>
 
 #include <svl/numformat.hxx>
@@ -36,6 +37,7 @@
 
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <limits>
@@ -1459,6 +1461,12 @@ struct MaxOp
         return std::max(left, right);
     }
 
+    /// Maximum of the finite values of an array, init() if there are none.
+    static double calculate(const double* pArray, size_t nSize)
+    {
+        return sc::op::maxArray(pArray, nSize, init());
+    }
+
     static double boolValue(
         MatrixImplType::boolean_block_type::const_iterator it,
         const MatrixImplType::boolean_block_type::const_iterator& itEnd)
@@ -1481,6 +1489,12 @@ struct MinOp
         return std::min(left, right);
     }
 
+    /// Minimum of the finite values of an array, init() if there are none.
+    static double calculate(const double* pArray, size_t nSize)
+    {
+        return sc::op::minArray(pArray, nSize, init());
+    }
+
     static double boolValue(
         MatrixImplType::boolean_block_type::const_iterator it,
         const MatrixImplType::boolean_block_type::const_iterator& itEnd)
@@ -1552,21 +1566,22 @@ public:
             {
                 typedef MatrixImplType::numeric_block_type block_type;
 
-                block_type::const_iterator it = block_type::begin(*node.data);
-                block_type::const_iterator itEnd = block_type::end(*node.data);
-                if (mbIgnoreErrorValues)
+                const double* pData = &block_type::at(*node.data, 0);
+                size_t nSize = node.size;
+                if (!mbIgnoreErrorValues)
                 {
-                    for (; it != itEnd; ++it)
+                    // The first non-finite value sticks, see Op::compare(),
+                    // so only the finite values before it count.
+                    const size_t nNonFinite = sc::op::findNonFinite(pData, nSize);
+                    if (nNonFinite < nSize)
                     {
-                        if (std::isfinite(*it))
-                            mfVal = Op::compare(mfVal, *it);
+                        mfVal = Op::compare(mfVal, Op::calculate(pData, nNonFinite));
+                        mfVal = Op::compare(mfVal, pData[nNonFinite]);
+                        nSize = 0;
                     }
                 }
-                else
-                {
-                    for (; it != itEnd; ++it)
-                        mfVal = Op::compare(mfVal, *it);
-                }
+                if (nSize > 0)
+                    mfVal = Op::compare(mfVal, Op::calculate(pData, nSize));
 
                 mbHasValue = true;
             }
@@ -2022,14 +2037,25 @@ public:
         {
             case mdds::mtm::element_numeric:
             {
-                double_element_block::const_iterator it = double_element_block::begin(*node.data);
-                double_element_block::const_iterator itEnd = double_element_block::end(*node.data);
-                for (; it != itEnd; ++it, ++miPos)
+                if constexpr (std::is_same_v<Op, ArrayMul>)
                 {
-                    if (GetDoubleErrorValue(*miPos) == FormulaError::ElementNaN)
-                        continue;
+                    // Vectorized, NaN elements of the result are kept just
+                    // like ElementNaN is skipped below.
+                    if (node.size > 0)
+                        sc::op::multiplyArray(&*miPos, &double_element_block::at(*node.data, 0), node.size);
+                    miPos += node.size;
+                }
+                else
+                {
+                    double_element_block::const_iterator it = double_element_block::begin(*node.data);
+                    double_element_block::const_iterator itEnd = double_element_block::end(*node.data);
+                    for (; it != itEnd; ++it, ++miPos)
+                    {
+                        if (GetDoubleErrorValue(*miPos) == FormulaError::ElementNaN)
+                            continue;
 
-                    *miPos = op(*miPos, *it);
+                        *miPos = op(*miPos, *it);
+                    }
                 }
             }
             break;
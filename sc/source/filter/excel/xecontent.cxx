@@ -113,7 +113,9 @@ private:
     sal_uInt32          mnSize;         /// Size of the SST (count of unique strings).
 };
 
-const sal_uInt32 EXC_SST_HASHTABLE_SIZE = 2048;
+// Large documents have hundreds of thousands of unique strings, keep the
+// sorted buckets short.
+const sal_uInt32 EXC_SST_HASHTABLE_SIZE = 16384;
 
 XclExpSstImpl::XclExpSstImpl() :
     maHashTab( EXC_SST_HASHTABLE_SIZE ),
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <oox/helper/refvector.hxx>
+#include <svl/sharedstring.hxx>
 #include "stylesbuffer.hxx"
 
 class EditTextObject;
@@ -31,6 +32,7 @@ namespace com::sun::star {
 }
 
 namespace oox { class SequenceInputStream; }
+namespace svl { class SharedStringPool; }
 
 namespace oox::xls {
 
@@ -228,6 +230,13 @@ public:
                             OUString& orString,
                             const oox::xls::Font* pFirstPortionFont ) const;
 
+    /** Interns the text into the passed pool if this string consists of a
+        single unformatted portion, see getPooledPlainString(). */
+    void                internPlainString( svl::SharedStringPool& rPool );
+    /** Returns the text interned by internPlainString(), a string without
+        data if there was none. */
+    const svl::SharedString& getPooledPlainString() const { return maPooledString; }
+
     /** Converts the string and writes it into the passed XText, replace old contents of the text object,.
         @param rxText  The XText interface of the target object.
      */
@@ -253,6 +262,7 @@ private:
     std::vector<RichStringPortion>  maTextPortions; /// String portions with font data.
     std::unique_ptr<PhoneticSettings> mxPhonSettings; /// Phonetic settings for this string.
     PhoneticVector      maPhonPortions; /// Phonetic text portions.
+    svl::SharedString   maPooledString; /// Pooled text, if this is a plain string.
 };
 
 typedef std::shared_ptr< RichString > RichStringRef;
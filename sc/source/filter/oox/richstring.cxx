@@ -30,6 +30,7 @@
 #include <oox/helper/propertyset.hxx>
 #include <oox/token/tokens.hxx>
 #include <editutil.hxx>
+#include <svl/sharedstringpool.hxx>
 
 #include <vcl/svapp.hxx>
 
@@ -461,6 +462,15 @@ void RichString::finalizeImport(const WorkbookHelper& rHelper)
         rPortion.finalizeImport( rHelper );
 }
 
+void RichString::internPlainString( svl::SharedStringPool& rPool )
+{
+    // Whether the cell font needs rich text formatting is only known per
+    // cell, extractPlainString() is asked again there.
+    OUString aText;
+    if( extractPlainString( aText, nullptr ) && !aText.isEmpty() )
+        maPooledString = rPool.intern( aText );
+}
+
 bool RichString::extractPlainString( OUString& orString, const oox::xls::Font* pFirstPortionFont ) const
 {
     if( !maPhonPortions.empty() )
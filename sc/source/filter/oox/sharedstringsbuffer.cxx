@@ -18,9 +18,45 @@
  */
 
 #include <sharedstringsbuffer.hxx>
+#include <document.hxx>
+
+#include <comphelper/threadpool.hxx>
+#include <svl/sharedstringpool.hxx>
 
 namespace oox::xls {
 
+namespace {
+
+/** Below this many shared strings interning them on the thread pool is not worth it. */
+constexpr size_t nMinStringsForThreadedIntern = 4096;
+
+class InternStringsTask : public comphelper::ThreadTask
+{
+    svl::SharedStringPool& mrPool;
+    const std::vector< RichStringRef >& mrStrings;
+    size_t mnBegin;
+    size_t mnEnd;
+
+public:
+    InternStringsTask( const std::shared_ptr< comphelper::ThreadTaskTag >& rTag, svl::SharedStringPool& rPool,
+                       const std::vector< RichStringRef >& rStrings, size_t nBegin, size_t nEnd ) :
+        comphelper::ThreadTask( rTag ),
+        mrPool( rPool ),
+        mrStrings( rStrings ),
+        mnBegin( nBegin ),
+        mnEnd( nEnd )
+    {
+    }
+
+    virtual void doWork() override
+    {
+        for( size_t i = mnBegin; i < mnEnd; ++i )
+            mrStrings[ i ]->internPlainString( mrPool );
+    }
+};
+
+}
+
 SharedStringsBuffer::SharedStringsBuffer( const WorkbookHelper& rHelper ) :
      WorkbookHelper( rHelper )
 {
@@ -37,6 +73,26 @@ void SharedStringsBuffer::finalizeImport()
 {
     for (auto & rString : maStrings)
         rString->finalizeImport(*this);
+
+    /*  Intern the plain strings once here instead of once per cell referring
+        to them. The string pool is safe to use from several threads, which
+        pays off for the large string tables of big workbooks. */
+    svl::SharedStringPool& rPool = getScDocument().GetSharedStringPool();
+    const size_t nCount = maStrings.size();
+    comphelper::ThreadPool& rThreadPool = comphelper::ThreadPool::getSharedOptimalPool();
+    const size_t nThreads = rThreadPool.getWorkerCount();
+    if( nCount < nMinStringsForThreadedIntern || nThreads < 2 )
+    {
+        for (auto & rString : maStrings)
+            rString->internPlainString(rPool);
+        return;
+    }
+
+    std::shared_ptr< comphelper::ThreadTaskTag > aTag = comphelper::ThreadPool::createThreadTaskTag();
+    for( size_t i = 0; i < nThreads; ++i )
+        rThreadPool.pushTask( std::make_unique< InternStringsTask >( aTag, rPool, maStrings,
+            nCount * i / nThreads, nCount * (i + 1) / nThreads ) );
+    rThreadPool.waitUntilDone( aTag );
 }
 
 RichStringRef SharedStringsBuffer::getString( sal_Int32 nStringId ) const
@@ -123,7 +123,15 @@ void SheetDataBuffer::setStringCell( const CellModel& rModel, const RichStringRe
     OUString aText;
     if( rxString->extractPlainString( aText, pFirstPortionFont ) )
     {
-        setStringCell( rModel, aText );
+        const svl::SharedString& rPooled = rxString->getPooledPlainString();
+        if( rPooled.getData() )
+        {
+            // shared strings are interned once for all cells referring to them
+            getDocImport().setStringCell( rModel.maCellAddr, rPooled );
+            setCellFormat( rModel );
+        }
+        else
+            setStringCell( rModel, aText );
     }
     else
     {
@@ -585,7 +585,7 @@ void WorkbookFragment::recalcFormulaCells()
         bHardRecalc = true;
 
     if (bHardRecalc)
-        rDocSh.DoHardRecalc();
+        rDocSh.DoHardRecalcAfterLoad();
     else
     {
         getDocImport().broadcastRecalcAfterImport();
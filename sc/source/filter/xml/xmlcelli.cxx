@@ -1071,7 +1071,7 @@ void ScXMLTableRowCellContext::PutTextCell( const ScAddress& rCurrentPos,
         ScDocumentImport& rDoc = rXMLImport.GetDoc();
         if (maStringValue)
         {
-            rDoc.setStringCell(rCurrentPos, *maStringValue);
+            rDoc.setStringCell(rCurrentPos, InternString(*maStringValue));
             bDoIncrement = true;
         }
         else if (mbEditEngineHasText)
@@ -1079,7 +1079,7 @@ void ScXMLTableRowCellContext::PutTextCell( const ScAddress& rCurrentPos,
             if (maFirstParagraph)
             {
                 // This is a normal text without format runs.
-                rDoc.setStringCell(rCurrentPos, *maFirstParagraph);
+                rDoc.setStringCell(rCurrentPos, InternString(*maFirstParagraph));
             }
             else
             {
@@ -1099,7 +1099,7 @@ void ScXMLTableRowCellContext::PutTextCell( const ScAddress& rCurrentPos,
         }
         else if ( nCurrentCol > 0 && pOUText && !pOUText->isEmpty() )
         {
-            rDoc.setStringCell(rCurrentPos, *pOUText);
+            rDoc.setStringCell(rCurrentPos, InternString(*pOUText));
             bDoIncrement = true;
         }
         else
@@ -1477,6 +1477,18 @@ void ScXMLTableRowCellContext::HasSpecialCaseFormulaText()
         mbCheckWithCompilerForError = true;
 }
 
+const svl::SharedString& ScXMLTableRowCellContext::InternString( const OUString& rStr )
+{
+    // Repeated rows and columns put the same text into every cell, which
+    // would otherwise hash and look it up in the pool once per cell.
+    if (!maInternedString.getData() || maInternedSource != rStr)
+    {
+        maInternedSource = rStr;
+        maInternedString = rXMLImport.GetDoc().getDoc().GetSharedStringPool().intern(rStr);
+    }
+    return maInternedString;
+}
+
 bool ScXMLTableRowCellContext::IsPossibleErrorString() const
 {
     if(mbNewValueType && !mbErrorValue)
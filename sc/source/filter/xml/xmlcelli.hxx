@@ -22,6 +22,7 @@
 #include "importcontext.hxx"
 #include <formula/grammar.hxx>
 #include <svl/itemset.hxx>
+#include <svl/sharedstring.hxx>
 #include <editeng/editdata.hxx>
 
 #include <optional>
@@ -64,6 +65,8 @@ class ScXMLTableRowCellContext : public ScXMLImportContext
     std::optional<OUString> maStringValue;         /// office:string-value attribute
     std::optional<OUString> maContentValidationName;
     std::optional<OUString> maFirstParagraph; /// unformatted first paragraph, for better performance.
+    OUString maInternedSource;                /// last text given to InternString()
+    svl::SharedString maInternedString;       /// pooled maInternedSource
 
     ScEditEngineDefaulter* mpEditEngine;
     OUStringBuffer maParagraph{32};
@@ -119,6 +122,10 @@ class ScXMLTableRowCellContext : public ScXMLImportContext
 
     bool IsPossibleErrorString() const;
 
+    /** Intern rStr into the document's string pool, reusing the result for
+        repeated cells of this context. */
+    const svl::SharedString& InternString( const OUString& rStr );
+
     void PushParagraphField(std::unique_ptr<SvxFieldData> pData, const OUString& rStyleName);
 
     void PushFormat(sal_Int32 nBegin, sal_Int32 nEnd, const OUString& rStyleName);
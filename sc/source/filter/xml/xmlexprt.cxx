@@ -3863,6 +3863,12 @@ bool ScXMLExport::IsCellEqual (const ScMyCell& aCell1, const ScMyCell& aCell2)
                         {
                             if (IsEditCell(aCell1) || IsEditCell(aCell2))
                                 bIsEqual = false;
+                            else if (aCell1.maBaseCell.getType() == CELLTYPE_STRING && aCell2.maBaseCell.getType() == CELLTYPE_STRING)
+                            {
+                                // Pooled strings with equal text share their data,
+                                // no need to create and compare copies.
+                                bIsEqual = (*aCell1.maBaseCell.getSharedString() == *aCell2.maBaseCell.getSharedString());
+                            }
                             else
                             {
                                 bIsEqual = (aCell1.maBaseCell.getString(pDoc) == aCell2.maBaseCell.getString(pDoc));
@@ -336,6 +336,18 @@ DataStream::Line DataStream::ConsumeLine()
     return moLines->at(mnLinesCount++);
 }
 
+bool DataStream::HasReadLines()
+{
+    if (moLines && mnLinesCount < moLines->size())
+        return true;
+
+    if (mxReaderThread->isTerminateRequested())
+        return false;
+
+    std::scoped_lock aGuard(mxReaderThread->getLinesMutex());
+    return mxReaderThread->hasNewLines();
+}
+
 ScRange DataStream::GetRange() const
 {
     ScRange aRange = maStartRange;
@@ -535,7 +547,17 @@ bool DataStream::ImportData()
     if (pViewData->GetViewShell()->NeedsRepaint())
         return mbRunning;
 
-    Text2Doc();
+    // Unless the lines are to be shown one by one at the configured update
+    // timeout, import all lines the reader thread has ready for a while
+    // instead of one line per timer call, so that a fast stream does not fall
+    // behind.  Text2Doc() still refreshes only every so many lines.
+    const double fEnd = getNow() + 0.02;
+    do
+    {
+        Text2Doc();
+    }
+    while (mbRunning && maImportTimer.GetTimeout() == 0 && HasReadLines() && getNow() < fEnd);
+
     return mbRunning;
 }
 
@@ -546,7 +546,7 @@ bool ScDocShell::LoadXML( SfxMedium* pLoadMedium, const css::uno::Reference< css
         bHardRecalc = true;
 
     if (bHardRecalc)
-        DoHardRecalc();
+        DoHardRecalcAfterLoad();
     else
     {
         // still need to recalc volatile formula cells.
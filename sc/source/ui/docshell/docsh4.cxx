@@ -89,6 +89,7 @@ using namespace ::com::sun::star;
 #include <servobj.hxx>
 #include <rangenam.hxx>
 #include <scmod.hxx>
+#include <refupdatecontext.hxx>
 #include <chgviset.hxx>
 #include <reffact.hxx>
 #include <chartlis.hxx>
@@ -1556,6 +1557,33 @@ void ScDocShell::DoHardRecalc()
     SAL_INFO("sc.timing", "ScDocShell::DoHardRecalc(): took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms");
 }
 
+void ScDocShell::DoHardRecalcAfterLoad()
+{
+    // Without AutoCalc dirty cells are not calculated on access.
+    if (!m_pDocument->GetAutoCalc() || m_pDocument->IsInDocShellRecalc())
+    {
+        DoHardRecalc();
+        return;
+    }
+
+    // Don't calculate the whole document before it can be shown, as for
+    // CSV import.
+    sc::SetFormulaDirtyContext aCxt;
+    m_pDocument->SetAllFormulasDirty(aCxt);
+    GetDocFunc().DetectiveRefresh();    // creates own Undo
+
+    // set notification flags for "calculate" event, as DoHardRecalc does
+    SCTAB nTabCount = m_pDocument->GetTableCount();
+    if (m_pDocument->HasAnySheetEventScript( ScSheetEventId::CALCULATE, true )) // search also for VBA handler
+        for (SCTAB nTab=0; nTab<nTabCount; nTab++)
+            m_pDocument->SetCalcNotification(nTab);
+
+    m_pDocument->BroadcastUno( SfxHint( SfxHintId::DataChanged ) );
+
+    for (SCTAB nTab=0; nTab<nTabCount; nTab++)
+        m_pDocument->SetStreamValid(nTab, false);
+}
+
 void ScDocShell::DoAutoStyle( const ScRange& rRange, const OUString& rStyle )
 {
     ScStyleSheetPool* pStylePool = m_pDocument->GetStyleSheetPool();
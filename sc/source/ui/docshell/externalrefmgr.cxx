@@ -1677,6 +1677,7 @@ ScExternalRefManager::ScExternalRefManager(ScDocument& rDoc) :
     mbInReferenceMarking(false),
     mbUserInteractionEnabled(true),
     mbDocTimerEnabled(true),
+    mbRefCellRefreshDeferred(false),
     maSrcDocTimer( "sc::ScExternalRefManager maSrcDocTimer" )
 {
     maSrcDocTimer.SetInvokeHandler( LINK(this, ScExternalRefManager, TimeOutHdl) );
@@ -2190,11 +2191,24 @@ bool ScExternalRefManager::isValidRangeName(sal_uInt16 nFileId, const OUString&
 
 void ScExternalRefManager::refreshAllRefCells(sal_uInt16 nFileId)
 {
+    if (mbRefCellRefreshDeferred)
+    {
+        maDeferredRefreshFileIds.insert(nFileId);
+        return;
+    }
+
     RefCellMap::iterator itrFile = maRefCells.find(nFileId);
     if (itrFile == maRefCells.end())
         return;
 
-    RefCellSet& rRefCells = itrFile->second;
+    refreshRefCells(itrFile->second);
+}
+
+void ScExternalRefManager::refreshRefCells(const RefCellSet& rRefCells)
+{
+    if (rRefCells.empty())
+        return;
+
     for_each(rRefCells.begin(), rRefCells.end(), UpdateFormulaCell());
 
     ScViewData* pViewData = ScDocShell::GetViewData();
@@ -2266,6 +2280,27 @@ bool ScExternalRefManager::hasCellExternalReference(const ScAddress& rCell)
     return false;
 }
 
+void ScExternalRefManager::deferRefCellRefresh( bool bDefer )
+{
+    if (mbRefCellRefreshDeferred == bDefer)
+        return;
+
+    mbRefCellRefreshDeferred = bDefer;
+    if (mbRefCellRefreshDeferred)
+        return;
+
+    RefCellSet aRefCells;
+    for (sal_uInt16 nFileId : maDeferredRefreshFileIds)
+    {
+        RefCellMap::const_iterator itrFile = maRefCells.find(nFileId);
+        if (itrFile != maRefCells.end())
+            aRefCells.insert(itrFile->second.begin(), itrFile->second.end());
+    }
+    maDeferredRefreshFileIds.clear();
+
+    refreshRefCells(aRefCells);
+}
+
 void ScExternalRefManager::enableDocTimer( bool bEnable )
 {
     if (mbDocTimerEnabled == bEnable)
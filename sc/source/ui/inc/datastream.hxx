@@ -91,6 +91,8 @@ public:
 
 private:
     Line ConsumeLine();
+    /// Whether ConsumeLine() would return without waiting for the reader thread.
+    bool HasReadLines();
     void MoveData();
     void Text2Doc();
     void Refresh();
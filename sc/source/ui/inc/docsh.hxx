@@ -286,6 +286,10 @@ public:
 
     void            DoRecalc( bool bApi );
     void            DoHardRecalc();
+    /** Hard recalc of a just loaded document that is not shown yet: only
+        marks all formula cells dirty, they are calculated when displayed
+        or otherwise accessed. */
+    void            DoHardRecalcAfterLoad();
 
     void            UpdateOle(const ScViewData& rViewData, bool bSnapSize = false);
     bool            IsOle() const;
@@ -1112,89 +1112,113 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
     rDoc.DeleteAreaTab( nStartCol, nStartRow, nEndCol, nEndRow, nTab, InsertDeleteFlags::CONTENTS );
 
     bool bError = false;
-    SCROW nDocRow = nStartRow;
-    for (const uno::Sequence<uno::Any>& rColSeq : aData)
+    std::vector<double> aVals;
+    for (sal_Int32 nCol = 0; nCol < nCols; ++nCol)
     {
-        if ( rColSeq.getLength() == nCols )
+        SCCOL nDocCol = nStartCol + nCol;
+
+        // Consecutive numbers of a column are set as one block, setting them
+        // one by one modifies the cell storage and broadcasts for each.
+        SCROW nValsRow = nStartRow;
+        auto flushValues = [&]()
         {
-            SCCOL nDocCol = nStartCol;
-            for (const uno::Any& rElement : rColSeq)
+            if (!aVals.empty())
             {
-                ScAddress aPos(nDocCol, nDocRow, nTab);
+                rDoc.SetValues(ScAddress(nDocCol, nValsRow, nTab), aVals);
+                aVals.clear();
+            }
+        };
 
-                switch( rElement.getValueTypeClass() )
+        SCROW nDocRow = nStartRow;
+        for (const uno::Sequence<uno::Any>& rColSeq : aData)
+        {
+            if ( rColSeq.getLength() != nCols )
+            {
+                flushValues();
+                if (nCol == 0)
+                    bError = true;                  // wrong size
+                ++nDocRow;
+                continue;
+            }
+
+            const uno::Any& rElement = rColSeq[nCol];
+            ScAddress aPos(nDocCol, nDocRow, nTab);
+
+            switch( rElement.getValueTypeClass() )
+            {
+                //  #87871# accept integer types because Basic passes a floating point
+                //  variable as byte, short or long if it's an integer number.
+                case uno::TypeClass_BYTE:
+                case uno::TypeClass_SHORT:
+                case uno::TypeClass_UNSIGNED_SHORT:
+                case uno::TypeClass_LONG:
+                case uno::TypeClass_UNSIGNED_LONG:
+                case uno::TypeClass_FLOAT:
+                case uno::TypeClass_DOUBLE:
                 {
-                    case uno::TypeClass_VOID:
-                    {
-                        // void = "no value"
-                        rDoc.SetError( nDocCol, nDocRow, nTab, FormulaError::NotAvailable );
-                    }
-                    break;
+                    double fVal(0.0);
+                    rElement >>= fVal;
+                    if (aVals.empty())
+                        nValsRow = nDocRow;
+                    aVals.push_back(fVal);
+                }
+                break;
 
-                    //  #87871# accept integer types because Basic passes a floating point
-                    //  variable as byte, short or long if it's an integer number.
-                    case uno::TypeClass_BYTE:
-                    case uno::TypeClass_SHORT:
-                    case uno::TypeClass_UNSIGNED_SHORT:
-                    case uno::TypeClass_LONG:
-                    case uno::TypeClass_UNSIGNED_LONG:
-                    case uno::TypeClass_FLOAT:
-                    case uno::TypeClass_DOUBLE:
-                    {
-                        double fVal(0.0);
-                        rElement >>= fVal;
-                        rDoc.SetValue(aPos, fVal);
-                    }
-                    break;
+                case uno::TypeClass_VOID:
+                {
+                    flushValues();
+                    // void = "no value"
+                    rDoc.SetError( nDocCol, nDocRow, nTab, FormulaError::NotAvailable );
+                }
+                break;
 
-                    case uno::TypeClass_STRING:
+                case uno::TypeClass_STRING:
+                {
+                    flushValues();
+                    OUString aUStr;
+                    rElement >>= aUStr;
+                    if ( !aUStr.isEmpty() )
                     {
-                        OUString aUStr;
-                        rElement >>= aUStr;
-                        if ( !aUStr.isEmpty() )
+                        // tdf#146454 - check for a multiline string since setting an edit
+                        // or string cell is in magnitudes slower than setting a plain string
+                        if (ScStringUtil::isMultiline(aUStr))
                         {
-                            // tdf#146454 - check for a multiline string since setting an edit
-                            // or string cell is in magnitudes slower than setting a plain string
-                            if (ScStringUtil::isMultiline(aUStr))
-                            {
-                                rEngine.SetTextCurrentDefaults(aUStr);
-                                rDoc.SetEditText(aPos, rEngine.CreateTextObject());
-                            }
-                            else
-                            {
-                                ScSetStringParam aParam;
-                                aParam.setTextInput();
-                                rDoc.SetString(aPos, aUStr, &aParam);
-                            }
+                            rEngine.SetTextCurrentDefaults(aUStr);
+                            rDoc.SetEditText(aPos, rEngine.CreateTextObject());
                         }
-                    }
-                    break;
-
-                    // accept Sequence<FormulaToken> for formula cells
-                    case uno::TypeClass_SEQUENCE:
-                    {
-                        uno::Sequence< sheet::FormulaToken > aTokens;
-                        if ( rElement >>= aTokens )
+                        else
                         {
-                            ScTokenArray aTokenArray(rDoc);
-                            ScTokenConversion::ConvertToTokenArray( rDoc, aTokenArray, aTokens );
-                            rDoc.SetFormula(aPos, aTokenArray);
+                            ScSetStringParam aParam;
+                            aParam.setTextInput();
+                            rDoc.SetString(aPos, aUStr, &aParam);
                         }
-                        else
-                            bError = true;
                     }
-                    break;
+                }
+                break;
 
-                    default:
-                        bError = true;      // invalid type
+                // accept Sequence<FormulaToken> for formula cells
+                case uno::TypeClass_SEQUENCE:
+                {
+                    flushValues();
+                    uno::Sequence< sheet::FormulaToken > aTokens;
+                    if ( rElement >>= aTokens )
+                    {
+                        ScTokenArray aTokenArray(rDoc);
+                        ScTokenConversion::ConvertToTokenArray( rDoc, aTokenArray, aTokens );
+                        rDoc.SetFormula(aPos, aTokenArray);
+                    }
+                    else
+                        bError = true;
                 }
-                ++nDocCol;
+                break;
+
+                default:
+                    flushValues();
+                    bError = true;      // invalid type
             }
+            ++nDocRow;
         }
-        else
-            bError = true;                          // wrong size
-
-        ++nDocRow;
+        flushValues();
     }
 
     bool bHeight = rDocShell.AdjustRowHeight( nStartRow, nEndRow, nTab );
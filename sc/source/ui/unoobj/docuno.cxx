@@ -29,6 +29,7 @@
 #include <editeng/outliner.hxx>
 #include <o3tl/any.hxx>
 #include <o3tl/safeint.hxx>
+#include <o3tl/string_view.hxx>
 #include <svx/fmview.hxx>
 #include <svx/svditer.hxx>
 #include <svx/svdpage.hxx>
@@ -50,10 +51,13 @@
 #include <vcl/svapp.hxx>
 #include <tools/json_writer.hxx>
 #include <tools/multisel.hxx>
+#include <tools/urlobj.hxx>
 #include <tools/UnitConversion.hxx>
 #include <toolkit/awt/vclxdevice.hxx>
 
 #include <float.h>
+#include <chrono>
+#include <map>
 
 #include <com/sun/star/beans/PropertyAttribute.hpp>
 #include <com/sun/star/util/Date.hpp>
@@ -94,6 +98,7 @@
 #include <drwlayer.hxx>
 #include <forbiuno.hxx>
 #include <formulagroup.hxx>
+#include <formulagroupprofiler.hxx>
 #include <gridwin.hxx>
 #include <hints.hxx>
 #include <inputhdl.hxx>
@@ -127,6 +132,7 @@
 #include <table.hxx>
 #include <appoptio.hxx>
 #include <formulaopt.hxx>
+#include <formulacell.hxx>
 
 #include <strings.hrc>
 
@@ -1229,6 +1235,70 @@ void ScModelObj::getPostItsPos(tools::JsonWriter& rJsonWriter)
     }
 }
 
+bool ScModelObj::supportsCommand(std::u16string_view rCommand)
+{
+    return rCommand == u"FormulaGroupProfile";
+}
+
+/// Implements getCommandValues(".uno:FormulaGroupProfile").
+///
+/// Parameters:
+///
+/// - enable: "true" or "false" to start or stop recording
+/// - reset: "true" to drop what was recorded so far
+/// - count: number of groups to return, those that took longest first
+void ScModelObj::getCommandValues(tools::JsonWriter& rJsonWriter, std::string_view rCommand)
+{
+    if (!pDocShell || !o3tl::starts_with(rCommand, ".uno:FormulaGroupProfile"))
+        return;
+
+    std::map<OUString, OUString> aArguments;
+    const OUString aParams = INetURLObject(OUString::fromUtf8(rCommand)).GetParam();
+    sal_Int32 nParamIndex = 0;
+    do
+    {
+        std::u16string_view aParam = o3tl::getToken(aParams, 0, '&', nParamIndex);
+        sal_Int32 nIndex = 0;
+        OUString aKey(o3tl::getToken(aParam, 0, '=', nIndex));
+        if (nIndex >= 0)
+            aArguments[aKey] = OUString(o3tl::getToken(aParam, 0, '=', nIndex));
+    } while (nParamIndex >= 0);
+
+    ScDocument& rDoc = pDocShell->GetDocument();
+    sc::FormulaGroupProfiler& rProfiler = rDoc.GetFormulaGroupProfiler();
+
+    auto it = aArguments.find("enable");
+    if (it != aArguments.end())
+        rProfiler.setEnabled(it->second == "true");
+    it = aArguments.find("reset");
+    if (it != aArguments.end() && it->second == "true")
+        rProfiler.reset();
+    size_t nCount = 20;
+    it = aArguments.find("count");
+    if (it != aArguments.end())
+        nCount = std::max<sal_Int32>(it->second.toInt32(), 0);
+
+    rJsonWriter.put("commandName", ".uno:FormulaGroupProfile");
+    rJsonWriter.put("enabled", rProfiler.isEnabled());
+    auto aGroupsNode = rJsonWriter.startArray("groups");
+    for (const sc::FormulaGroupProfiler::Entry* pEntry : rProfiler.getTopEntries(nCount))
+    {
+        auto aGroupNode = rJsonWriter.startStruct();
+        rJsonWriter.put("tab", pEntry->maTopPos.Tab());
+        rJsonWriter.put("topCell", pEntry->maTopPos.Format(ScRefFlags::ADDR_ABS_3D, &rDoc,
+                                                           rDoc.GetAddressConvention()));
+        rJsonWriter.put("rows", pEntry->mnLength);
+        const ScFormulaCell* pCell = rDoc.GetFormulaCell(pEntry->maTopPos);
+        rJsonWriter.put("formula", pCell ? pCell->GetFormula() : OUString());
+        rJsonWriter.put("path", sc::FormulaGroupProfiler::getPathName(pEntry->mePath));
+        rJsonWriter.put("calls", static_cast<sal_Int64>(pEntry->mnCalls));
+        rJsonWriter.put("fallbacks", static_cast<sal_Int64>(pEntry->mnFallbacks));
+        rJsonWriter.put("fallbackReason", pEntry->maFallbackReason);
+        rJsonWriter.put("milliseconds",
+                        std::chrono::duration<double, std::milli>(pEntry->maTime).count());
+    }
+}
+
 void ScModelObj::completeFunction(const OUString& rFunctionName)
 {
     ScInputHandler* pHdl = SC_MOD()->GetInputHdl();
@@ -1610,17 +1610,6 @@ void ScGridWindow::PaintTile( VirtualDevice& rDevice,
             rDoc, fPPTX);
     }
 
-    // size of the document including drawings, charts, etc.
-    SCCOL nEndCol = 0;
-    SCROW nEndRow = 0;
-    rDoc.GetTiledRenderingArea(nTab, nEndCol, nEndRow);
-
-    if (nEndCol < nBottomRightTileCol)
-        nEndCol = nBottomRightTileCol;
-
-    if (nEndRow < nBottomRightTileRow)
-        nEndRow = nBottomRightTileRow;
-
     nTopLeftTileCol = std::max<sal_Int32>(nTopLeftTileCol, 0);
     nTopLeftTileRow = std::max<sal_Int32>(nTopLeftTileRow, 0);
     nTopLeftTileColOrigin = o3tl::convert(nTopLeftTileColOrigin, o3tl::Length::px, o3tl::Length::twip);
@@ -1636,7 +1625,10 @@ void ScGridWindow::PaintTile( VirtualDevice& rDevice,
     aAbsMode.SetOrigin(aOrigin);
     rDevice.SetMapMode(aAbsMode);
 
-    ScTableInfo aTabInfo(nEndRow + 3);
+    // FillInfo() needs one entry per row of the tile plus one before and
+    // after it, and one spare; not one per row of the whole document, which
+    // would be allocated and cleared again for every tile.
+    ScTableInfo aTabInfo(nBottomRightTileRow - nTopLeftTileRow + 4);
     rDoc.FillInfo(aTabInfo, nTopLeftTileCol, nTopLeftTileRow,
                    nBottomRightTileCol, nBottomRightTileRow,
                    nTab, fPPTX, fPPTY, false, false);
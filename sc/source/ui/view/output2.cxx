@@ -492,8 +492,18 @@ void ScDrawStringsVars::SetPatternSimple( const ScPatternAttr* pNew, const SfxIt
 
 static bool SameValue( const ScRefCellValue& rCell, const ScRefCellValue& rOldCell )
 {
-    return rOldCell.getType() == CELLTYPE_VALUE && rCell.getType() == CELLTYPE_VALUE &&
-        rCell.getDouble() == rOldCell.getDouble();
+    if (rOldCell.getType() != rCell.getType())
+        return false;
+    switch (rCell.getType())
+    {
+        case CELLTYPE_VALUE:
+            return rCell.getDouble() == rOldCell.getDouble();
+        case CELLTYPE_STRING:
+            // Strings are pooled, the same data means the same text.
+            return rCell.getSharedString()->getData() == rOldCell.getSharedString()->getData();
+        default:
+            return false;
+    }
 }
 
 bool ScDrawStringsVars::SetText( const ScRefCellValue& rCell )
@@ -56,9 +56,34 @@ class SpellCheckContext::SpellCheckCache
 
     };
 
+    /// Shared strings are checked once per language they are used with.
+    struct StringKey
+    {
+        struct Hash
+        {
+            size_t operator() (const StringKey& rKey) const
+            {
+                std::size_t seed = 0;
+                o3tl::hash_combine(seed, rKey.mpString);
+                o3tl::hash_combine(seed, static_cast<sal_uInt16>(rKey.meLanguage));
+                return seed;
+            }
+        };
+
+        const rtl_uString* mpString;
+        LanguageType meLanguage;
+
+        StringKey(const rtl_uString* pString, LanguageType eLanguage) : mpString(pString), meLanguage(eLanguage) {}
+
+        bool operator== (const StringKey& r) const
+        {
+            return mpString == r.mpString && meLanguage == r.meLanguage;
+        }
+    };
+
     typedef std::vector<editeng::MisspellRanges> MisspellType;
     typedef std::unordered_map<CellPos, std::unique_ptr<MisspellType>, CellPos::Hash> CellMapType;
-    typedef std::unordered_map<const rtl_uString*, std::unique_ptr<MisspellType>> SharedStringMapType;
+    typedef std::unordered_map<StringKey, std::unique_ptr<MisspellType>, StringKey::Hash> SharedStringMapType;
     typedef std::unordered_map<CellPos, LanguageType, CellPos::Hash> CellLangMapType;
 
     SharedStringMapType  maStringMisspells;
@@ -72,12 +97,14 @@ public:
     {
     }
 
-    bool query(SCCOL nCol, SCROW nRow, const ScRefCellValue& rCell, MisspellType*& rpRanges) const
+    bool query(SCCOL nCol, SCROW nRow, LanguageType eCellLang, const ScRefCellValue& rCell,
+               MisspellType*& rpRanges) const
     {
         CellType eType = rCell.getType();
         if (eType == CELLTYPE_STRING)
         {
-            SharedStringMapType::const_iterator it = maStringMisspells.find(rCell.getSharedString()->getData());
+            SharedStringMapType::const_iterator it = maStringMisspells.find(
+                StringKey(rCell.getSharedString()->getData(), eCellLang));
             if (it == maStringMisspells.end())
                 return false; // Not available
 
@@ -99,11 +126,13 @@ public:
         return true;
     }
 
-    void set(SCCOL nCol, SCROW nRow, const ScRefCellValue& rCell, std::unique_ptr<MisspellType> pRanges)
+    void set(SCCOL nCol, SCROW nRow, LanguageType eCellLang, const ScRefCellValue& rCell,
+             std::unique_ptr<MisspellType> pRanges)
     {
         CellType eType = rCell.getType();
         if (eType == CELLTYPE_STRING)
-            maStringMisspells.insert_or_assign(rCell.getSharedString()->getData(), std::move(pRanges));
+            maStringMisspells.insert_or_assign(
+                StringKey(rCell.getSharedString()->getData(), eCellLang), std::move(pRanges));
         else if (eType == CELLTYPE_EDIT)
             maEditTextMisspells.insert_or_assign(CellPos(nCol, nRow), std::move(pRanges));
     }
@@ -241,7 +270,7 @@ void SpellCheckContext::setMisspellRanges(
 
     typedef std::vector<editeng::MisspellRanges> MisspellType;
     std::unique_ptr<MisspellType> pMisspells(pRanges ? new MisspellType(*pRanges) : nullptr);
-    mpCache->set(nCol, nRow, aCell, std::move(pMisspells));
+    mpCache->set(nCol, nRow, getCellLanguage(nCol, nRow), aCell, std::move(pMisspells));
 }
 
 void SpellCheckContext::reset()
@@ -293,14 +322,7 @@ void SpellCheckContext::ensureResults(SCCOL nCol, SCROW nRow)
 
     // Cell content is either shared-string or EditTextObject
 
-    // For spell-checking, we currently only use the primary
-    // language; not CJK nor CTL.
-    const ScPatternAttr* pPattern = pDoc->GetPattern(nCol, nRow, mnTab);
-    LanguageType eCellLang = pPattern->GetItem(ATTR_FONT_LANGUAGE).GetValue();
-
-    if (eCellLang == LANGUAGE_SYSTEM)
-        eCellLang = meLanguage;   // never use SYSTEM for spelling
-
+    LanguageType eCellLang = getCellLanguage(nCol, nRow);
     if (eCellLang == LANGUAGE_NONE)
     {
         mpResult->set(nCol, nRow, nullptr); // No need to spell check this cell.
@@ -309,15 +331,15 @@ void SpellCheckContext::ensureResults(SCCOL nCol, SCROW nRow)
 
     typedef std::vector<editeng::MisspellRanges> MisspellType;
 
-    LanguageType eCachedCellLang = mpCache->getLanguage(nCol, nRow);
-
-    if (eCellLang != eCachedCellLang)
+    // Edit text results are cached per position, those of another language
+    // are outdated.  Shared string results are cached per language.
+    if (eType == CELLTYPE_EDIT && eCellLang != mpCache->getLanguage(nCol, nRow))
         mpCache->setLanguage(eCellLang, nCol, nRow);
 
     else
     {
         MisspellType* pRanges = nullptr;
-        bool bFound = mpCache->query(nCol, nRow, aCell, pRanges);
+        bool bFound = mpCache->query(nCol, nRow, eCellLang, aCell, pRanges);
         if (bFound)
         {
             // Cache hit.
@@ -349,7 +371,20 @@ void SpellCheckContext::ensureResults(SCCOL nCol, SCROW nRow)
     // else : No change in status for EditStatusFlags::WRONGWORDCHANGED => no spell errors (which is the default status).
 
     mpResult->set(nCol, nRow, pRanges.get());
-    mpCache->set(nCol, nRow, aCell, std::move(pRanges));
+    mpCache->set(nCol, nRow, eCellLang, aCell, std::move(pRanges));
+}
+
+LanguageType SpellCheckContext::getCellLanguage(SCCOL nCol, SCROW nRow) const
+{
+    // For spell-checking, we currently only use the primary
+    // language; not CJK nor CTL.
+    const ScPatternAttr* pPattern = pDoc->GetPattern(nCol, nRow, mnTab);
+    LanguageType eCellLang = pPattern->GetItem(ATTR_FONT_LANGUAGE).GetValue();
+
+    if (eCellLang == LANGUAGE_SYSTEM)
+        eCellLang = meLanguage;   // never use SYSTEM for spelling
+
+    return eCellLang;
 }
 
 void SpellCheckContext::resetCache(bool bContentChangeOnly)
@@ -23,6 +23,7 @@
 
 #include <sdpage.hxx>
 #include <comphelper/profilezone.hxx>
+#include <chrono>
 #include <utility>
 #include <comphelper/diagnose_ex.hxx>
 
@@ -101,11 +102,14 @@ void QueueProcessor::ProcessRequests()
 {
     assert(mpCacheContext);
 
-    // Never process more than one request at a time in order to prevent the
-    // lock up of the edit view.
-    if ( ! mrQueue.IsEmpty()
+    // Process requests only for a short time in order to prevent the lock
+    // up of the edit view, but don't wait for the timer after every single
+    // preview when they are created quickly.
+    const auto aStartTime = std::chrono::steady_clock::now();
+    while ( ! mrQueue.IsEmpty()
         && ! mbIsPaused
-        &&  mpCacheContext->IsIdle())
+        &&  mpCacheContext->IsIdle()
+        && std::chrono::steady_clock::now() - aStartTime < std::chrono::milliseconds(25))
     {
         CacheKey aKey = nullptr;
         RequestPriorityClass ePriorityClass (NOT_VISIBLE);
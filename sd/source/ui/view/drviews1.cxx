@@ -1016,6 +1016,15 @@ bool DrawViewShell::SwitchPage(sal_uInt16 nSelectedPage, bool bAllowChangeFocus)
         // in threads to be more efficient than loading them on-demand one by one.
         std::vector<Graphic*> graphics;
         mpActualPage->getGraphicsForPrefetch(graphics);
+        // Also those of the following page, so that they are already there
+        // when paging forward through the document.
+        if (meEditMode == EditMode::Page
+            && nSelectedPage + 1 < GetDoc()->GetSdPageCount(mePageKind)
+            && GetDoc()->GetSdPage(nSelectedPage, mePageKind) == mpActualPage)
+        {
+            if (SdPage* pNextPage = GetDoc()->GetSdPage(nSelectedPage + 1, mePageKind))
+                pNextPage->getGraphicsForPrefetch(graphics);
+        }
         if(graphics.size() > 1) // threading does not help with loading just one
             GraphicFilter::GetGraphicFilter().MakeGraphicsAvailableThreaded(graphics);
 
@@ -57,6 +57,7 @@
 #include <vcl/font.hxx>
 #include <vcl/virdev.hxx>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string_view>
@@ -980,31 +981,41 @@ class Buffering
 public:
     explicit Buffering(oslFileHandle& out) : aBuffer(new char[SIZE]), pOut(out), pos(0), left(0) {}
 
-    oslFileError read(char *pChar, short count, sal_uInt64* pBytesRead)
+    /** Append the next non-empty line to rLine, without the line end
+
+        Line ends are \n or \r, empty lines are skipped. rLine stays empty at
+        the end of the input.
+     */
+    oslFileError readLine(OStringBuffer& rLine)
     {
-        oslFileError nRes = osl_File_E_None;
-        sal_uInt64 nBytesRead = 0;
-        while (count > 0)
+        bool bLineStarted = false;
+        for (;;)
         {
             if (left == 0)
             {
-                nRes = osl_readFile(pOut, aBuffer.get(), SIZE, &left);
+                oslFileError nRes = osl_readFile(pOut, aBuffer.get(), SIZE, &left);
                 if (nRes != osl_File_E_None || left == 0)
-                {
-                    *pBytesRead = nBytesRead;
                     return nRes;
-                }
                 pos = 0;
             }
-            *pChar = aBuffer.get()[pos];
-            --count;
-            ++pos;
-            --left;
-            ++pChar;
-            ++nBytesRead;
+            const char* pStart = aBuffer.get() + pos;
+            const char* const pEnd = pStart + left;
+            auto isLineEnd = [](char c) { return c == '\n' || c == '\r'; };
+            if (!bLineStarted)
+            {
+                // skip garbage \r \n at start of line
+                pStart = std::find_if_not(pStart, pEnd, isLineEnd);
+                bLineStarted = pStart != pEnd;
+            }
+            const char* pLineEnd = std::find_if(pStart, pEnd, isLineEnd);
+            rLine.append(pStart, pLineEnd - pStart);
+            const bool bLineEnded = pLineEnd != pEnd;
+            const size_t nConsumed = pLineEnd - (aBuffer.get() + pos) + (bLineEnded ? 1 : 0);
+            pos += nConsumed;
+            left -= nConsumed;
+            if (bLineEnded)
+                return osl_File_E_None;
         }
-        *pBytesRead = nBytesRead;
-        return osl_File_E_None;
     }
 };
 
@@ -1111,31 +1122,7 @@ bool xpdf_ImportFromFile(const OUString& rURL,
             OStringBuffer line;
             for( ;; )
             {
-                char aChar('\n');
-                sal_uInt64 nBytesRead;
-                oslFileError nRes;
-
-                // skip garbage \r \n at start of line
-                for (;;)
-                {
-                    nRes = aBuffering.read(&aChar, 1, &nBytesRead);
-                    if (osl_File_E_None != nRes || nBytesRead != 1 || (aChar != '\n' && aChar != '\r') )
-                        break;
-                }
-                if ( osl_File_E_None != nRes )
-                    break;
-
-                if( aChar != '\n' && aChar != '\r' )
-                    line.append( aChar );
-
-                for (;;)
-                {
-                    nRes = aBuffering.read(&aChar, 1, &nBytesRead);
-                    if ( osl_File_E_None != nRes || nBytesRead != 1 || aChar == '\n' || aChar == '\r' )
-                        break;
-                    line.append( aChar );
-                }
-                if ( osl_File_E_None != nRes )
+                if ( osl_File_E_None != aBuffering.readLine(line) )
                     break;
                 if ( line.isEmpty() )
                     break;
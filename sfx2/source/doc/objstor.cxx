@@ -63,6 +63,7 @@
 #include <com/sun/star/document/XDocumentPropertiesSupplier.hpp>
 #include <comphelper/fileformat.h>
 #include <comphelper/processfactory.hxx>
+#include <comphelper/profilezone.hxx>
 #include <svtools/langtab.hxx>
 #include <svtools/sfxecode.hxx>
 #include <unotools/configmgr.hxx>
@@ -571,6 +572,7 @@ bool SfxObjectShell::ImportFromGeneratedStream_Impl(
 
 bool SfxObjectShell::DoLoad( SfxMedium *pMed )
 {
+    comphelper::ProfileZone aZone("SfxObjectShell::DoLoad");
     ModifyBlocker_Impl aBlock( this );
 
     pMedium = pMed;
@@ -2179,6 +2181,7 @@ bool SfxObjectShell::ConvertFrom
 bool SfxObjectShell::ImportFrom(SfxMedium& rMedium,
         css::uno::Reference<css::text::XTextRange> const& xInsertPosition)
 {
+    comphelper::ProfileZone aZone("SfxObjectShell::ImportFrom");
     const OUString aFilterName( rMedium.GetFilter()->GetFilterName() );
 
     uno::Reference< lang::XMultiServiceFactory >  xMan = ::comphelper::getProcessServiceFactory();
@@ -2358,6 +2361,7 @@ bool SfxObjectShell::ImportFrom(SfxMedium& rMedium,
 
 bool SfxObjectShell::ExportTo( SfxMedium& rMedium )
 {
+    comphelper::ProfileZone aZone("SfxObjectShell::ExportTo");
     const OUString aFilterName( rMedium.GetFilter()->GetFilterName() );
     uno::Reference< document::XExporter > xExporter;
 
@@ -97,7 +97,16 @@ namespace slideshow::internal
     void ScreenUpdater::notifyUpdate( const UnoViewSharedPtr& rView,
                                       bool                    bViewClobbered )
     {
-        mpImpl->maViewUpdateRequests.emplace_back(rView, bViewClobbered );
+        // Every animated shape notifies its update; record each view only
+        // once, so that it's not updated several times per frame.
+        auto aFoundRequest = std::find_if(
+            mpImpl->maViewUpdateRequests.begin(), mpImpl->maViewUpdateRequests.end(),
+            [&rView]( const UpdateRequestVector::value_type& rRequest )
+            { return rRequest.first == rView; } );
+        if( aFoundRequest != mpImpl->maViewUpdateRequests.end() )
+            aFoundRequest->second = aFoundRequest->second || bViewClobbered;
+        else
+            mpImpl->maViewUpdateRequests.emplace_back(rView, bViewClobbered );
 
         if( bViewClobbered )
             mpImpl->mbViewClobbered = true;
@@ -167,7 +176,7 @@ namespace slideshow::internal
         // done - clear requests
         mpImpl->mbViewClobbered = false;
         mpImpl->mbUpdateAllRequest = false;
-        UpdateRequestVector().swap( mpImpl->maViewUpdateRequests );
+        mpImpl->maViewUpdateRequests.clear();
     }
 
     void ScreenUpdater::addViewUpdate( ViewUpdateSharedPtr const& rViewUpdate )
@@ -309,9 +309,9 @@ void StgCache::Close()
 
 // low level I/O
 
-bool StgCache::Read( sal_Int32 nPage, void* pBuf )
+bool StgCache::Read( sal_Int32 nPage, void* pBuf, sal_Int32 nPages )
 {
-    sal_uInt32 nRead = 0, nBytes = m_nPageSize;
+    sal_uInt32 nRead = 0, nBytes = m_nPageSize * nPages;
     if( Good() )
     {
         /*  #i73846# real life: a storage may refer to a page one-behind the
@@ -334,13 +334,13 @@ bool StgCache::Read( sal_Int32 nPage, void* pBuf )
             else
             {
                 nPos = Page2Pos(nPage);
-                nPg2 = ((nPage + 1) > m_nPages) ? m_nPages - nPage : 1;
+                nPg2 = ((nPage + nPages) > m_nPages) ? m_nPages - nPage : nPages;
             }
 
             if (m_pStrm->Tell() != nPos)
                 m_pStrm->Seek(nPos);
 
-            if (nPg2 != 1)
+            if (nPg2 != nPages)
                 SetError(SVSTREAM_READ_ERROR);
             else
             {
@@ -77,7 +77,7 @@ public:
     void  ResetError();
     bool  Open( const OUString& rName, StreamMode );
     void  Close();
-    bool  Read( sal_Int32 nPage, void* pBuf );
+    bool  Read( sal_Int32 nPage, void* pBuf, sal_Int32 nPages = 1 );
     bool  Write( sal_Int32 nPage, void const * pBuf );
 
     // two routines for accessing FAT pages
@@ -910,9 +910,9 @@ void* StgDataStrm::GetPtr( sal_Int32 Pos, bool bDirty )
     return nullptr;
 }
 
-// This could easily be adapted to a better algorithm by determining
-// the amount of consecutable blocks before doing a read. The result
-// is the number of bytes read. No error is generated on EOF.
+// Runs of whole pages which follow each other in the file are read
+// with a single read into the buffer. The result is the number of bytes
+// read. No error is generated on EOF.
 
 sal_Int32 StgDataStrm::Read( void* pBuf, sal_Int32 n )
 {
@@ -943,8 +943,29 @@ sal_Int32 StgDataStrm::Read( void* pBuf, sal_Int32 n )
                     nRes = nBytes;
                 }
                 else
-                    // do a direct (unbuffered) read
+                {
+                    // do a direct (unbuffered) read of this page and
+                    // of the following ones, as long as they are the next
+                    // pages in the file and not cached
+                    sal_Int32 nPages = 1;
+                    while( m_pFat && n - nPages * m_nPageSize >= m_nPageSize
+                           && m_nPage + nPages < m_rIo.GetPhysPages()
+                           && m_pFat->GetNextPage( m_nPage + nPages - 1 ) == m_nPage + nPages
+                           && !m_rIo.Find( m_nPage + nPages ).is() )
+                        ++nPages;
+                    if( nPages > 1 )
+                    {
+                        if( !m_rIo.Read( m_nPage, p, nPages ) )
+                            break;
+                        const sal_Int32 nRead = nPages * m_nPageSize;
+                        nDone += nRead;
+                        n -= nRead;
+                        if( !Pos2Page( GetPos() + nRead ) )
+                            break;
+                        continue;
+                    }
                     nRes = static_cast<short>(m_rIo.Read( m_nPage, p )) * m_nPageSize;
+                }
             }
             else
             {
@@ -313,7 +313,7 @@ namespace svgio::svgreader
             if(aTarget.equal(aViewBox))
             {
                 // just add to rTarget
-                rTarget.append(aNewTarget);
+                rTarget.append(std::move(aNewTarget));
             }
             else
             {
@@ -184,7 +184,7 @@ namespace svgio::svgreader
             }
 
             // append to current target
-            rTarget.append(aNewTarget);
+            rTarget.append(std::move(aNewTarget));
         }
 
         void SvgMaskNode::apply(
@@ -531,7 +531,7 @@ namespace svgio::svgreader
 
                         if(!aNewTarget.empty())
                         {
-                            rTarget.append(aNewTarget);
+                            rTarget.append(std::move(aNewTarget));
                         }
                     }
                 }
@@ -646,7 +646,7 @@ namespace svgio::svgreader
             else
             {
                 // append
-                rTarget.append(aNewFill);
+                rTarget.append(std::move(aNewFill));
             }
         }
 
@@ -802,7 +802,7 @@ namespace svgio::svgreader
             else
             {
                 // append
-                rTarget.append(aNewStroke);
+                rTarget.append(std::move(aNewStroke));
             }
         }
 
@@ -1253,7 +1253,7 @@ namespace svgio::svgreader
             if(!aSource.empty()) // test again, applied mask may have lead to empty geometry
             {
                 // append to current target
-                rTarget.append(aSource);
+                rTarget.append(std::move(aSource));
             }
         }
 
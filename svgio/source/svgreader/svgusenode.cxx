@@ -174,7 +174,7 @@ namespace svgio::svgreader
             }
             else
             {
-                rTarget.append(aNewTarget);
+                rTarget.append(std::move(aNewTarget));
             }
         }
 
@@ -37,6 +37,8 @@
 
 #include <memory>
 #include <optional>
+#include <thread>
+#include <vector>
 #include <unicode/timezone.h>
 
 using namespace ::com::sun::star;
@@ -66,6 +68,7 @@ public:
     void testSharedStringPoolPurge();
     void testSharedStringPoolPurgeBug1();
     void testSharedStringPoolEmptyString();
+    void testSharedStringPoolThreaded();
     void testFdo60915();
     void testI116701();
     void testTdf103060();
@@ -85,6 +88,7 @@ public:
     CPPUNIT_TEST(testSharedStringPoolPurge);
     CPPUNIT_TEST(testSharedStringPoolPurgeBug1);
     CPPUNIT_TEST(testSharedStringPoolEmptyString);
+    CPPUNIT_TEST(testSharedStringPoolThreaded);
     CPPUNIT_TEST(testFdo60915);
     CPPUNIT_TEST(testI116701);
     CPPUNIT_TEST(testTdf103060);
@@ -451,6 +455,62 @@ void Test::testSharedStringPoolEmptyString()
     CPPUNIT_ASSERT_EQUAL(SharedString::getEmptyString(), aPool.intern(SharedString::EMPTY_STRING));
 }
 
+void Test::testSharedStringPoolThreaded()
+{
+    // Intern the same strings from several threads at once, in both cases, and
+    // make sure every thread ends up with the same pooled objects.
+    SvtSysLocale aSysLocale;
+    svl::SharedStringPool aPool(aSysLocale.GetCharClass());
+    size_t extraCountIgnoreCase = aPool.getCountIgnoreCase();
+
+    constexpr int nThreads = 4;
+    constexpr int nStrings = 1000;
+    std::vector<std::vector<svl::SharedString>> aResults(nThreads);
+    std::vector<std::thread> aThreads;
+    for (int nThread = 0; nThread < nThreads; ++nThread)
+    {
+        aThreads.emplace_back([&aPool, &aResults, nThread]() {
+            std::vector<svl::SharedString>& rResults = aResults[nThread];
+            for (int i = 0; i < nStrings; ++i)
+            {
+                // Odd threads intern the upper-case variant first.
+                if (nThread % 2)
+                {
+                    rResults.push_back(aPool.intern("STR" + OUString::number(i)));
+                    rResults.push_back(aPool.intern("str" + OUString::number(i)));
+                }
+                else
+                {
+                    rResults.push_back(aPool.intern("str" + OUString::number(i)));
+                    rResults.push_back(aPool.intern("STR" + OUString::number(i)));
+                }
+            }
+        });
+    }
+    for (std::thread& rThread : aThreads)
+        rThread.join();
+
+    for (int i = 0; i < nStrings; ++i)
+    {
+        svl::SharedString aLower = aPool.intern("str" + OUString::number(i));
+        svl::SharedString aUpper = aPool.intern("STR" + OUString::number(i));
+        CPPUNIT_ASSERT(aLower.getData() != aUpper.getData());
+        CPPUNIT_ASSERT_EQUAL(aUpper.getData(), aLower.getDataIgnoreCase());
+        CPPUNIT_ASSERT_EQUAL(aUpper.getData(), aUpper.getDataIgnoreCase());
+        for (int nThread = 0; nThread < nThreads; ++nThread)
+        {
+            const std::vector<svl::SharedString>& rResults = aResults[nThread];
+            const svl::SharedString& rFirst = rResults[2 * i];
+            const svl::SharedString& rSecond = rResults[2 * i + 1];
+            CPPUNIT_ASSERT_EQUAL((nThread % 2 ? aUpper : aLower).getData(), rFirst.getData());
+            CPPUNIT_ASSERT_EQUAL((nThread % 2 ? aLower : aUpper).getData(), rSecond.getData());
+            CPPUNIT_ASSERT_EQUAL(aUpper.getData(), rFirst.getDataIgnoreCase());
+            CPPUNIT_ASSERT_EQUAL(aUpper.getData(), rSecond.getDataIgnoreCase());
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(size_t(nStrings) + extraCountIgnoreCase, aPool.getCountIgnoreCase());
+}
+
 void Test::checkPreviewString(SvNumberFormatter& aFormatter,
                               const OUString& sCode,
                               double fPreviewNumber,
@@ -1152,6 +1212,9 @@ void Test::testIsNumberFormat()
     } const aTests[] = {
         { "20.3", true },
         { "2", true },
+        { "-42", true },
+        { "-", false },
+        { "1234567890123456", true },
         { "test", false },
         { "Jan1", false }, // tdf#34724
         { "1Jan", false }, // tdf#34724
@@ -1219,30 +1219,28 @@ bool SfxItemSet::Equals(const SfxItemSet &rCmp, bool bComparePool) const
     if ( nCount1 != nCount2 )
         return false;
 
-    // Are the Ranges themselves unequal?
-    for (sal_Int32 i = 0; i < m_pWhichRanges.size(); ++i)
+    // Are the Ranges themselves unequal? (Sets created from the same ranges
+    // usually share them, which is detected without comparing them.)
+    if (!(m_pWhichRanges == rCmp.m_pWhichRanges))
     {
-        if (m_pWhichRanges[i] != rCmp.m_pWhichRanges[i])
+        // We must use the slow method then
+        SfxWhichIter aIter( *this );
+        for ( sal_uInt16 nWh = aIter.FirstWhich();
+              nWh;
+              nWh = aIter.NextWhich() )
         {
-            // We must use the slow method then
-            SfxWhichIter aIter( *this );
-            for ( sal_uInt16 nWh = aIter.FirstWhich();
-                  nWh;
-                  nWh = aIter.NextWhich() )
-            {
-                // If the pointer of the poolable Items are unequal, the Items must match
-                const SfxPoolItem *pItem1 = nullptr, *pItem2 = nullptr;
-                if ( GetItemState( nWh, false, &pItem1 ) !=
-                        rCmp.GetItemState( nWh, false, &pItem2 ) ||
-                     ( pItem1 != pItem2 &&
-                        ( !pItem1 || IsInvalidItem(pItem1) ||
-                          (m_pPool->IsItemPoolable(*pItem1) &&
-                            *pItem1 != *pItem2 ) ) ) )
-                    return false;
-            }
-
-            return true;
+            // If the pointer of the poolable Items are unequal, the Items must match
+            const SfxPoolItem *pItem1 = nullptr, *pItem2 = nullptr;
+            if ( GetItemState( nWh, false, &pItem1 ) !=
+                    rCmp.GetItemState( nWh, false, &pItem2 ) ||
+                 ( pItem1 != pItem2 &&
+                    ( !pItem1 || IsInvalidItem(pItem1) ||
+                      (m_pPool->IsItemPoolable(*pItem1) &&
+                        *pItem1 != *pItem2 ) ) ) )
+                return false;
         }
+
+        return true;
     }
 
     // Are all pointers the same?
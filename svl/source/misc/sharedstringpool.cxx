@@ -11,6 +11,7 @@
 #include <svl/sharedstring.hxx>
 #include <unotools/charclass.hxx>
 
+#include <array>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
@@ -52,19 +53,43 @@ namespace
 sal_Int32 getRefCount(const rtl_uString* p) { return (p->refCount & 0x3FFFFFFF); }
 }
 
+/**
+ * The pool is split into shards, each guarding its part of the map with its
+ * own mutex, so that threads interning different strings (as the threaded
+ * sheet import and formula calculation do) rarely wait for each other.  A
+ * string always lives in the shard picked by its hash, and its upper-case
+ * variant in the shard picked by the upper-case hash.  No thread ever holds
+ * more than one shard lock at once while interning.
+ */
+constexpr size_t nShardBits = 5;
+constexpr size_t nShards = size_t(1) << nShardBits;
+
 struct SharedStringPool::Impl
 {
-    mutable std::mutex maMutex;
-    // We use this map for two purposes - to store lower->upper case mappings
-    // and to retrieve a shared uppercase object, so the management logic
-    // is quite complex.
-    std::unordered_map<StringWithHash, OUString> maStrMap;
+    struct alignas(64) Shard
+    {
+        mutable std::mutex maMutex;
+        // We use this map for two purposes - to store lower->upper case mappings
+        // and to retrieve a shared uppercase object, so the management logic
+        // is quite complex.
+        std::unordered_map<StringWithHash, OUString> maStrMap;
+    };
+
+    std::array<Shard, nShards> maShards;
     const CharClass& mrCharClass;
 
     explicit Impl(const CharClass& rCharClass)
         : mrCharClass(rCharClass)
     {
     }
+
+    Shard& getShard(const StringWithHash& rStr)
+    {
+        // Spread the bits, the plain hash code of similar strings differs
+        // mostly in the low bits.
+        sal_uInt32 nHash = static_cast<sal_uInt32>(rStr.hashCode) * 0x9E3779B1u;
+        return maShards[nHash >> (32 - nShardBits)];
+    }
 };
 
 SharedStringPool::SharedStringPool(const CharClass& rCharClass)
@@ -80,42 +105,44 @@ SharedStringPool::~SharedStringPool() {}
 SharedString SharedStringPool::intern(const OUString& rStr)
 {
     StringWithHash aStrWithHash(rStr);
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
-
-    auto[mapIt, bInserted] = mpImpl->maStrMap.emplace(aStrWithHash, rStr);
-    if (!bInserted)
-        // there is already a mapping
-        return SharedString(mapIt->first.str.pData, mapIt->second.pData);
+    Impl::Shard& rShard = mpImpl->getShard(aStrWithHash);
+    {
+        std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+        auto mapIt = rShard.maStrMap.find(aStrWithHash);
+        if (mapIt != rShard.maStrMap.end())
+            // there is already a mapping
+            return SharedString(mapIt->first.str.pData, mapIt->second.pData);
+    }
 
-    // This is a new string insertion. Establish mapping to upper-case variant.
+    // This is a new string insertion. Establish mapping to upper-case variant,
+    // without holding any lock while converting.
     OUString aUpper = mpImpl->mrCharClass.uppercase(rStr);
-    if (aUpper == rStr)
-        // no need to do anything more, because we inserted an upper->upper mapping
-        return SharedString(mapIt->first.str.pData, mapIt->second.pData);
-
-    // We need to insert a lower->upper mapping, so also insert
-    // an upper->upper mapping, which we can use both for when an upper string
-    // is interned, and to look up a shared upper string.
-    StringWithHash aUpperWithHash(aUpper);
-    auto mapIt2 = mpImpl->maStrMap.find(aUpperWithHash);
-    if (mapIt2 != mpImpl->maStrMap.end())
+    if (aUpper != rStr)
     {
-        // there is an already existing upper string
-        mapIt->second = mapIt2->first.str;
-        return SharedString(mapIt->first.str.pData, mapIt->second.pData);
+        // We need to insert a lower->upper mapping, so also make sure there
+        // is an upper->upper mapping, which we can use both for when an upper
+        // string is interned, and to look up a shared upper string.
+        StringWithHash aUpperWithHash(aUpper);
+        Impl::Shard& rUpperShard = mpImpl->getShard(aUpperWithHash);
+        std::scoped_lock<std::mutex> aGuard(rUpperShard.maMutex);
+        auto mapIt = rUpperShard.maStrMap.emplace(aUpperWithHash, aUpper).first;
+        // use the already existing upper string, if there is one
+        aUpper = mapIt->first.str;
     }
 
-    // There is no already existing upper string.
-    // First, update using the iterator, can't do this later because
-    // the iterator will be invalid.
-    mapIt->second = aUpper;
-    mpImpl->maStrMap.emplace_hint(mapIt2, aUpperWithHash, aUpper);
-    return SharedString(rStr.pData, aUpper.pData);
+    std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+    // Another thread may have interned the same string in the meantime, in
+    // which case its mapping is used.
+    auto mapIt = rShard.maStrMap.emplace(aStrWithHash, aUpper != rStr ? aUpper : rStr).first;
+    return SharedString(mapIt->first.str.pData, mapIt->second.pData);
 }
 
 void SharedStringPool::purge()
 {
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
+    // Lock all shards, always in the same order.
+    std::array<std::unique_lock<std::mutex>, nShards> aGuards;
+    for (size_t i = 0; i < nShards; ++i)
+        aGuards[i] = std::unique_lock<std::mutex>(mpImpl->maShards[i].maMutex);
 
     // Because we can have an uppercase entry mapped to itself,
     // and then a bunch of lowercase entries mapped to that same
@@ -123,60 +150,74 @@ void SharedStringPool::purge()
     // time to remove lowercase entries, and then only can we
     // check for unused uppercase entries.
 
-    auto it = mpImpl->maStrMap.begin();
-    auto itEnd = mpImpl->maStrMap.end();
-    while (it != itEnd)
+    for (Impl::Shard& rShard : mpImpl->maShards)
     {
-        rtl_uString* p1 = it->first.str.pData;
-        rtl_uString* p2 = it->second.pData;
-        if (p1 != p2)
+        auto it = rShard.maStrMap.begin();
+        auto itEnd = rShard.maStrMap.end();
+        while (it != itEnd)
         {
-            // normal case - lowercase mapped to uppercase, which
-            // means that the lowercase entry has one ref-counted
-            // entry as the key in the map
-            if (getRefCount(p1) == 1)
+            rtl_uString* p1 = it->first.str.pData;
+            rtl_uString* p2 = it->second.pData;
+            if (p1 != p2)
             {
-                it = mpImpl->maStrMap.erase(it);
-                continue;
+                // normal case - lowercase mapped to uppercase, which
+                // means that the lowercase entry has one ref-counted
+                // entry as the key in the map
+                if (getRefCount(p1) == 1)
+                {
+                    it = rShard.maStrMap.erase(it);
+                    continue;
+                }
             }
+            ++it;
         }
-        ++it;
     }
 
-    it = mpImpl->maStrMap.begin();
-    itEnd = mpImpl->maStrMap.end();
-    while (it != itEnd)
+    for (Impl::Shard& rShard : mpImpl->maShards)
     {
-        rtl_uString* p1 = it->first.str.pData;
-        rtl_uString* p2 = it->second.pData;
-        if (p1 == p2)
+        auto it = rShard.maStrMap.begin();
+        auto itEnd = rShard.maStrMap.end();
+        while (it != itEnd)
         {
-            // uppercase which is mapped to itself, which means
-            // one ref-counted entry as the key in the map, and
-            // one ref-counted entry in the value in the map
-            if (getRefCount(p1) == 2)
+            rtl_uString* p1 = it->first.str.pData;
+            rtl_uString* p2 = it->second.pData;
+            if (p1 == p2)
             {
-                it = mpImpl->maStrMap.erase(it);
-                continue;
+                // uppercase which is mapped to itself, which means
+                // one ref-counted entry as the key in the map, and
+                // one ref-counted entry in the value in the map
+                if (getRefCount(p1) == 2)
+                {
+                    it = rShard.maStrMap.erase(it);
+                    continue;
+                }
             }
+            ++it;
         }
-        ++it;
     }
 }
 
 size_t SharedStringPool::getCount() const
 {
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
-    return mpImpl->maStrMap.size();
+    size_t nCount = 0;
+    for (const Impl::Shard& rShard : mpImpl->maShards)
+    {
+        std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+        nCount += rShard.maStrMap.size();
+    }
+    return nCount;
 }
 
 size_t SharedStringPool::getCountIgnoreCase() const
 {
-    std::scoped_lock<std::mutex> aGuard(mpImpl->maMutex);
     // this is only called from unit tests, so no need to be efficient
     std::unordered_set<OUString> aUpperSet;
-    for (auto const& pair : mpImpl->maStrMap)
-        aUpperSet.insert(pair.second);
+    for (const Impl::Shard& rShard : mpImpl->maShards)
+    {
+        std::scoped_lock<std::mutex> aGuard(rShard.maMutex);
+        for (auto const& pair : rShard.maStrMap)
+            aUpperSet.insert(pair.second);
+    }
     return aUpperSet.size();
 }
 }
@@ -210,15 +210,34 @@ void SvtBroadcaster::Broadcast( const SfxHint &rHint )
     Normalize();
 
     ListenersType::const_iterator dest(maDestructedListeners.begin());
-    ListenersType aListeners(maListeners); // this copy is important to avoid erasing entries while iterating
-    for (auto& rpListener : aListeners)
+    auto notifyListeners = [this, &rHint, &dest](SvtListener* const* pBegin, SvtListener* const* pEnd)
     {
-        // skip the destructed ones
-        while (dest != maDestructedListeners.end() && (*dest < rpListener))
-            ++dest;
+        for (SvtListener* const* pp = pBegin; pp != pEnd; ++pp)
+        {
+            SvtListener* pListener = *pp;
+            // skip the destructed ones
+            while (dest != maDestructedListeners.end() && (*dest < pListener))
+                ++dest;
 
-        if (dest == maDestructedListeners.end() || *dest != rpListener)
-            rpListener->Notify(rHint);
+            if (dest == maDestructedListeners.end() || *dest != pListener)
+                pListener->Notify(rHint);
+        }
+    };
+
+    // Iterating over a copy is important to avoid erasing entries while iterating.
+    // Most broadcasters have only a few listeners, don't allocate the copy for them.
+    constexpr size_t nMaxStackListeners = 16;
+    const size_t nListeners = maListeners.size();
+    if (nListeners <= nMaxStackListeners)
+    {
+        SvtListener* aListeners[nMaxStackListeners];
+        std::copy(maListeners.begin(), maListeners.end(), aListeners);
+        notifyListeners(aListeners, aListeners + nListeners);
+    }
+    else
+    {
+        ListenersType aListeners(maListeners);
+        notifyListeners(aListeners.data(), aListeners.data() + nListeners);
     }
 }
 
@@ -129,6 +129,27 @@ void ImpSvNumberInputScan::Reset()
     }
 }
 
+/** Plain integer without any sign other than '-', separators or spaces, short
+    enough to be represented exactly.
+ */
+static bool lcl_IsPlainInteger( const OUString& rStr, double& fOutNumber )
+{
+    sal_Int32 nPos = (rStr.startsWith("-") ? 1 : 0);
+    const sal_Int32 nLen = rStr.getLength();
+    if (nLen == nPos || nLen - nPos > 15)
+        return false;
+    double fNumber = 0.0;
+    for ( ; nPos < nLen; ++nPos)
+    {
+        const sal_Unicode c = rStr[nPos];
+        if (!rtl::isAsciiDigit(c))
+            return false;
+        fNumber = fNumber * 10.0 + (c - '0');
+    }
+    fOutNumber = (rStr[0] == '-' ? -fNumber : fNumber);
+    return true;
+}
+
 // native number transliteration if necessary
 static void TransformInput( SvNumberFormatter const * pFormatter, OUString& rStr )
 {
@@ -3863,6 +3884,18 @@ bool ImpSvNumberInputScan::IsNumberFormat( const OUString& rString,         // s
     {
         res = false;
     }
+    else if (!pFormat && eSetType == SvNumFormatType::NUMBER && lcl_IsPlainInteger( rString, fOutNumber))
+    {
+        // Plain integers are the most common input of imports, no need to tokenize.
+        Reset();
+        sStrArray[0] = rString;
+        IsNum[0] = true;
+        nStringsCnt = 1;
+        nNumericsCnt = 1;
+        eScannedType = SvNumFormatType::NUMBER;
+        F_Type = eScannedType;
+        return true;
+    }
     else
     {
         // NoMoreUpperNeeded, all comparisons on UpperCase
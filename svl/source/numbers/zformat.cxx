@@ -2496,13 +2496,12 @@ bool SvNumberformat::GetOutputString(double fNumber,
         }
         return false;
     }
-    OUStringBuffer sBuff(64);
     if (eType & SvNumFormatType::TEXT)
     {
-        ImpGetOutputStandard(fNumber, sBuff);
-        OutString = sBuff.makeStringAndClear();
+        ImpGetOutputStandard(fNumber, OutString);
         return false;
     }
+    OUStringBuffer sBuff(64);
     bool bHadStandard = false;
     if (bStandard) // Individual standard formats
     {
@@ -2563,9 +2562,8 @@ bool SvNumberformat::GetOutputString(double fNumber,
                 }
                 return false;
             }
-            ImpGetOutputStandard(fNumber, sBuff);
-            bHadStandard = true;
-            break;
+            ImpGetOutputStandard(fNumber, OutString);
+            return false;
         case SvNumFormatType::DATE:
             bRes |= ImpGetDateOutput(fNumber, 0, sBuff);
             bHadStandard = true;
@@ -2599,8 +2597,7 @@ bool SvNumberformat::GetOutputString(double fNumber,
         }
         else if (nCnt == 0) // Else Standard Format
         {
-            ImpGetOutputStandard(fNumber, sBuff);
-            OutString = sBuff.makeStringAndClear();
+            ImpGetOutputStandard(fNumber, OutString);
             return false;
         }
         switch (rInfo.eScannedType)
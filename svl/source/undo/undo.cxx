@@ -499,11 +499,12 @@ void SfxUndoManager::Reset()
 
 void SfxUndoManager::ImplClearUndo( UndoManagerGuard& i_guard )
 {
-    while ( m_xData->pActUndoArray->nCurUndoAction > 0 )
-    {
-        i_guard.markForDeletion( m_xData->pActUndoArray->Remove( 0 ) );
-        --m_xData->pActUndoArray->nCurUndoAction;
-    }
+    // remove all undo actions at once, not one by one from the front
+    SfxUndoArray* pUndoArray = m_xData->pActUndoArray;
+    for ( size_t i = 0; i < pUndoArray->nCurUndoAction; ++i )
+        i_guard.markForDeletion( std::move( pUndoArray->maUndoActions[i].pAction ) );
+    pUndoArray->Remove( 0, pUndoArray->nCurUndoAction );
+    pUndoArray->nCurUndoAction = 0;
     ImplCheckEmptyActions();
     // TODO: notifications? We don't have clearedUndo, only cleared and clearedRedo at the SfxUndoListener
 }
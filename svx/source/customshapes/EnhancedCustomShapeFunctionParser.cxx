@@ -1140,7 +1140,9 @@ std::shared_ptr<ExpressionNode> const & FunctionParser::parseFunction( std::u16s
     ParserContextSharedPtr pContext = getParserContext();
     pContext->mpCustoShape = &rCustoShape;
 
-    ExpressionGrammar aExpressionGrammer( pContext );
+    // the grammar is static as well, Spirit builds the definition of all
+    // its rules again for every new grammar object
+    static ExpressionGrammar aExpressionGrammer( pContext );
     const ::boost::spirit::classic::parse_info<StringIteratorT> aParseInfo(
             ::boost::spirit::classic::parse( aStart,
                                     aEnd,
@@ -2304,12 +2304,6 @@ SdrObject* SdrMarkView::CheckSingleSdrObjectHit(const Point& rPnt, sal_uInt16 nT
         return nullptr;
     }
 
-    const bool bCheckIfMarkable(nOptions & SdrSearchOptions::TESTMARKABLE);
-    const bool bDeep(nOptions & SdrSearchOptions::DEEP);
-    const bool bOLE(dynamic_cast< const SdrOle2Obj* >(pObj) !=  nullptr);
-    auto pTextObj = DynCastSdrTextObj( pObj);
-    const bool bTXT(pTextObj && pTextObj->IsTextFrame());
-    SdrObject* pRet=nullptr;
     tools::Rectangle aRect(pObj->GetCurrentBoundRect());
 
     // add possible GridOffset to up-to-now view-independent BoundRect data
@@ -2321,6 +2315,26 @@ SdrObject* SdrMarkView::CheckSingleSdrObjectHit(const Point& rPnt, sal_uInt16 nT
             basegfx::fround(aGridOffset.getY()));
     }
 
+    // Most objects are not hit at all: reject them using the largest
+    // possible tolerance before looking closer at the object.
+    {
+        const sal_uInt16 nMaxTol(nTol * 2);
+        tools::Rectangle aMaxRect(aRect);
+        aMaxRect.AdjustLeft( -nMaxTol );
+        aMaxRect.AdjustTop( -nMaxTol );
+        aMaxRect.AdjustRight( nMaxTol );
+        aMaxRect.AdjustBottom( nMaxTol );
+        if (!aMaxRect.Contains(rPnt))
+            return nullptr;
+    }
+
+    const bool bCheckIfMarkable(nOptions & SdrSearchOptions::TESTMARKABLE);
+    const bool bDeep(nOptions & SdrSearchOptions::DEEP);
+    const bool bOLE(dynamic_cast< const SdrOle2Obj* >(pObj) !=  nullptr);
+    auto pTextObj = DynCastSdrTextObj( pObj);
+    const bool bTXT(pTextObj && pTextObj->IsTextFrame());
+    SdrObject* pRet=nullptr;
+
     sal_uInt16 nTol2(nTol);
 
     // double tolerance for OLE, text frames and objects in
@@ -289,12 +289,20 @@ Graphic SvXMLGraphicOutputStream::GetGraphic()
 
     if (mbClosed && moGrfObj->GetType() == GraphicType::NONE && mpOStm)
     {
+        // Like SvXMLGraphicHelper::ImplReadGraphic(), leave the decoding of
+        // the graphic to when it's first needed, if the format allows that.
         mpOStm->Seek( 0 );
+        aGraphic = GraphicFilter::GetGraphicFilter().ImportUnloadedGraphic(*mpOStm);
+
         sal_uInt16 nFormat = GRFILTER_FORMAT_DONTKNOW;
         sal_uInt16 nDeterminedFormat = GRFILTER_FORMAT_DONTKNOW;
-        GraphicFilter::GetGraphicFilter().ImportGraphic( aGraphic, u"", *mpOStm ,nFormat,&nDeterminedFormat);
+        if (aGraphic.IsNone())
+        {
+            mpOStm->Seek( 0 );
+            GraphicFilter::GetGraphicFilter().ImportGraphic( aGraphic, u"", *mpOStm ,nFormat,&nDeterminedFormat);
+        }
 
-        if (nDeterminedFormat == GRFILTER_FORMAT_DONTKNOW)
+        if (aGraphic.IsNone() && nDeterminedFormat == GRFILTER_FORMAT_DONTKNOW)
         {
             //Read the first two byte to check whether it is a gzipped stream, is so it may be in wmz or emz format
             //unzip them and try again
@@ -63,6 +63,7 @@ struct BlockInfo final
 
 class SW_DLLPUBLIC BigPtrArray
 {
+    friend class BigPtrEntry;
 protected:
     std::unique_ptr<BlockInfo*[]>
                     m_ppInf;              ///< block info
@@ -72,10 +73,27 @@ protected:
     mutable
         sal_uInt16  m_nCur;               ///< last used block
 
+    /** Indices of the blocks whose stored nStart is at least m_nPendStart
+        are still to be moved by m_nPendDelta.  Repeated inserts and removes
+        in one block then don't have to update all following blocks. */
+    sal_Int32       m_nPendStart;
+    sal_Int32       m_nPendDelta;
+
+    sal_Int32 BlockStart( const BlockInfo& rBlock ) const
+    {
+        return rBlock.nStart >= m_nPendStart ? rBlock.nStart + m_nPendDelta : rBlock.nStart;
+    }
+    sal_Int32 BlockEnd( const BlockInfo& rBlock ) const
+    {
+        return rBlock.nStart >= m_nPendStart ? rBlock.nEnd + m_nPendDelta : rBlock.nEnd;
+    }
+
     sal_uInt16  Index2Block( sal_Int32 ) const; ///< block search
     BlockInfo*  InsBlock( sal_uInt16 );         ///< insert block
     void        BlockDel( sal_uInt16 );         ///< some blocks were deleted
     void        UpdIndex( sal_uInt16 );         ///< recalculate indices
+    void        MoveIndex( sal_uInt16, sal_Int32 ); ///< move indices behind a block
+    void        ApplyPendingIndex();            ///< really move pending indices
 
     // fill all blocks
     sal_uInt16 Compress();
@@ -97,7 +115,7 @@ public:
 inline sal_Int32 BigPtrEntry::GetPos() const
 {
     assert(this == m_pBlock->mvData[ m_nOffset ]); // element not in the block
-    return m_pBlock->nStart + m_nOffset;
+    return m_pBlock->pBigArr->BlockStart( *m_pBlock ) + m_nOffset;
 }
 
 inline BigPtrArray& BigPtrEntry::GetArray() const
@@ -510,6 +510,64 @@ public:
         releaseBigPtrArrayContent(bparr);
     }
 
+    /** Insert and remove single entries in one place of an
+        array of several blocks, and in between at other places,
+        the positions of all entries have to stay correct.
+    */
+    void test_insert_and_remove_in_many_blocks()
+    {
+        BigPtrArray bparr;
+
+        fillBigPtrArray(bparr, 5000);
+
+        for (sal_Int32 i = 0; i < 3000; i++)
+        {
+            bparr.Insert(new BigPtrEntryMock(5000 + i), 1500);
+            if (i % 500 == 0)
+                bparr.Insert(new BigPtrEntryMock(-1), bparr.Count() - 100);
+        }
+
+        CPPUNIT_ASSERT_EQUAL_MESSAGE
+        (
+            "test_insert_and_remove_in_many_blocks failed",
+            static_cast<sal_Int32>(8006), bparr.Count()
+        );
+        CPPUNIT_ASSERT_EQUAL_MESSAGE
+        (
+            "test_insert_and_remove_in_many_blocks failed",
+            static_cast<sal_Int32>(7999), static_cast<BigPtrEntryMock*>(bparr[1500])->getCount()
+        );
+        CPPUNIT_ASSERT_MESSAGE
+        (
+            "test_insert_and_remove_in_many_blocks failed",
+            checkElementPositions(bparr)
+        );
+
+        for (sal_Int32 i = 0; i < 1000; i++)
+        {
+            delete bparr[2500];
+            bparr.Remove(2500);
+            if (i % 300 == 0)
+            {
+                delete bparr[100];
+                bparr.Remove(100);
+            }
+        }
+
+        CPPUNIT_ASSERT_EQUAL_MESSAGE
+        (
+            "test_insert_and_remove_in_many_blocks failed",
+            static_cast<sal_Int32>(7002), bparr.Count()
+        );
+        CPPUNIT_ASSERT_MESSAGE
+        (
+            "test_insert_and_remove_in_many_blocks failed",
+            checkElementPositions(bparr)
+        );
+
+        releaseBigPtrArrayContent(bparr);
+    }
+
     CPPUNIT_TEST_SUITE(BigPtrArrayUnittest);
     CPPUNIT_TEST(test_ctor);
     CPPUNIT_TEST(test_insert_entries_at_front);
@@ -525,6 +583,7 @@ public:
     CPPUNIT_TEST(test_move_elements_from_higher_to_lower_pos);
     CPPUNIT_TEST(test_move_to_same_position);
     CPPUNIT_TEST(test_replace_elements);
+    CPPUNIT_TEST(test_insert_and_remove_in_many_blocks);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -586,6 +645,18 @@ public:
     void test_insert_at_front_1000000()
     { test_insert_at_front("1000000"); }
 
+    void test_insert_in_the_middle_1000()
+    { test_insert_in_the_middle("1000"); }
+
+    void test_insert_in_the_middle_10000()
+    { test_insert_in_the_middle("10000"); }
+
+    void test_insert_in_the_middle_100000()
+    { test_insert_in_the_middle("100000"); }
+
+    void test_insert_in_the_middle_1000000()
+    { test_insert_in_the_middle("1000000"); }
+
     CPPUNIT_TEST_SUITE(BigPtrArrayPerformanceTest);
     CPPUNIT_TEST(test_insert_at_end_1000);
     CPPUNIT_TEST(test_insert_at_end_10000);
@@ -595,6 +666,10 @@ public:
     CPPUNIT_TEST(test_insert_at_front_10000);
     CPPUNIT_TEST(test_insert_at_front_100000);
     CPPUNIT_TEST(test_insert_at_front_1000000);
+    CPPUNIT_TEST(test_insert_in_the_middle_1000);
+    CPPUNIT_TEST(test_insert_in_the_middle_10000);
+    CPPUNIT_TEST(test_insert_in_the_middle_100000);
+    CPPUNIT_TEST(test_insert_in_the_middle_1000000);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -623,6 +698,19 @@ private:
 
         releaseBigPtrArrayContent(bparr);
     }
+
+    void test_insert_in_the_middle(const char* numElements)
+    {
+        OStringBuffer buff("test_insert_in_the_middle ");
+        buff.append(numElements);
+        int n = atoi(numElements);
+        PerformanceTracer tracer(buff.getStr());
+        BigPtrArray bparr;
+        for (int i = 0; i < n; i++)
+            bparr.Insert(new BigPtrEntryMock(i), bparr.Count() / 2);
+
+        releaseBigPtrArrayContent(bparr);
+    }
 };
 
 #endif
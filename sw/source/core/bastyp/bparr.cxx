@@ -27,17 +27,20 @@
 const sal_uInt16 nBlockGrowSize = 20;
 
 #if OSL_DEBUG_LEVEL > 2
-#define CHECKIDX( p, n, i, c ) CheckIdx( p, n, i, c );
-void CheckIdx( BlockInfo** ppInf, sal_uInt16 nBlock, sal_Int32 nSize, sal_uInt16 nCur )
+#define CHECKIDX( p, n, i, c ) CheckIdx( p, n, i, c, m_nPendStart, m_nPendDelta );
+void CheckIdx( BlockInfo** ppInf, sal_uInt16 nBlock, sal_Int32 nSize, sal_uInt16 nCur,
+               sal_Int32 nPendStart, sal_Int32 nPendDelta )
 {
     assert( !nSize || nCur < nBlock ); // BigPtrArray: CurIndex invalid
 
-    sal_Int32 nIdx = 0;
+    sal_Int32 nIdx = 0, nLastEnd = -1;
     for( sal_uInt16 nCnt = 0; nCnt < nBlock; ++nCnt, ++ppInf )
     {
         nIdx += (*ppInf)->nElem;
+        sal_Int32 nDelta = (*ppInf)->nStart >= nPendStart ? nPendDelta : 0;
         // Array with holes is not allowed
-        assert( !nCnt || (*(ppInf-1))->nEnd + 1 == (*ppInf)->nStart );
+        assert( !nCnt || nLastEnd + 1 == (*ppInf)->nStart + nDelta );
+        nLastEnd = (*ppInf)->nEnd + nDelta;
     }
     assert(nIdx == nSize); // invalid count in nSize
 }
@@ -49,6 +52,8 @@ BigPtrArray::BigPtrArray()
 {
     m_nBlock = m_nCur = 0;
     m_nSize = 0;
+    m_nPendStart = SAL_MAX_INT32;
+    m_nPendDelta = 0;
     m_nMaxBlock = nBlockGrowSize;
     m_ppInf.reset( new BlockInfo* [ m_nMaxBlock ] );
 }
@@ -73,7 +78,7 @@ void BigPtrArray::Move( sal_Int32 from, sal_Int32 to )
     {
         sal_uInt16 cur = Index2Block( from );
         BlockInfo* p = m_ppInf[ cur ];
-        BigPtrEntry* pElem = p->mvData[ from - p->nStart ];
+        BigPtrEntry* pElem = p->mvData[ from - BlockStart( *p ) ];
         Insert( pElem, to ); // insert first, then delete!
         Remove( ( to < from ) ? ( from + 1 ) : from );
     }
@@ -84,7 +89,7 @@ BigPtrEntry* BigPtrArray::operator[]( sal_Int32 idx ) const
     assert(idx < m_nSize); // operator[]: Index out of bounds
     m_nCur = Index2Block( idx );
     BlockInfo* p = m_ppInf[ m_nCur ];
-    return p->mvData[ idx - p->nStart ];
+    return p->mvData[ idx - BlockStart( *p ) ];
 }
 
 /** Search a block at a given position */
@@ -92,7 +97,7 @@ sal_uInt16 BigPtrArray::Index2Block( sal_Int32 pos ) const
 {
     // last used block?
     BlockInfo* p = m_ppInf[ m_nCur ];
-    if( p->nStart <= pos && p->nEnd >= pos )
+    if( BlockStart( *p ) <= pos && BlockEnd( *p ) >= pos )
         return m_nCur;
     // Index = 0?
     if( !pos )
@@ -102,14 +107,14 @@ sal_uInt16 BigPtrArray::Index2Block( sal_Int32 pos ) const
     if( m_nCur < ( m_nBlock - 1 ) )
     {
         p = m_ppInf[ m_nCur+1 ];
-        if( p->nStart <= pos && p->nEnd >= pos )
+        if( BlockStart( *p ) <= pos && BlockEnd( *p ) >= pos )
             return m_nCur+1;
     }
     // previous one?
-    else if( pos < p->nStart && m_nCur > 0 )
+    else if( pos < BlockStart( *p ) && m_nCur > 0 )
     {
         p = m_ppInf[ m_nCur-1 ];
-        if( p->nStart <= pos && p->nEnd >= pos )
+        if( BlockStart( *p ) <= pos && BlockEnd( *p ) >= pos )
             return m_nCur-1;
     }
 
@@ -121,10 +126,10 @@ sal_uInt16 BigPtrArray::Index2Block( sal_Int32 pos ) const
         sal_uInt16 n = lower + ( upper - lower ) / 2;
         cur = ( n == cur ) ? n+1 : n;
         p = m_ppInf[ cur ];
-        if( p->nStart <= pos && p->nEnd >= pos )
+        if( BlockStart( *p ) <= pos && BlockEnd( *p ) >= pos )
             return cur;
 
-        if( p->nStart > pos )
+        if( BlockStart( *p ) > pos )
             upper = cur;
         else
             lower = cur;
@@ -148,6 +153,43 @@ void BigPtrArray::UpdIndex( sal_uInt16 pos )
     }
 }
 
+/** Move the indices of all blocks behind a block
+
+    Only remembered if the indices behind the same block were moved
+    before, or nothing is pending.  Otherwise the pending move has to be
+    done first.
+
+    @param pos last correct block
+    @param nDelta number of elements inserted into (or removed from) it
+*/
+void BigPtrArray::MoveIndex( sal_uInt16 pos, sal_Int32 nDelta )
+{
+    BlockInfo* p = m_ppInf[ pos+1 ];
+    if( p->nStart != m_nPendStart )
+    {
+        ApplyPendingIndex();
+        m_nPendStart = p->nStart;
+    }
+    m_nPendDelta += nDelta;
+}
+
+/** Move the indices of the blocks behind the pending start */
+void BigPtrArray::ApplyPendingIndex()
+{
+    if( m_nPendStart == SAL_MAX_INT32 )
+        return;
+    for( sal_uInt16 n = m_nBlock; n; )
+    {
+        BlockInfo* p = m_ppInf[ --n ];
+        if( p->nStart < m_nPendStart )
+            break;
+        p->nStart += m_nPendDelta;
+        p->nEnd += m_nPendDelta;
+    }
+    m_nPendStart = SAL_MAX_INT32;
+    m_nPendDelta = 0;
+}
+
 /** Create and insert new block
 
     Existing blocks will be moved rearward.
@@ -156,6 +198,7 @@ void BigPtrArray::UpdIndex( sal_uInt16 pos )
 */
 BlockInfo* BigPtrArray::InsBlock( sal_uInt16 pos )
 {
+    ApplyPendingIndex();
     if( m_nBlock == m_nMaxBlock )
     {
         // than extend the array first
@@ -225,6 +268,8 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
         cur = Index2Block( pos );
         p = m_ppInf[ cur ];
     }
+    sal_uInt16 nCorrect = cur; // last block with correct indices
+    bool bNewBlock = false;
 
     if( p->nElem == MAXENTRY )
     {
@@ -233,6 +278,8 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
         if( cur < ( m_nBlock - 1 ) && m_ppInf[ cur+1 ]->nElem < MAXENTRY )
         {
             q = m_ppInf[ cur+1 ];
+            if( q->nStart >= m_nPendStart )
+                ApplyPendingIndex();
             if( q->nElem )
             {
                 int nCount = q->nElem;
@@ -244,8 +291,6 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
                     ++((*pTo)->m_nOffset);
                 }
             }
-            q->nStart--;
-            q->nEnd--;
         }
         else
         {
@@ -262,6 +307,7 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
             }
 
             q = InsBlock( cur+1 );
+            bNewBlock = true;
         }
 
         // entry does not fit anymore - clear space
@@ -275,9 +321,11 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
 
         p->nEnd--;
         p->nElem--;
+        // the start of the next block stays, only the blocks behind it move
+        nCorrect = cur+1;
     }
     // now we have free space - insert
-    pos -= p->nStart;
+    pos -= BlockStart( *p );
     assert(pos < MAXENTRY);
     if( pos != p->nElem )
     {
@@ -297,7 +345,10 @@ void BigPtrArray::Insert( BigPtrEntry* pElem, sal_Int32 pos )
     p->nEnd++;
     p->nElem++;
     m_nSize++;
-    if( cur != ( m_nBlock - 1 ) ) UpdIndex( cur );
+    if( bNewBlock )
+        UpdIndex( cur );
+    else if( nCorrect != ( m_nBlock - 1 ) )
+        MoveIndex( nCorrect, 1 );
     m_nCur = cur;
 
     CHECKIDX( m_ppInf.get(), m_nBlock, m_nSize, m_nCur );
@@ -312,8 +363,37 @@ void BigPtrArray::Remove( sal_Int32 pos, sal_Int32 n )
     sal_uInt16 nBlk1 = cur;              // 1st treated block
     sal_uInt16 nBlk1del = USHRT_MAX;     // 1st deleted block
     BlockInfo* p = m_ppInf[ cur ];
-    pos -= p->nStart;
+    pos -= BlockStart( *p );
+
+    // common case: only a part of one block is removed
+    if( pos + n < p->nElem )
+    {
+        sal_uInt16 nel = sal_uInt16(n);
+        auto pTo = p->mvData.begin() + pos;
+        auto pFrom = pTo + nel;
+        int nCount = p->nElem - nel - sal_uInt16(pos);
+        while( nCount-- )
+        {
+            *pTo = *pFrom++;
+            (*pTo)->m_nOffset = (*pTo)->m_nOffset - nel;
+            ++pTo;
+        }
+        p->nEnd -= nel;
+        p->nElem = p->nElem - nel;
+        m_nSize -= n;
+        if( cur != ( m_nBlock - 1 ) )
+            MoveIndex( cur, -n );
+        m_nCur = cur;
+
+        // call Compress() if there is more than 50% space in the array
+        if( m_nBlock > ( m_nSize / ( MAXENTRY / 2 ) ) )
+            Compress();
 
+        CHECKIDX( m_ppInf.get(), m_nBlock, m_nSize, m_nCur );
+        return;
+    }
+
+    ApplyPendingIndex();
     sal_Int32 nElem = n;
     while( nElem )
     {
@@ -392,9 +472,10 @@ void BigPtrArray::Replace( sal_Int32 idx, BigPtrEntry* pElem)
     assert(idx < m_nSize); // Index out of bounds
     m_nCur = Index2Block( idx );
     BlockInfo* p = m_ppInf[ m_nCur ];
-    pElem->m_nOffset = sal_uInt16(idx - p->nStart);
+    sal_Int32 nOffset = idx - BlockStart( *p );
+    pElem->m_nOffset = sal_uInt16(nOffset);
     pElem->m_pBlock = p;
-    p->mvData[ idx - p->nStart ] = pElem;
+    p->mvData[ nOffset ] = pElem;
 }
 
 /** Compress the array */
@@ -402,6 +483,8 @@ sal_uInt16 BigPtrArray::Compress()
 {
     CHECKIDX( m_ppInf.get(), m_nBlock, m_nSize, m_nCur );
 
+    ApplyPendingIndex();
+
     // Iterate over InfoBlock array from beginning to end. If there is a deleted
     // block in between so move all following ones accordingly. The pointer <pp>
     // represents the "old" and <qq> the "new" array.
@@ -185,9 +185,23 @@ lcl_CleanStr(const SwTextNode& rNd,
              std::vector<AmbiguousIndex> &rArr,
              bool const bRemoveSoftHyphen, bool const bRemoveCommentAnchors)
 {
-    OUStringBuffer buf(pLayout ? pFrame->GetText() : rNd.GetText());
+    const OUString& rText(pLayout ? pFrame->GetText() : rNd.GetText());
     rArr.clear();
 
+    // Searching all matches calls this again and again for the rest of the
+    // paragraph, so don't copy the text if there is nothing to filter out.
+    bool bFilter = false;
+    for (sal_Int32 i = nStart.GetAnyIndex(); i < rText.getLength() && !bFilter; ++i)
+    {
+        const sal_Unicode c = rText[i];
+        bFilter = c == CH_TXTATR_BREAKWORD || c == CH_TXTATR_INWORD
+                  || (bRemoveSoftHyphen && c == CHAR_SOFTHYPHEN);
+    }
+    if (!bFilter)
+        return rText;
+
+    OUStringBuffer buf(rText);
+
     MaybeMergedIter iter(pLayout ? pFrame : nullptr, pLayout ? nullptr : &rNd);
 
     AmbiguousIndex nSoftHyphen = nStart;
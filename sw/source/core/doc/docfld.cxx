@@ -838,6 +838,9 @@ void SwDocUpdateField::MakeFieldList_( SwDoc& rDoc, int eGetMode )
 {
     // new version: walk all fields of the attribute pool
     m_pFieldSortList.reset(new SetGetExpFields);
+    // inserting them one by one into the sorted list is quadratic
+    std::vector<std::unique_ptr<SetGetExpField>> aNewFields;
+    m_pNewFields = &aNewFields;
 
     // remember sections that were unhidden and need to be hidden again
     std::vector<std::reference_wrapper<SwSection>> aUnhiddenSections;
@@ -1047,6 +1050,13 @@ void SwDocUpdateField::MakeFieldList_( SwDoc& rDoc, int eGetMode )
             }
         }
     }
+    m_pNewFields = nullptr;
+    // stable, so that of equal positions the first one is kept as by insert()
+    std::stable_sort(aNewFields.begin(), aNewFields.end(),
+                     o3tl::less_uniqueptr_to<SetGetExpField>());
+    for (std::unique_ptr<SetGetExpField>& pNew : aNewFields)
+        m_pFieldSortList->insert( std::move(pNew) );
+
     m_nFieldListGetMode = eGetMode;
     m_nNodes = rDoc.GetNodes().Count();
 
@@ -1117,7 +1127,7 @@ void SwDocUpdateField::GetBodyNode( const SwTextField& rTField, SwFieldIds nFiel
     }
 #endif
     if( pNew != nullptr )
-        m_pFieldSortList->insert( std::move(pNew) );
+        InsertToSortList( std::move(pNew) );
 }
 
 template<typename T>
@@ -1163,7 +1173,15 @@ void SwDocUpdateField::GetBodyNodeGeneric(SwNode const& rNode, T const& rCond)
         pNew.reset(new SetGetExpField(rCond, nullptr, pFrame ? pFrame->GetPhyPageNum() : 0));
     }
 
-    m_pFieldSortList->insert( std::move(pNew) );
+    InsertToSortList( std::move(pNew) );
+}
+
+void SwDocUpdateField::InsertToSortList( std::unique_ptr<SetGetExpField> pNew )
+{
+    if( m_pNewFields )
+        m_pNewFields->push_back( std::move(pNew) );
+    else
+        m_pFieldSortList->insert( std::move(pNew) );
 }
 
 void SwDocUpdateField::InsertFieldType( const SwFieldType& rType )
@@ -1241,6 +1259,7 @@ void SwDocUpdateField::RemoveFieldType( const SwFieldType& rType )
 
 SwDocUpdateField::SwDocUpdateField(SwDoc& rDoc)
     : m_FieldTypeTable(TBLSZ)
+    , m_pNewFields(nullptr)
     , m_nNodes(0)
     , m_nFieldListGetMode(0)
     , m_rDoc(rDoc)
@@ -444,12 +444,15 @@ void SwRedlineTable::CheckOverlapping(vector_type::const_iterator it)
         return;
     if (maVector.size() <= 1) // a single element cannot be overlapping
         return;
+    // The binary search of DocumentRedlineManager::GetRedlinePos() only needs
+    // the end nodes to be sorted like the starts; several redlines in one
+    // paragraph, as in every reviewed document, are fine.
     auto pCurr = *it;
     auto itNext = it + 1;
     if (itNext != maVector.end())
     {
         auto pNext = *itNext;
-        if (pCurr->End()->GetNodeIndex() >= pNext->Start()->GetNodeIndex())
+        if (pCurr->End()->GetNodeIndex() > pNext->End()->GetNodeIndex())
         {
             m_bHasOverlappingElements = true;
             return;
@@ -458,7 +461,7 @@ void SwRedlineTable::CheckOverlapping(vector_type::const_iterator it)
     if (it != maVector.begin())
     {
         auto pPrev = *(it - 1);
-        if (pPrev->End()->GetNodeIndex() >= pCurr->Start()->GetNodeIndex())
+        if (pPrev->End()->GetNodeIndex() > pCurr->End()->GetNodeIndex())
             m_bHasOverlappingElements = true;
     }
 }
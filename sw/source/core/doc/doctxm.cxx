@@ -70,7 +70,9 @@
 #include <o3tl/safeint.hxx>
 #include <osl/diagnose.h>
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 
 using namespace ::com::sun::star;
 
@@ -1673,6 +1675,9 @@ void SwTOXBaseSection::UpdatePageNum()
     SwPageFrame*  pCurrentPage    = nullptr;
     sal_uInt16      nPage       = 0;
     SwDoc* pDoc = GetFormat()->GetDoc();
+    // The sources of an index are spread over the pages in no order, and with
+    // page number offsets GetVirtPageNum() searches all page descriptor items.
+    std::unordered_map<const SwPageFrame*, sal_uInt16> aVirtPageNums;
 
     SwTOXInternational aIntl( GetLanguage(),
                               TOX_INDEX == GetTOXType()->GetType() ?
@@ -1739,19 +1744,24 @@ void SwTOXBaseSection::UpdatePageNum()
                     SwPageFrame*  pTmpPage = pFrame->FindPageFrame();
                     if( pTmpPage != pCurrentPage )
                     {
-                        nPage       = pTmpPage->GetVirtPageNum();
+                        auto const aIt = aVirtPageNums.find(pTmpPage);
+                        if (aIt != aVirtPageNums.end())
+                            nPage = aIt->second;
+                        else
+                        {
+                            nPage = pTmpPage->GetVirtPageNum();
+                            aVirtPageNums.emplace(pTmpPage, nPage);
+                        }
                         pCurrentPage    = pTmpPage;
                     }
 
                     // Insert as sorted
-                    std::vector<sal_uInt16>::size_type i;
-                    for( i = 0; i < aNums.size() && aNums[i] < nPage; ++i )
-                        ;
-
-                    if( i >= aNums.size() || aNums[ i ] != nPage )
+                    auto const aNumIt = std::lower_bound(aNums.begin(), aNums.end(), nPage);
+                    if( aNumIt == aNums.end() || *aNumIt != nPage )
                     {
-                        aNums.insert(aNums.begin() + i, nPage);
-                        aDescs.insert(aDescs.begin() + i, pCurrentPage->GetPageDesc() );
+                        aDescs.insert(aDescs.begin() + (aNumIt - aNums.begin()),
+                                      pCurrentPage->GetPageDesc() );
+                        aNums.insert(aNumIt, nPage);
                     }
                     // is it a main entry?
                     if(TOX_SORT_INDEX == pSortBase->GetType() &&
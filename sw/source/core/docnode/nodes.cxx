@@ -2360,7 +2360,7 @@ void SwNodes::ForEach( SwNodeOffset nStart, SwNodeOffset nEnd,
     sal_uInt16 cur = Index2Block( sal_Int32(nStart) );
     BlockInfo** pp = m_ppInf.get() + cur;
     BlockInfo* p = *pp;
-    sal_uInt16 nElem = sal_uInt16( sal_Int32(nStart) - p->nStart );
+    sal_uInt16 nElem = sal_uInt16( sal_Int32(nStart) - BlockStart( *p ) );
     auto pElem = p->mvData.begin() + nElem;
     nElem = p->nElem - nElem;
     for(;;)
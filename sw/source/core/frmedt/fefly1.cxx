@@ -28,6 +28,7 @@
 #include <sot/exchange.hxx>
 #include <com/sun/star/form/FormButtonType.hpp>
 #include <com/sun/star/beans/XPropertySet.hpp>
+#include <com/sun/star/embed/EmbedStates.hpp>
 #include <com/sun/star/embed/XEmbeddedObject.hpp>
 #include <comphelper/types.hxx>
 #include <osl/diagnose.h>
@@ -2066,6 +2067,7 @@ void SwFEShell::AlignFormulaToBaseline( const uno::Reference < embed::XEmbeddedO
 
     // get baseline from Math object
     uno::Any aBaseline;
+    const bool bWasLoaded = xObj->getCurrentState() == embed::EmbedStates::LOADED;
     if( svt::EmbeddedObjectRef::TryRunningState( xObj ) )
     {
         uno::Reference < beans::XPropertySet > xSet( xObj->getComponent(), uno::UNO_QUERY );
@@ -2080,6 +2082,19 @@ void SwFEShell::AlignFormulaToBaseline( const uno::Reference < embed::XEmbeddedO
                 OSL_FAIL( "Baseline could not be retrieved from Starmath!" );
             }
         }
+
+        // Don't keep the formula running just for its baseline, e.g. when
+        // aligning all formulas of a document.
+        if ( bWasLoaded )
+        {
+            try
+            {
+                xObj->changeState( embed::EmbedStates::LOADED );
+            }
+            catch ( uno::Exception& )
+            {
+            }
+        }
     }
 
     sal_Int32 nBaseline = ::comphelper::getINT32(aBaseline);
@@ -144,6 +144,8 @@ const int GETFLD_EXPAND     = 2;
 class SwDocUpdateField
 {
     std::unique_ptr<SetGetExpFields> m_pFieldSortList; ///< current field list for calculation
+    /// while the list is rebuilt the fields are collected here and sorted once
+    std::vector<std::unique_ptr<SetGetExpField>>* m_pNewFields;
     SwHashTable<SwCalcFieldType> m_FieldTypeTable;
 
     SwNodeOffset m_nNodes; ///< to check if the node count changed
@@ -157,6 +159,7 @@ class SwDocUpdateField
     void GetBodyNode( const SwTextField& , SwFieldIds nFieldWhich );
     template<typename T>
     void GetBodyNodeGeneric(SwNode const& rNode, T const&);
+    void InsertToSortList( std::unique_ptr<SetGetExpField> pNew );
 
 public:
     SwDocUpdateField(SwDoc& rDocument);
@@ -65,6 +65,7 @@
 #include <objectformatter.hxx>
 #include <fntcache.hxx>
 #include <fmtanchr.hxx>
+#include <comphelper/profilezone.hxx>
 #include <comphelper/scopeguard.hxx>
 #include <vector>
 #include <comphelper/diagnose_ex.hxx>
@@ -362,6 +363,7 @@ void SwLayAction::PopFormatLayout()
 
 void SwLayAction::Action(OutputDevice* pRenderContext)
 {
+    comphelper::ProfileZone aZone(IsCalcLayout() ? "SwLayAction::Action calc" : "SwLayAction::Action");
     m_bActionInProgress = true;
 
     //TurboMode? Hands-off during idle-format
@@ -4433,6 +4433,11 @@ static SwTwips lcl_calcHeightOfRowBeforeThisFrame(const SwRowFrame& rRow)
     const SwTabFrame* pTab = rRow.FindTabFrame();
     if (!pLine || !pTab || !pTab->IsFollow())
         return 0;
+    // Only the first non-headline row of a follow can continue a row split in
+    // the master. Don't iterate over all the rows sharing the line format for
+    // the others, that format may be shared by all the rows of a long table.
+    if (pTab->GetFirstNonHeadlineRow() != &rRow)
+        return 0;
     SwTwips nResult = 0;
     SwIterator<SwRowFrame, SwFormat> aIter(*pLine->GetFrameFormat());
     for (const SwRowFrame* pCurRow = aIter.First(); pCurRow; pCurRow = aIter.Next())
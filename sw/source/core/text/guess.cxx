@@ -163,6 +163,9 @@ bool SwTextGuess::Guess( const SwTextPortion& rPor, SwTextFormatInfo &rInf,
     const bool bUnbreakableNumberings = rInf.GetTextFrame()->GetDoc()
         .getIDocumentSettingAccess().get(DocumentSettingId::UNBREAKABLE_NUMBERINGS);
 
+    // m_nBreakWidth and nMaxSizeDiff hold the size of the whole portion
+    bool bMaxLenMeasured = false;
+
     // first check if everything fits to line
     if ( ( nLineWidth * 2 > SwTwips(sal_Int32(nMaxLen)) * nPorHeight ) ||
          ( bUnbreakableNumberings && rPor.IsNumberPortion() ) )
@@ -170,6 +173,7 @@ bool SwTextGuess::Guess( const SwTextPortion& rPor, SwTextFormatInfo &rInf,
         // call GetTextSize with maximum compression (for kanas)
         rInf.GetTextSize( &rSI, rInf.GetIdx(), nMaxLen,
                          nMaxComp, m_nBreakWidth, nMaxSizeDiff );
+        bMaxLenMeasured = true;
 
         if ( ( m_nBreakWidth <= nLineWidth ) || ( bUnbreakableNumberings && rPor.IsNumberPortion() ) )
         {
@@ -308,9 +312,11 @@ bool SwTextGuess::Guess( const SwTextPortion& rPor, SwTextFormatInfo &rInf,
 #if OSL_DEBUG_LEVEL > 1
         if ( TextFrameIndex(COMPLETE_STRING) != m_nCutPos )
         {
+            // don't touch nMaxSizeDiff, it is reused below if bMaxLenMeasured
             sal_uInt16 nMinSize;
+            sal_uInt16 nMinSizeDiff;
             rInf.GetTextSize( &rSI, rInf.GetIdx(), m_nCutPos - rInf.GetIdx(),
-                             nMaxComp, nMinSize, nMaxSizeDiff );
+                             nMaxComp, nMinSize, nMinSizeDiff );
             OSL_ENSURE( nMinSize <= nLineWidth, "What a Guess!!!" );
         }
 #endif
@@ -320,8 +326,9 @@ bool SwTextGuess::Guess( const SwTextPortion& rPor, SwTextFormatInfo &rInf,
     {
         // second check if everything fits to line
         m_nCutPos = m_nBreakPos = rInf.GetIdx() + nMaxLen - TextFrameIndex(1);
-        rInf.GetTextSize( &rSI, rInf.GetIdx(), nMaxLen, nMaxComp,
-                         m_nBreakWidth, nMaxSizeDiff );
+        if ( !bMaxLenMeasured )
+            rInf.GetTextSize( &rSI, rInf.GetIdx(), nMaxLen, nMaxComp,
+                             m_nBreakWidth, nMaxSizeDiff );
 
         // The following comparison should always give true, otherwise
         // there likely has been a pixel rounding error in GetTextBreak
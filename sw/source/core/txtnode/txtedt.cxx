@@ -2064,6 +2064,17 @@ bool SwTextNode::CountWords( SwDocStat& rStat,
     {   // not counting hidden paras
         return false;
     }
+    // Shortcut when counting a whole non-empty paragraph with a clean count:
+    // the cached values include the numbering, no need to create its string
+    if ( bCountAll && nEnd > 0 && !IsWordCountDirty() )
+    {
+        ++rStat.nPara;
+        rStat.nWord += m_aParagraphIdleData.nNumberOfWords;
+        rStat.nAsianWord += m_aParagraphIdleData.nNumberOfAsianWords;
+        rStat.nChar += m_aParagraphIdleData.nNumberOfChars;
+        rStat.nCharExcludingSpaces += m_aParagraphIdleData.nNumberOfCharsExcludingSpaces;
+        return false;
+    }
     // count words in numbering string if started at beginning of para:
     bool bCountNumbering = nStt == 0;
     bool bHasBullet = false, bHasNumbering = false;
@@ -77,6 +77,7 @@
 #include <svx/sdrpagewindow.hxx>
 #include <svx/svdpagv.hxx>
 #include <comphelper/lok.hxx>
+#include <comphelper/profilezone.hxx>
 #include <sfx2/lokhelper.hxx>
 #include <tools/UnitConversion.hxx>
 
@@ -1073,6 +1074,7 @@ void SwViewShell::CalcLayout()
     // (except the Page Preview apparently only has a non-subclassed ViewShell)
     assert((typeid(*this) == typeid(SwViewShell)) || mnStartAction);
 
+    comphelper::ProfileZone aZone("SwViewShell::CalcLayout");
     CurrShell aCurr( this );
     SwWait aWait( *GetDoc()->GetDocShell(), true );
 
@@ -1706,8 +1708,12 @@ bool SwViewShell::CheckInvalidForPaint( const SwRect &rRect )
         return false;
 
     const SwPageFrame *pPage = Imp()->GetFirstVisPage(GetOut());
-    const SwTwips nBottom = VisArea().Bottom();
-    const SwTwips nRight  = VisArea().Right();
+    // With tiled rendering the visible area is the whole document: only the
+    // pages up to the tile matter, invalid pages after it must not trigger
+    // a layout action for painting it.
+    const SwRect &rCheck = comphelper::LibreOfficeKit::isTiledPainting() ? rRect : VisArea();
+    const SwTwips nBottom = rCheck.Bottom();
+    const SwTwips nRight  = rCheck.Right();
     bool bRet = false;
     while ( !bRet && pPage && ((pPage->getFrameArea().Top() <= nBottom) &&
                                 (pPage->getFrameArea().Left() <= nRight)))
@@ -1846,6 +1852,7 @@ public:
 
 void SwViewShell::Paint(vcl::RenderContext& rRenderContext, const tools::Rectangle &rRect)
 {
+    comphelper::ProfileZone aZone("SwViewShell::Paint");
     RenderContextGuard aGuard(mpOut, &rRenderContext, this);
     if ( mnLockPaint )
     {
@@ -1980,6 +1987,7 @@ void SwViewShell::Paint(vcl::RenderContext& rRenderContext, const tools::Rectang
 
 void SwViewShell::PaintTile(VirtualDevice &rDevice, int contextWidth, int contextHeight, int tilePosX, int tilePosY, tools::Long tileWidth, tools::Long tileHeight)
 {
+    comphelper::ProfileZone aZone("SwViewShell::PaintTile");
     // SwViewShell's output device setup
     // TODO clean up SwViewShell's approach to output devices (the many of
     // them - mpBufferedOut, mpOut, mpWin, ...)
@@ -2753,6 +2753,13 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
 
     std::vector<std::unique_ptr<HTMLAttr>> aFields;
 
+    // Attributes in body nodes array section shouldn't be set if we are in a
+    // special nodes array section, but vice versa it's possible.
+    const SwNodeOffset nEndOfIcons = m_xDoc->GetNodes().GetEndOfExtras().GetIndex();
+    // the attributes set are only removed from m_aSetAttrTab at the end, to
+    // not shift its remaining entries for each of them
+    bool bAttrsSet = false;
+
     for( auto n = m_aSetAttrTab.size(); n; )
     {
         pAttr = m_aSetAttrTab[ --n ];
@@ -2780,9 +2787,6 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
         }
         else
         {
-            // Attributes in body nodes array section shouldn't be set if we are in a
-            // special nodes array section, but vice versa it's possible.
-            SwNodeOffset nEndOfIcons = m_xDoc->GetNodes().GetEndOfExtras().GetIndex();
             bSetAttr = nEndParaIdx < rEndPos.GetNodeIndex() ||
                        rEndPos.GetNodeIndex() > nEndOfIcons ||
                        nEndParaIdx <= nEndOfIcons;
@@ -2800,7 +2804,8 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
             }
 
             // then set it
-            m_aSetAttrTab.erase( m_aSetAttrTab.begin() + n );
+            m_aSetAttrTab[ n ] = nullptr;
+            bAttrsSet = true;
 
             while( pAttr )
             {
@@ -3001,6 +3006,9 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
             }
         }
     }
+    if( bAttrsSet )
+        m_aSetAttrTab.erase( std::remove( m_aSetAttrTab.begin(), m_aSetAttrTab.end(), nullptr ),
+                             m_aSetAttrTab.end() );
 
     for( auto n = m_aMoveFlyFrames.size(); n; )
     {
@@ -3026,7 +3034,6 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
         }
         else
         {
-            SwNodeOffset nEndOfIcons = m_xDoc->GetNodes().GetEndOfExtras().GetIndex();
             bMoveFly = nFlyParaIdx < rEndPos.GetNodeIndex() ||
                        rEndPos.GetNodeIndex() > nEndOfIcons ||
                        nFlyParaIdx <= nEndOfIcons;
@@ -3044,20 +3044,6 @@ void WW8PLCFx::SetIdx2(sal_uInt32)
 {
 }
 
-namespace {
-
-class SamePos
-{
-private:
-    tools::Long mnPo;
-public:
-    explicit SamePos(tools::Long nPo) : mnPo(nPo) {}
-    bool operator()(const std::unique_ptr<WW8PLCFx_Fc_FKP::WW8Fkp>& pFkp)
-        {return mnPo == pFkp->GetFilePos();}
-};
-
-}
-
 bool WW8PLCFx_Fc_FKP::NewFkp()
 {
     WW8_CP nPLCFStart, nPLCFEnd;
@@ -3110,11 +3096,10 @@ bool WW8PLCFx_Fc_FKP::NewFkp()
         m_pFkp->Reset(GetStartFc());
     else
     {
-        auto aIter =
-            std::find_if(maFkpCache.begin(), maFkpCache.end(), SamePos(nPo));
-        if (aIter != maFkpCache.end())
+        auto aIter = maFkpCachePos.find(nPo);
+        if (aIter != maFkpCachePos.end())
         {
-            m_pFkp = aIter->get();
+            m_pFkp = aIter->second;
             m_pFkp->Reset(GetStartFc());
         }
         else
@@ -3122,12 +3107,14 @@ bool WW8PLCFx_Fc_FKP::NewFkp()
             m_pFkp = new WW8Fkp(GetFIB(), m_pFKPStrm, m_pDataStrm, nPo,
                 pFkpSizeTab[ m_ePLCF ], m_ePLCF, GetStartFc());
             maFkpCache.push_back(std::unique_ptr<WW8Fkp>(m_pFkp));
+            maFkpCachePos.emplace(nPo, m_pFkp);
 
             if (maFkpCache.size() > eMaxCache)
             {
                 WW8Fkp* pCachedFkp = maFkpCache.front().get();
                 if (!pCachedFkp->IsMustRemainCache())
                 {
+                    maFkpCachePos.erase(pCachedFkp->GetFilePos());
                     maFkpCache.pop_front();
                 }
             }
@@ -3159,6 +3146,7 @@ WW8PLCFx_Fc_FKP::WW8PLCFx_Fc_FKP(SvStream* pSt, SvStream* pTableSt,
 
 WW8PLCFx_Fc_FKP::~WW8PLCFx_Fc_FKP()
 {
+    maFkpCachePos.clear();
     maFkpCache.clear();
     m_pPLCF.reset();
     m_pPCDAttrs.reset();
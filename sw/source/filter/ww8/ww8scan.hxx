@@ -601,6 +601,8 @@ private:
         == 5      : 18515 pap, 47 chp
     */
     std::deque<std::unique_ptr<WW8Fkp>> maFkpCache;
+    /// The entries of maFkpCache by their file position, to not search the cache linearly
+    std::unordered_map<tools::Long, WW8Fkp*> maFkpCachePos;
     enum Limits {eMaxCache = 50000};
 
     bool NewFkp();
@@ -1285,6 +1285,23 @@ bool SwDBManager::MergeMailFiles(SwWrtShell* pSourceShell,
         // to collect temporary email files
         std::vector< OUString> aFilesToRemove;
 
+        // The parts of the temporary file names not taken from the data source
+        // are the same for all records
+        OUString sTempFilePrefix = sDescriptorPrefix;
+        OUString sTempFileLeading;
+        OUString sTempFileExt;
+        if( bNeedsTempFiles )
+        {
+            if( !bColumnName || bMT_EMAIL )
+            {
+                INetURLObject aEntry( sTempFilePrefix );
+                sTempFileLeading = aEntry.GetBase();
+                aEntry.removeSegment();
+                sTempFilePrefix = aEntry.GetMainURL( INetURLObject::DecodeMechanism::NONE );
+            }
+            sTempFileExt = comphelper::string::stripStart(pStoreToFilter->GetDefaultExtension(), '*');
+        }
+
         // The SfxObjectShell will be closed explicitly later but
         // it is more safe to use SfxObjectShellLock here
         SfxObjectShellLock xWorkDocSh;
@@ -1310,8 +1327,7 @@ bool SwDBManager::MergeMailFiles(SwWrtShell* pSourceShell,
             // create a new temporary file name - only done once in case of bCreateSingleFile
             if( bNeedsTempFiles && ( !bWorkDocInitialized || !bCreateSingleFile ))
             {
-                OUString sPrefix = sDescriptorPrefix;
-                OUString sLeading;
+                OUString sLeading = sTempFileLeading;
 
                 //#i97667# if the name is from a database field then it will be used _as is_
                 if( bColumnName && !bMT_EMAIL )
@@ -1321,16 +1337,8 @@ bool SwDBManager::MergeMailFiles(SwWrtShell* pSourceShell,
                     else
                         sLeading = "_";
                 }
-                else
-                {
-                    INetURLObject aEntry( sPrefix );
-                    sLeading = aEntry.GetBase();
-                    aEntry.removeSegment();
-                    sPrefix = aEntry.GetMainURL( INetURLObject::DecodeMechanism::NONE );
-                }
 
-                OUString sExt(comphelper::string::stripStart(pStoreToFilter->GetDefaultExtension(), '*'));
-                aTempFile.reset( new utl::TempFileNamed(sLeading, sColumnData.isEmpty(), sExt, &sPrefix, true) );
+                aTempFile.reset( new utl::TempFileNamed(sLeading, sColumnData.isEmpty(), sTempFileExt, &sTempFilePrefix, true) );
                 if( !aTempFile->IsValid() )
                 {
                     ErrorHandler::HandleError( ERRCODE_IO_NOTSUPPORTED );
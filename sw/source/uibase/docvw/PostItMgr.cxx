@@ -80,6 +80,7 @@
 #include <annotsh.hxx>
 #include <swabstdlg.hxx>
 #include <memory>
+#include <unordered_set>
 
 // distance between Anchor Y and initial note position
 #define POSTIT_INITIAL_ANCHOR_DISTANCE      20
@@ -1326,8 +1327,25 @@ void SwPostItMgr::AddPostIts(const bool bCheckExistence, const bool bFocus)
     SwFieldType* pType = mpView->GetDocShell()->GetDoc()->getIDocumentFieldsAccess().GetFieldType(SwFieldIds::Postit, OUString(),false);
     std::vector<SwFormatField*> vFormatFields;
     pType->CollectPostIts(vFormatFields, rIDRA, mpWrtShell->GetLayout()->IsHideRedlines());
-    for(auto pFormatField : vFormatFields)
-        InsertItem(pFormatField, bCheckExistence, bFocus);
+    if (bCheckExistence && !bEmpty)
+    {
+        // check for the existing items once, not by searching all of them for
+        // each field
+        std::unordered_set<const SfxBroadcaster*> aExisting;
+        aExisting.reserve(mvPostItFields.size() + vFormatFields.size());
+        for (auto const& postItField : mvPostItFields)
+            aExisting.insert(postItField->GetBroadcaster());
+        for(auto pFormatField : vFormatFields)
+        {
+            if (aExisting.insert(pFormatField).second)
+                InsertItem(pFormatField, false, bFocus);
+        }
+    }
+    else
+    {
+        for(auto pFormatField : vFormatFields)
+            InsertItem(pFormatField, bCheckExistence, bFocus);
+    }
     // if we just added the first one we have to update the view for centering
     if (bEmpty && !mvPostItFields.empty())
         PrepareView(true);
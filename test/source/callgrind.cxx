@@ -9,6 +9,15 @@
 
 #include <test/callgrind.hxx>
 
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#ifdef UNX
+#include <sys/resource.h>
+#endif
+
 #ifdef HAVE_VALGRIND_HEADERS
 #include <valgrind/callgrind.h>
 #else
@@ -18,16 +27,55 @@
 #define CALLGRIND_DUMP_STATS_AT(name) (void)name;
 #endif
 
+namespace
+{
+// Instruction counts tell nothing about threading or memory bandwidth, so
+// the measured sections can also report their wall and CPU time, when
+// PERF_TIMINGS is set, as tab separated lines of name, wall time in ms,
+// CPU time of the process in ms and peak RSS in kB on stderr.
+std::chrono::steady_clock::time_point g_aWallStart;
+std::clock_t g_nCpuStart = 0;
+
+bool isTimingEnabled()
+{
+    static const bool bEnabled = std::getenv("PERF_TIMINGS") != nullptr;
+    return bEnabled;
+}
+
+long getPeakRSS()
+{
+#ifdef UNX
+    struct rusage aUsage;
+    if (getrusage(RUSAGE_SELF, &aUsage) == 0)
+        return aUsage.ru_maxrss;
+#endif
+    return -1;
+}
+}
+
 void callgrindStart()
 {
     CALLGRIND_ZERO_STATS;
     CALLGRIND_START_INSTRUMENTATION;
+    if (isTimingEnabled())
+    {
+        g_nCpuStart = std::clock();
+        g_aWallStart = std::chrono::steady_clock::now();
+    }
 };
 
 void callgrindDump(const char* name)
 {
     CALLGRIND_STOP_INSTRUMENTATION;
     CALLGRIND_DUMP_STATS_AT(name);
+    if (isTimingEnabled())
+    {
+        const auto aWall = std::chrono::steady_clock::now() - g_aWallStart;
+        const double fCpuMs = 1000.0 * (std::clock() - g_nCpuStart) / CLOCKS_PER_SEC;
+        std::fprintf(
+            stderr, "%s\t%.3f\t%.3f\t%ld\n", name,
+            std::chrono::duration<double, std::milli>(aWall).count(), fCpuMs, getPeakRSS());
+    }
 };
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -2498,25 +2498,10 @@ TaskManager::getv(
 
     aUnqPath = aFileStatus.getFileURL();
 
-    // If the directory item type is a link retrieve the type of the target
-
-    if ( aFileStatus.getFileType() == osl::FileStatus::Link )
-    {
-        // Assume failure
-        aIsRegular = false;
-        osl::DirectoryItem aTargetItem;
-        (void)osl::DirectoryItem::get( aFileStatus.getLinkTargetURL(), aTargetItem );
-        if ( aTargetItem.is() )
-        {
-            osl::FileStatus aTargetStatus( osl_FileStatus_Mask_Type );
-
-            if ( osl::FileBase::E_None == aTargetItem.getFileStatus( aTargetStatus ) )
-                aIsRegular =
-                    aTargetStatus.getFileType() == osl::FileStatus::Regular;
-        }
-    }
-    else
-        aIsRegular = aFileStatus.getFileType() == osl::FileStatus::Regular;
+    // If the directory item type is a link, the type of the target is
+    // retrieved by commit() below
+    const bool bIsLink = aFileStatus.getFileType() == osl::FileStatus::Link;
+    aIsRegular = aFileStatus.getFileType() == osl::FileStatus::Regular;
 
     {
         std::unique_lock aGuard( m_aMutex );
@@ -2528,6 +2513,15 @@ TaskManager::getv(
 
         PropertySet& propset = it->second.properties;
 
+        if( bIsLink )
+        {
+            // Don't stat the link target again, commit() has just done that
+            // to determine IsDocument
+            auto it1 = propset.find( MyProperty( IsDocument ) );
+            if( it1 != propset.end() )
+                it1->getValue() >>= aIsRegular;
+        }
+
         std::transform(properties.begin(), properties.end(), seq.getArray(),
             [&propset](const beans::Property& rProp) -> uno::Any {
                 MyProperty readProp( rProp.Name );
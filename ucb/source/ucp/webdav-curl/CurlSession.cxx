@@ -278,6 +278,7 @@ namespace http_dav_ucp
 {
 // libcurl callbacks:
 
+#if defined SAL_LOG_INFO
 static int debug_callback(CURL* handle, curl_infotype type, char* data, size_t size,
                           void* /*userdata*/)
 {
@@ -327,6 +328,7 @@ static int debug_callback(CURL* handle, curl_infotype type, char* data, size_t s
     SAL_INFO("ucb.ucp.webdav.curl", "debug log: " << handle << ": " << pType << " " << size);
     return 0;
 }
+#endif
 
 static size_t write_callback(char* const ptr, size_t const size, size_t const nmemb,
                              void* const userdata)
@@ -639,13 +641,14 @@ CurlSession::CurlSession(uno::Reference<uno::XComponentContext> xContext,
     // this supposedly gives the highest quality error reporting
     rc = curl_easy_setopt(m_pCurl.get(), CURLOPT_ERRORBUFFER, m_ErrorBuffer);
     assert(rc == CURLE_OK);
-#if 1
-    // just for debugging...
+#if defined SAL_LOG_INFO
+    // just for debugging; without logging there is no point in having curl
+    // call back for every header and every chunk of data transferred
     rc = curl_easy_setopt(m_pCurl.get(), CURLOPT_DEBUGFUNCTION, debug_callback);
     assert(rc == CURLE_OK);
-#endif
     rc = curl_easy_setopt(m_pCurl.get(), CURLOPT_VERBOSE, 1L);
     assert(rc == CURLE_OK);
+#endif
     // accept any encoding supported by libcurl
     rc = curl_easy_setopt(m_pCurl.get(), CURLOPT_ACCEPT_ENCODING, "");
     if (rc != CURLE_OK)
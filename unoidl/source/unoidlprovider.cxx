@@ -512,21 +512,23 @@ sal_uInt32 findInMap(
     sal_uInt32 mapSize, OUString const & name, sal_Int32 nameOffset,
     sal_Int32 nameLength)
 {
-    if (mapSize == 0) {
-        return 0;
-    }
-    sal_uInt32 n = mapSize / 2;
-    MapEntry const * p = mapBegin + n;
-    switch (compare(file, name, nameOffset, nameLength, p)) {
-    case COMPARE_LESS:
-        return findInMap(file, mapBegin, n, name, nameOffset, nameLength);
-    case COMPARE_GREATER:
-        return findInMap(
-            file, p + 1, mapSize - n - 1, name, nameOffset, nameLength);
-    default: // COMPARE_EQUAL
-        break;
+    for (;;) {
+        if (mapSize == 0) {
+            return 0;
+        }
+        sal_uInt32 n = mapSize / 2;
+        MapEntry const * p = mapBegin + n;
+        Compare c = compare(file, name, nameOffset, nameLength, p);
+        if (c == COMPARE_LESS) {
+            mapSize = n;
+        } else if (c == COMPARE_GREATER) {
+            mapBegin = p + 1;
+            mapSize -= n + 1;
+        } else { // COMPARE_EQUAL
+            break;
+        }
     }
-    sal_uInt32 off = mapBegin[n].data.getUnsigned32();
+    sal_uInt32 off = mapBegin[mapSize / 2].data.getUnsigned32();
     if (off == 0) {
         throw FileFormatException(
             file->uri, "UNOIDL format: map entry data offset is null");
@@ -1388,7 +1390,7 @@ rtl::Reference< Entity > UnoidlProvider::findEntity(OUString const & name) const
         if (j == name.getLength()) {
             return cgroup
                 ? rtl::Reference< Entity >()
-                : readEntity(file_, off, std::set(map.trace));
+                : readEntity(file_, off, std::move(map.trace));
         }
         if (cgroup) {
             return rtl::Reference< Entity >();
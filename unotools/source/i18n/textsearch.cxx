@@ -19,8 +19,10 @@
 
 #include <sal/config.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <string_view>
+#include <vector>
 
 #include <i18nlangtag/languagetag.hxx>
 #include <i18nutil/searchopt.hxx>
@@ -90,12 +92,22 @@ static bool lcl_Equals( const i18nutil::SearchOptions2& rSO1, const i18nutil::Se
 
 namespace
 {
-    struct CachedTextSearch
+    struct CachedTextSearchEntry
     {
-        std::mutex mutex;
         i18nutil::SearchOptions2 Options;
         css::uno::Reference< css::util::XTextSearch2 > xTextSearch;
     };
+
+    // Keep a few compiled searches, e.g. COUNTIFS with several wildcard
+    // criteria alternates between patterns for each cell.
+    constexpr size_t nMaxCachedTextSearches = 8;
+
+    struct CachedTextSearch
+    {
+        std::mutex mutex;
+        // Most recently used first.
+        std::vector<CachedTextSearchEntry> aEntries;
+    };
 }
 
 Reference<XTextSearch2> TextSearch::getXTextSearch( const i18nutil::SearchOptions2& rPara )
@@ -104,15 +116,24 @@ Reference<XTextSearch2> TextSearch::getXTextSearch( const i18nutil::SearchOption
 
     std::scoped_lock aGuard(theCachedTextSearch.mutex);
 
-    if ( lcl_Equals(theCachedTextSearch.Options, rPara) )
-        return theCachedTextSearch.xTextSearch;
+    std::vector<CachedTextSearchEntry>& rEntries = theCachedTextSearch.aEntries;
+    auto it = std::find_if(rEntries.begin(), rEntries.end(),
+            [&rPara](const CachedTextSearchEntry& rEntry) { return lcl_Equals(rEntry.Options, rPara); });
+    if (it != rEntries.end())
+    {
+        std::rotate(rEntries.begin(), it, it + 1);
+        return rEntries.front().xTextSearch;
+    }
 
     Reference< XComponentContext > xContext = ::comphelper::getProcessComponentContext();
-    theCachedTextSearch.xTextSearch.set( ::TextSearch2::create(xContext) );
-    theCachedTextSearch.xTextSearch->setOptions2( rPara.toUnoSearchOptions2() );
-    theCachedTextSearch.Options = rPara;
+    Reference< XTextSearch2 > xTextSearch( ::TextSearch2::create(xContext) );
+    xTextSearch->setOptions2( rPara.toUnoSearchOptions2() );
+
+    if (rEntries.size() >= nMaxCachedTextSearches)
+        rEntries.pop_back();
+    rEntries.insert(rEntries.begin(), { rPara, xTextSearch });
 
-    return theCachedTextSearch.xTextSearch;
+    return xTextSearch;
 }
 
 TextSearch::TextSearch(const SearchParam & rParam, LanguageType eLang )
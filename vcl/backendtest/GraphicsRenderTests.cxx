@@ -2485,7 +2485,10 @@ void GraphicsRenderTests::runALLTests()
 void GraphicsRenderTests::appendTestResult(OUString aTestName, OUString aTestStatus,
                                            Bitmap aTestBitmap)
 {
-    m_aTestResult.push_back(VclTestResult(aTestName, aTestStatus, aTestBitmap));
+    const auto aNow = std::chrono::steady_clock::now();
+    m_aTestResult.push_back(
+        VclTestResult(aTestName, aTestStatus, aTestBitmap, aNow - m_aLastResultTime));
+    m_aLastResultTime = aNow;
 }
 
 std::vector<VclTestResult>& GraphicsRenderTests::getTestResults() { return m_aTestResult; }
@@ -2546,6 +2549,7 @@ void GraphicsRenderTests::run(bool storeResultBitmap)
     {
         m_aUserInstallPath += "/user/";
     }
+    m_aLastResultTime = std::chrono::steady_clock::now();
     runALLTests();
     //Storing the test's results in the main user installation directory.
     SvFileStream logFile(m_aUserInstallPath + "GraphicsRenderTests.log",
@@ -2589,7 +2593,18 @@ void GraphicsRenderTests::run(bool storeResultBitmap)
     }
     else
     {
-        writeResult += "No test was Skipped.";
+        writeResult += "No test was Skipped.\n";
+    }
+    // Tab separated, so that the timings of different backends can be compared.
+    writeResult += "\n---Time of the tests in microseconds---\n";
+    for (const VclTestResult& test : m_aTestResult)
+    {
+        writeResult
+            += test.getTestName() + "\t"
+               + OUString::number(
+                   std::chrono::duration_cast<std::chrono::microseconds>(test.getDuration())
+                       .count())
+               + "\n";
     }
     logFile.WriteOString(OUStringToOString(writeResult, RTL_TEXTENCODING_UTF8));
 }
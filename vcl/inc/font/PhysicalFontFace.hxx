@@ -36,6 +36,8 @@
 #include <hb.h>
 #include <hb-ot.h>
 
+#include <memory>
+
 class LogicalFontInstance;
 struct FontMatchStatus;
 namespace vcl::font
@@ -45,6 +47,7 @@ class FontSelectPattern;
 
 namespace vcl
 {
+class AbstractTrueTypeFont;
 class PhysicalFontFamily;
 }
 
@@ -204,6 +207,8 @@ protected:
     mutable std::optional<vcl::FontCapabilities> mxFontCapabilities;
     mutable std::optional<std::vector<ColorPalette>> mxColorPalettes;
     mutable std::optional<std::vector<hb_variation_t>> mxVariations;
+    // the font as parsed for subsetting, kept for the next subsets
+    mutable std::unique_ptr<AbstractTrueTypeFont> mpSftFont;
 
     explicit PhysicalFontFace(const FontAttributes&);
 
@@ -11,6 +11,7 @@
 #define INCLUDED_VCL_INC_GRAPHIC_MANAGER_HXX
 
 #include <sal/types.h>
+#include <rtl/strbuf.hxx>
 #include <rtl/ustring.hxx>
 #include <vcl/bitmapex.hxx>
 #include <vcl/animate/Animation.hxx>
@@ -69,6 +70,9 @@ public:
     std::shared_ptr<ImpGraphic> newInstance(const Animation& rAnimation);
     std::shared_ptr<ImpGraphic> newInstance(const GDIMetaFile& rMtf);
     std::shared_ptr<ImpGraphic> newInstance(const GraphicExternalLink& rGraphicLink);
+
+    /// Append the number of graphics and the memory they use for LOK's dumpState.
+    void dumpState(rtl::OStringBuffer& rState);
 };
 
 } // end namespace vcl::graphic
@@ -216,7 +216,12 @@ static void testCachedGlyphsSubstring( const OUString& aText, const OUString& aF
             CPPUNIT_ASSERT_MESSAGE(message, aGlyphs2 != nullptr);
             checkCompareGlyphs(aGlyphs1, *aGlyphs2, message);
         }
-
+    // Subsets are cached as well, asking again must not lay out anything.
+    const size_t nHits = SalLayoutGlyphsCache::self()->GetHitCount();
+    const size_t nMisses = SalLayoutGlyphsCache::self()->GetMissCount();
+    SalLayoutGlyphsCache::self()->GetLayoutGlyphs(pOutputDevice, aText, 1, 1, 0, layoutCache.get());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE(prefix, nHits + 1, SalLayoutGlyphsCache::self()->GetHitCount());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE(prefix, nMisses, SalLayoutGlyphsCache::self()->GetMissCount());
 }
 
 // Check that SalLayoutGlyphsCache works properly when it builds a subset
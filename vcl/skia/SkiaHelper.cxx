@@ -665,7 +665,10 @@ void removeCachedImage(sk_sp<SkImage> image)
 tools::Long maxImageCacheSize()
 {
     // Defaults to 4x 2000px 32bpp images, 64MiB.
-    return officecfg::Office::Common::Cache::Skia::ImageCacheSize::get();
+    // This is queried for every cached image and every bitmap draw that may use
+    // the cache, so read the configuration only once.
+    static const tools::Long size = officecfg::Office::Common::Cache::Skia::ImageCacheSize::get();
+    return size;
 }
 
 static o3tl::lru_map<uint32_t, uint32_t> checksumCache(256);
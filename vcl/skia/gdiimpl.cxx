@@ -2105,16 +2105,22 @@ void SkiaSalGraphicsImpl::drawGenericLayout(const GenericSalLayout& layout, Colo
     glyphIds.reserve(256);
     glyphForms.reserve(256);
     verticals.reserve(256);
+    // All glyphs share the layout orientation, vertical ones are turned by
+    // another 90 degrees, so there are only two rotations to compute.
+    const Degree10 angle = layout.GetOrientation();
+    const double fCos = toCos(angle);
+    const double fSin = toSin(angle);
+    const double fVerticalCos = toCos(angle + 900_deg10);
+    const double fVerticalSin = toSin(angle + 900_deg10);
     DevicePoint aPos;
     const GlyphItem* pGlyph;
     int nStart = 0;
     while (layout.GetNextGlyph(&pGlyph, aPos, nStart))
     {
         glyphIds.push_back(pGlyph->glyphId());
-        Degree10 angle = layout.GetOrientation();
-        if (pGlyph->IsVertical())
-            angle += 900_deg10;
-        SkRSXform form = SkRSXform::Make(toCos(angle), toSin(angle), aPos.getX(), aPos.getY());
+        SkRSXform form = pGlyph->IsVertical()
+                             ? SkRSXform::Make(fVerticalCos, fVerticalSin, aPos.getX(), aPos.getY())
+                             : SkRSXform::Make(fCos, fSin, aPos.getX(), aPos.getY());
         glyphForms.emplace_back(std::move(form));
         verticals.emplace_back(pGlyph->IsVertical());
     }
@@ -2130,6 +2136,7 @@ void SkiaSalGraphicsImpl::drawGenericLayout(const GenericSalLayout& layout, Colo
     SAL_INFO("vcl.skia.trace", "drawtextblob(" << this << "): " << getBoundRect() << ", "
                                                << glyphIds.size() << " glyphs, " << textColor);
 
+    SkPaint paint = makeTextPaint(textColor);
     // Vertical glyphs need a different font, so split drawing into runs that each
     // draw only consecutive horizontal or vertical glyphs.
     std::vector<bool>::const_iterator pos = verticals.cbegin();
@@ -2144,7 +2151,6 @@ void SkiaSalGraphicsImpl::drawGenericLayout(const GenericSalLayout& layout, Colo
             glyphIds.data() + index, count * sizeof(SkGlyphID), glyphForms.data() + index,
             verticalRun ? verticalFont : font, SkTextEncoding::kGlyphID);
         addUpdateRegion(textBlob->bounds());
-        SkPaint paint = makeTextPaint(textColor);
         getDrawCanvas()->drawTextBlob(textBlob, 0, 0, paint);
         pos = rangeEnd;
     }
@@ -371,6 +371,8 @@ void Scheduler::CallbackTaskScheduling()
         while (pSchedulerData)
         {
             ++nTasks;
+#ifdef SAL_LOG_INFO
+            // don't pay for the dynamic_cast on every task and run without logging
             const Timer *timer = dynamic_cast<Timer*>( pSchedulerData->mpTask );
             if ( timer )
                 SAL_INFO( "vcl.schedule", tools::Time::GetSystemTicks() << " "
@@ -382,6 +384,7 @@ void Scheduler::CallbackTaskScheduling()
             else
                 SAL_INFO( "vcl.schedule", tools::Time::GetSystemTicks() << " "
                         << pSchedulerData << " " << *pSchedulerData << " (to be deleted)" );
+#endif
 
             // Should the Task be released from scheduling?
             assert(!pSchedulerData->mbInScheduler);
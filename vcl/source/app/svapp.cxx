@@ -48,6 +48,7 @@
 #include <vcl/wrkwin.hxx>
 #include <vcl/svapp.hxx>
 #include <vcl/cvtgrf.hxx>
+#include <vcl/glyphitemcache.hxx>
 #include <vcl/toolkit/unowrap.hxx>
 #include <vcl/timer.hxx>
 #include <vcl/scheduler.hxx>
@@ -57,6 +58,7 @@
 #include <salframe.hxx>
 #include <salsys.hxx>
 #include <svdata.hxx>
+#include <graphic/Manager.hxx>
 #include <displayconnectiondispatch.hxx>
 #include <window.h>
 #include <accmgr.hxx>
@@ -1866,6 +1868,18 @@ void dumpState(rtl::OStringBuffer &rState)
 
         pWin = Application::GetNextTopLevelWindow( pWin );
     }
+
+    vcl::graphic::Manager::get().dumpState(rState);
+
+    SalLayoutGlyphsCache* pGlyphsCache = SalLayoutGlyphsCache::self();
+    if (!pGlyphsCache)
+        return;
+    rState.append("\nGlyph cache:\t");
+    rState.append(static_cast<sal_Int64>(pGlyphsCache->GetCachedSize()));
+    rState.append("\tbytes, hits:\t");
+    rState.append(static_cast<sal_Int64>(pGlyphsCache->GetHitCount()));
+    rState.append("\tmisses:\t");
+    rState.append(static_cast<sal_Int64>(pGlyphsCache->GetMissCount()));
 }
 
 } // namespace lok, namespace vcl
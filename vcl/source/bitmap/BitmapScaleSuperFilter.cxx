@@ -183,6 +183,8 @@ void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
     using ScaleFunction = ScaleFunc<nColorComponents>;
     const sal_Int32 nStartX = 0;
     const sal_Int32 nEndX = rCtx.mnDestW - 1;
+    // source lines of the current destination line, the same for all its pixels
+    std::vector<Scanline> aSrcLines;
 
     for (sal_Int32 nY = nStartY; nY <= nEndY; nY++)
     {
@@ -203,6 +205,10 @@ void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
                             1 : (rCtx.maMapIY[nBottom] - rCtx.maMapIY[nTop]);
         }
 
+        aSrcLines.resize(nLineRange + 1);
+        for (sal_Int32 i = 0; i <= nLineRange; i++)
+            aSrcLines[i] = rCtx.mpSrc->GetScanline(nLineStart + i);
+
         Scanline pScanDest = rCtx.mpDest->GetScanline(nY);
         for (sal_Int32 nX = nStartX; nX <= nEndX; nX++)
         {
@@ -228,7 +234,7 @@ void scaleDown (const ScaleContext &rCtx, sal_Int32 nStartY, sal_Int32 nEndY)
 
             for (sal_Int32 i = 0; i<= nLineRange; i++)
             {
-                Scanline pTmpY = rCtx.mpSrc->GetScanline(nLineStart + i);
+                Scanline pTmpY = aSrcLines[i];
                 Scanline pTmpX = pTmpY + nColorComponents * nRowStart;
 
                 std::array<int, nColorComponents> sumRows{}; // zero-initialize
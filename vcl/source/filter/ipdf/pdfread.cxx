@@ -87,19 +87,33 @@ size_t RenderPDFBitmaps(const void* pBuffer, int nSize, std::vector<BitmapEx>& r
                                      /*nStartY=*/0, nPageWidth, nPageHeight);
 
         // Save the buffer as a bitmap.
+        ConstScanline pPdfBuffer = pPdfBitmap->getBuffer();
+        const int nStride = pPdfBitmap->getStride();
         Bitmap aBitmap(Size(nPageWidth, nPageHeight), vcl::PixelFormat::N24_BPP);
-        AlphaMask aMask(Size(nPageWidth, nPageHeight));
         {
             BitmapScopedWriteAccess pWriteAccess(aBitmap);
+            for (int nRow = 0; nRow < nPageHeight; ++nRow)
+            {
+                // pdfium byte order is BGRA.
+                pWriteAccess->CopyScanline(nRow, pPdfBuffer + (nStride * nRow),
+                                           ScanlineFormat::N32BitTcBgra, nStride);
+            }
+        }
+
+        if (!bTransparent)
+        {
+            // The alpha channel would be dropped anyway, don't extract it.
+            rBitmaps.emplace_back(std::move(aBitmap));
+            continue;
+        }
+
+        AlphaMask aMask(Size(nPageWidth, nPageHeight));
+        {
             AlphaScopedWriteAccess pMaskAccess(aMask);
-            ConstScanline pPdfBuffer = pPdfBitmap->getBuffer();
-            const int nStride = pPdfBitmap->getStride();
             std::vector<sal_uInt8> aScanlineAlpha(nPageWidth);
             for (int nRow = 0; nRow < nPageHeight; ++nRow)
             {
                 ConstScanline pPdfLine = pPdfBuffer + (nStride * nRow);
-                // pdfium byte order is BGRA.
-                pWriteAccess->CopyScanline(nRow, pPdfLine, ScanlineFormat::N32BitTcBgra, nStride);
                 for (int nCol = 0; nCol < nPageWidth; ++nCol)
                 {
                     // Invert alpha (source is alpha, target is opacity).
@@ -111,14 +125,7 @@ size_t RenderPDFBitmaps(const void* pBuffer, int nSize, std::vector<BitmapEx>& r
             }
         }
 
-        if (bTransparent)
-        {
-            rBitmaps.emplace_back(aBitmap, aMask);
-        }
-        else
-        {
-            rBitmaps.emplace_back(std::move(aBitmap));
-        }
+        rBitmaps.emplace_back(aBitmap, aMask);
     }
 
     return rBitmaps.size();
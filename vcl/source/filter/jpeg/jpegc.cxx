@@ -297,22 +297,30 @@ static void ReadJPEG(JpegStuff& rContext, JPEGReader* pJPEGReader, void* pInputS
 
             JSAMPLE* aRangeLimit = rContext.cinfo.sample_range_limit;
 
-            rContext.pScanLineBuffer.resize(nWidth * nPixelSize);
+            const bool bCMYK = rContext.cinfo.out_color_space == JCS_CMYK;
+            // when libjpeg produces the format of the bitmap, decode straight into it
+            const bool bDirect = !bCMYK && eScanlineFormat == eFinalFormat;
 
-            if (rContext.cinfo.out_color_space == JCS_CMYK)
+            if (bCMYK)
             {
                 rContext.pCYMKBuffer.resize(nWidth * 4);
             }
+            else if (!bDirect)
+            {
+                rContext.pScanLineBuffer.resize(nWidth * nPixelSize);
+            }
 
             // tdf#138950 allow up to one short read (no_data_available_failures <= 1) to not trigger cancelling import
             for (*pLines = 0; *pLines < nHeight && source->no_data_available_failures <= 1; (*pLines)++)
             {
                 size_t yIndex = *pLines;
 
-                sal_uInt8* p = (rContext.cinfo.out_color_space == JCS_CMYK) ? rContext.pCYMKBuffer.data() : rContext.pScanLineBuffer.data();
+                sal_uInt8* p = bCMYK ? rContext.pCYMKBuffer.data()
+                               : bDirect ? pAccess->GetScanline(yIndex)
+                               : rContext.pScanLineBuffer.data();
                 jpeg_read_scanlines(&rContext.cinfo, reinterpret_cast<JSAMPARRAY>(&p), 1);
 
-                if (rContext.cinfo.out_color_space == JCS_CMYK)
+                if (bCMYK)
                 {
                     // convert CMYK to RGB
                     Scanline pScanline = pAccess->GetScanline(yIndex);
@@ -330,7 +338,7 @@ static void ReadJPEG(JpegStuff& rContext, JPEGReader* pJPEGReader, void* pInputS
                         pAccess->SetPixelOnData(pScanline, x, BitmapColor(cRed, cGreen, cBlue));
                     }
                 }
-                else
+                else if (!bDirect)
                 {
                     pAccess->CopyScanline(yIndex, rContext.pScanLineBuffer.data(), eScanlineFormat, rContext.pScanLineBuffer.size());
                 }
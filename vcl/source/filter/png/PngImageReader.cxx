@@ -370,21 +370,25 @@ bool reader(SvStream& rStream, BitmapEx& rBitmapEx,
                 for (int pass = 0; pass < nNumberOfPasses; pass++)
                 {
                     for (png_uint_32 y = 0; y < height; y++)
+                        png_read_row(pPng, aRows[y].data(), nullptr);
+                }
+                // the rows are only complete after the last pass, split them once
+                for (png_uint_32 y = 0; y < height; y++)
+                {
+                    Scanline pScanline = pWriteAccess->GetScanline(y);
+                    Scanline pScanAlpha = pWriteAccessAlpha->GetScanline(y);
+                    png_bytep pRow = aRows[y].data();
+                    size_t iAlpha = 0;
+                    size_t iColor = 0;
+                    for (size_t i = 0; i < aRowSizeBytes; i += 4)
                     {
-                        Scanline pScanline = pWriteAccess->GetScanline(y);
-                        Scanline pScanAlpha = pWriteAccessAlpha->GetScanline(y);
-                        png_bytep pRow = aRows[y].data();
-                        png_read_row(pPng, pRow, nullptr);
-                        size_t iAlpha = 0;
-                        size_t iColor = 0;
-                        for (size_t i = 0; i < aRowSizeBytes; i += 4)
-                        {
-                            pScanline[iColor++] = pRow[i + 0];
-                            pScanline[iColor++] = pRow[i + 1];
-                            pScanline[iColor++] = pRow[i + 2];
-                            pScanAlpha[iAlpha++] = 0xFF - pRow[i + 3];
-                        }
+                        pScanline[iColor++] = pRow[i + 0];
+                        pScanline[iColor++] = pRow[i + 1];
+                        pScanline[iColor++] = pRow[i + 2];
+                        pScanAlpha[iAlpha++] = 0xFF - pRow[i + 3];
                     }
+                    // free each row as soon as it was copied
+                    std::vector<png_byte>().swap(aRows[y]);
                 }
             }
         }
@@ -34,6 +34,7 @@
 #include <font/PhysicalFontFace.hxx>
 #include <o3tl/string_view.hxx>
 
+#include <memory>
 #include <string_view>
 
 #include <hb-ot.h>
@@ -358,13 +359,19 @@ bool PhysicalFontFace::CreateFontSubset(std::vector<sal_uInt8>& rOutBuffer,
                                         const sal_GlyphId* pGlyphIds, const sal_uInt8* pEncoding,
                                         const int nGlyphCount, FontSubsetInfo& rInfo) const
 {
-    // Prepare data for font subsetter.
-    TrueTypeFace aSftFont(RawFace(GetHbFace()), GetFontCharMap());
-    if (aSftFont.initialize() != SFErrCodes::Ok)
-        return false;
+    // Prepare data for font subsetter. Fonts with many used glyphs are split
+    // into several subsets, so keep the parsed font instead of indexing its
+    // glyph data again for each of them (and again for each export).
+    if (!mpSftFont)
+    {
+        auto pSftFont = std::make_unique<TrueTypeFace>(RawFace(GetHbFace()), GetFontCharMap());
+        if (pSftFont->initialize() != SFErrCodes::Ok)
+            return false;
+        mpSftFont = std::move(pSftFont);
+    }
 
     // write subset into destination file
-    return CreateTTFfontSubset(aSftFont, rOutBuffer, pGlyphIds, pEncoding, nGlyphCount, rInfo);
+    return CreateTTFfontSubset(*mpSftFont, rOutBuffer, pGlyphIds, pEncoding, nGlyphCount, rInfo);
 }
 
 bool PhysicalFontFace::HasColorLayers() const
@@ -40,6 +40,7 @@
 #include <hb-ot.h>
 #include <hb-graphite2.h>
 
+#include <algorithm>
 #include <memory>
 
 GenericSalLayout::GenericSalLayout(LogicalFontInstance &rFont)
@@ -311,6 +312,18 @@ bool GenericSalLayout::LayoutText(vcl::text::ImplLayoutArgs& rArgs, const SalLay
 
     ParseFeatures(rFontSelData.maTargetName);
 
+    // The language is the same for all runs, look it up once
+    hb_language_t pHbLanguage;
+    if (!msLanguage.isEmpty())
+    {
+        pHbLanguage = hb_language_from_string(msLanguage.getStr(), msLanguage.getLength());
+    }
+    else
+    {
+        OString sLanguage = OUStringToOString(rArgs.maLanguageTag.getBcp47(), RTL_TEXTENCODING_ASCII_US);
+        pHbLanguage = hb_language_from_string(sLanguage.getStr(), sLanguage.getLength());
+    }
+
     double nXScale = 0;
     double nYScale = 0;
     GetFont().GetScale(&nXScale, &nYScale);
@@ -326,15 +339,14 @@ bool GenericSalLayout::LayoutText(vcl::text::ImplLayoutArgs& rArgs, const SalLay
         // Find script subruns.
         std::vector<SubRun> aSubRuns;
         int nCurrentPos = nBidiMinRunPos;
-        size_t k = 0;
-        for (; k < pTextLayout->runs.size(); ++k)
-        {
-            vcl::text::Run const& rRun(pTextLayout->runs[k]);
-            if (rRun.nStart <= nCurrentPos && nCurrentPos < rRun.nEnd)
-            {
-                break;
-            }
-        }
+        // The script runs are sorted and don't overlap, so binary search for
+        // the one containing nCurrentPos instead of scanning them for every
+        // bidi run.
+        auto itRun = std::upper_bound(pTextLayout->runs.begin(), pTextLayout->runs.end(), nCurrentPos,
+                                      [](int nPos, vcl::text::Run const& rRun) { return nPos < rRun.nEnd; });
+        size_t k = itRun - pTextLayout->runs.begin();
+        if (itRun != pTextLayout->runs.end() && nCurrentPos < itRun->nStart)
+            k = pTextLayout->runs.size();
 
         if (isGraphite)
         {
@@ -432,15 +444,7 @@ bool GenericSalLayout::LayoutText(vcl::text::ImplLayoutArgs& rArgs, const SalLay
 
             hb_buffer_set_direction(pHbBuffer, aSubRun.maDirection);
             hb_buffer_set_script(pHbBuffer, aSubRun.maScript);
-            if (!msLanguage.isEmpty())
-            {
-                hb_buffer_set_language(pHbBuffer, hb_language_from_string(msLanguage.getStr(), msLanguage.getLength()));
-            }
-            else
-            {
-                OString sLanguage = OUStringToOString(rArgs.maLanguageTag.getBcp47(), RTL_TEXTENCODING_ASCII_US);
-                hb_buffer_set_language(pHbBuffer, hb_language_from_string(sLanguage.getStr(), sLanguage.getLength()));
-            }
+            hb_buffer_set_language(pHbBuffer, pHbLanguage);
             hb_buffer_set_flags(pHbBuffer, static_cast<hb_buffer_flags_t>(nHbFlags));
             hb_buffer_add_utf16(
                 pHbBuffer, reinterpret_cast<uint16_t const *>(pStr), nLength,
@@ -340,11 +340,8 @@ void GDIMetaFile::Play( GDIMetaFile& rMtf )
     }
 }
 
-void GDIMetaFile::Play(OutputDevice& rOut, size_t nPos)
+void GDIMetaFile::ImplPlayActions(OutputDevice& rOut, size_t nPos)
 {
-    if( m_bRecord )
-        return;
-
     MetaAction* pAction = GetCurAction();
     const size_t nObjCount = m_aList.size();
     size_t  nSyncCount = rOut.GetSyncCount();
@@ -352,6 +349,30 @@ void GDIMetaFile::Play(OutputDevice& rOut, size_t nPos)
     if( nPos > nObjCount )
         nPos = nObjCount;
 
+    size_t  i  = 0;
+    for( size_t nCurPos = m_nCurrentActionElement; nCurPos < nPos; nCurPos++ )
+    {
+        if( pAction )
+        {
+            pAction->Execute(&rOut);
+
+            // flush output from time to time
+            if( i++ > nSyncCount )
+            {
+                rOut.Flush();
+                i = 0;
+            }
+        }
+
+        pAction = NextAction();
+    }
+}
+
+void GDIMetaFile::Play(OutputDevice& rOut, size_t nPos)
+{
+    if( m_bRecord )
+        return;
+
     // #i23407# Set backwards-compatible text language and layout mode
     // This is necessary, since old metafiles don't even know of these
     // recent add-ons. Newer metafiles must of course explicitly set
@@ -362,25 +383,8 @@ void GDIMetaFile::Play(OutputDevice& rOut, size_t nPos)
 
     SAL_INFO( "vcl.gdi", "GDIMetaFile::Play on device of size: " << rOut.GetOutputSizePixel().Width() << " " << rOut.GetOutputSizePixel().Height());
 
-    if (!ImplPlayWithRenderer(rOut, Point(0,0), rOut.GetOutputSize())) {
-        size_t  i  = 0;
-        for( size_t nCurPos = m_nCurrentActionElement; nCurPos < nPos; nCurPos++ )
-        {
-            if( pAction )
-            {
-                pAction->Execute(&rOut);
-
-                // flush output from time to time
-                if( i++ > nSyncCount )
-                {
-                    rOut.Flush();
-                    i = 0;
-                }
-            }
-
-            pAction = NextAction();
-        }
-    }
+    if (!ImplPlayWithRenderer(rOut, Point(0,0), rOut.GetOutputSize()))
+        ImplPlayActions(rOut, nPos);
     rOut.Pop();
 }
 
@@ -528,7 +532,9 @@ void GDIMetaFile::Play(OutputDevice& rOut, const Point& rPos,
     rOut.SetLayoutMode(vcl::text::ComplexTextLayoutFlags::Default);
     rOut.SetDigitLanguage(LANGUAGE_SYSTEM);
 
-    Play(rOut);
+    // the renderer was already tried above, don't set it up a second time
+    if( !m_bRecord )
+        ImplPlayActions(rOut, GDI_METAFILE_END);
 
     rOut.Pop();
 }
@@ -19,6 +19,7 @@
 
 #include <impglyphitem.hxx>
 #include <utility>
+#include <sal/log.hxx>
 #include <vcl/glyphitemcache.hxx>
 #include <vcl/vcllayout.hxx>
 #include <vcl/lazydelete.hxx>
@@ -227,7 +228,13 @@ bool SalLayoutGlyphsImpl::IsValid() const
     return true;
 }
 
-void SalLayoutGlyphsCache::clear() { mCachedGlyphs.clear(); }
+void SalLayoutGlyphsCache::clear()
+{
+    SAL_INFO("vcl.gdi", "glyphs cache cleared after " << mnHits << " hits and " << mnMisses
+                                                       << " misses");
+    mCachedGlyphs.clear();
+    mnHits = mnMisses = 0;
+}
 
 SalLayoutGlyphsCache* SalLayoutGlyphsCache::self()
 {
@@ -334,6 +341,7 @@ SalLayoutGlyphsCache::GetLayoutGlyphs(VclPtr<const OutputDevice> outputDevice, c
     GlyphsCache::const_iterator it = mCachedGlyphs.find(key);
     if (it != mCachedGlyphs.end())
     {
+        ++mnHits;
         if (it->second.IsValid())
             return &it->second;
         // Do not try to create the layout here. If a cache item exists, it's already
@@ -341,6 +349,7 @@ SalLayoutGlyphsCache::GetLayoutGlyphs(VclPtr<const OutputDevice> outputDevice, c
         // So in that case this is a cached failure.
         return nullptr;
     }
+    ++mnMisses;
     bool resetLastSubstringKey = true;
     const sal_Unicode nbSpace = 0xa0; // non-breaking space
     // SalLayoutGlyphsImpl::cloneCharRange() requires BiDiStrong, so if not set, do not even try.
@@ -352,8 +361,6 @@ SalLayoutGlyphsCache::GetLayoutGlyphs(VclPtr<const OutputDevice> outputDevice, c
         // and then with an increasing starting index until the end of the string.
         // Which means it's possible to get the glyphs faster by just copying
         // a subset of the full glyphs and adjusting as necessary.
-        if (mLastTemporaryKey.has_value() && mLastTemporaryKey == key)
-            return &mLastTemporaryGlyphs;
         const CachedGlyphsKey keyWhole(outputDevice, text, 0, text.getLength(), nLogicWidth);
         GlyphsCache::const_iterator itWhole = mCachedGlyphs.find(keyWhole);
         if (itWhole == mCachedGlyphs.end())
@@ -403,11 +410,10 @@ SalLayoutGlyphsCache::GetLayoutGlyphs(VclPtr<const OutputDevice> outputDevice, c
         if (itWhole != mCachedGlyphs.end() && itWhole->second.IsValid())
         {
             mLastSubstringKey.reset();
-            mLastTemporaryGlyphs
+            SalLayoutGlyphs glyphs
                 = makeGlyphsSubset(itWhole->second, outputDevice, text, nIndex, nLen);
-            if (mLastTemporaryGlyphs.IsValid())
+            if (glyphs.IsValid())
             {
-                mLastTemporaryKey = key;
 #ifdef DBG_UTIL
                 std::shared_ptr<const vcl::text::TextLayoutCache> tmpLayoutCache;
                 if (layoutCache == nullptr)
@@ -421,9 +427,12 @@ SalLayoutGlyphsCache::GetLayoutGlyphs(VclPtr<const OutputDevice> outputDevice, c
                     = outputDevice->ImplLayout(text, nIndex, nLen, Point(0, 0), nLogicWidth, {}, {},
                                                SalLayoutFlags::GlyphItemsOnly, layoutCache);
                 assert(layout);
-                checkGlyphsEqual(mLastTemporaryGlyphs, layout->GetGlyphs());
+                checkGlyphsEqual(glyphs, layout->GetGlyphs());
 #endif
-                return &mLastTemporaryGlyphs;
+                // Cache the subset too, the same portion is usually painted again, and
+                // repeated text in other paragraphs or pages finds it without the whole text.
+                mCachedGlyphs.insert(std::make_pair(key, std::move(glyphs)));
+                return &mCachedGlyphs.begin()->second;
             }
         }
     }
@@ -455,7 +464,6 @@ SalLayoutGlyphsCache::GetLayoutGlyphs(VclPtr<const OutputDevice> outputDevice, c
             if (!mbCacheGlyphsWhenDoingFallbackFonts && glyphs.Impl(1) != nullptr)
             {
                 mLastTemporaryGlyphs = std::move(glyphs);
-                mLastTemporaryKey.reset();
                 return &mLastTemporaryGlyphs;
             }
             mCachedGlyphs.insert(std::make_pair(key, std::move(glyphs)));
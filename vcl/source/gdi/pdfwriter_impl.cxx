@@ -9447,11 +9447,14 @@ bool PDFWriterImpl::writeBitmapObject( const BitmapEmit& rObject, bool bMask )
         {
             const int nScanLineBytes = pAccess->Width()*3;
             std::unique_ptr<sal_uInt8[]> xCol(new sal_uInt8[nScanLineBytes]);
+            // true color, so there is no palette and the colors can be read
+            // from the scanline directly
             for( tools::Long y = 0; y < pAccess->Height(); y++ )
             {
+                Scanline pScanline = pAccess->GetScanline( y );
                 for( tools::Long x = 0; x < pAccess->Width(); x++ )
                 {
-                    BitmapColor aColor = pAccess->GetColor( y, x );
+                    BitmapColor aColor = pAccess->GetPixelFromData( pScanline, x );
                     xCol[3*x+0] = aColor.GetRed();
                     xCol[3*x+1] = aColor.GetGreen();
                     xCol[3*x+2] = aColor.GetBlue();
@@ -24,6 +24,10 @@
 #include <officecfg/Office/Common.hxx>
 #include <unotools/configmgr.hxx>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 using namespace css;
 
 namespace vcl::graphic
@@ -81,10 +85,20 @@ void Manager::loopGraphicsAndSwapOut(std::unique_lock<std::mutex>& rGuard)
     // filter may create more temp Graphics which are auto-added to
     // m_pImpGraphicList invalidating a loop over m_pImpGraphicList, e.g.
     // reexport of tdf118346-1.odg
-    o3tl::sorted_vector<ImpGraphic*> aImpGraphicList = m_pImpGraphicList;
+    // m_pImpGraphicList is ordered by address, swap out the least recently
+    // used graphics first instead. maLastUsed is updated without maMutex, so
+    // sort on a snapshot of it.
+    std::vector<std::pair<std::chrono::high_resolution_clock::time_point, ImpGraphic*>>
+        aImpGraphicList;
+    aImpGraphicList.reserve(m_pImpGraphicList.size());
+    for (ImpGraphic* pEachImpGraphic : m_pImpGraphicList)
+        aImpGraphicList.emplace_back(pEachImpGraphic->maLastUsed, pEachImpGraphic);
+    std::sort(aImpGraphicList.begin(), aImpGraphicList.end(),
+              [](const auto& rA, const auto& rB) { return rA.first < rB.first; });
 
-    for (ImpGraphic* pEachImpGraphic : aImpGraphicList)
+    for (const auto& rEntry : aImpGraphicList)
     {
+        ImpGraphic* pEachImpGraphic = rEntry.second;
         if (mnUsedSize < sal_Int64(mnMemoryLimit * 0.7))
             return;
 
@@ -288,6 +302,18 @@ void Manager::changeExisting(const ImpGraphic* pImpGraphic, sal_Int64 nOldSizeBy
     mnUsedSize -= nOldSizeBytes;
     mnUsedSize += getGraphicSizeBytes(pImpGraphic);
 }
+
+void Manager::dumpState(rtl::OStringBuffer& rState)
+{
+    std::scoped_lock aGuard(maMutex);
+
+    rState.append("\nGraphics:\t");
+    rState.append(static_cast<sal_Int32>(m_pImpGraphicList.size()));
+    rState.append("\tused bytes:\t");
+    rState.append(mnUsedSize);
+    rState.append("\tlimit:\t");
+    rState.append(mnMemoryLimit);
+}
 } // end vcl::graphic
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
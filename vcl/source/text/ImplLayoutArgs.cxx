@@ -52,6 +52,14 @@ ImplLayoutArgs::ImplLayoutArgs(const OUString& rStr, int nMinCharPos, int nEndCh
         bool bRTL(mnFlags & SalLayoutFlags::BiDiRtl);
         AddRun(mnMinCharPos, mnEndCharPos, bRTL);
     }
+    else if (!(mnFlags & SalLayoutFlags::BiDiRtl) && mnMinCharPos < mnEndCharPos
+             && std::all_of(mrStr.getStr() + mnMinCharPos, mrStr.getStr() + mnEndCharPos,
+                            [](sal_Unicode c) { return c < 0x0590; }))
+    {
+        // there are no RTL characters, numbers or BiDi controls before the
+        // Hebrew block, so the BiDi algorithm would give a single LTR run
+        AddRun(mnMinCharPos, mnEndCharPos, false);
+    }
     else
     {
         // handle weak BiDi mode
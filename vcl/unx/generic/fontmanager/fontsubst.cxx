@@ -42,9 +42,18 @@ private:
 class FcGlyphFallbackSubstitution
 :    public vcl::font::GlyphFallbackFontSubstitution
 {
-    // TODO: add a cache
 public:
     bool FindFontSubstitute(vcl::font::FontSelectPattern&, LogicalFontInstance* pLogicalFont, OUString& rMissingCodes) const override;
+private:
+    struct CachedFallback
+    {
+        vcl::font::FontSelectPattern maFontSelData;
+        OUString maMissingCodes;
+        vcl::font::FontSelectPattern maSubstitute;
+        OUString maStillMissingCodes;
+    };
+    typedef ::std::list<CachedFallback> CachedFallbackListType;
+    mutable CachedFallbackListType maCachedFallbacks;
 };
 
 }
@@ -181,16 +190,44 @@ bool FcGlyphFallbackSubstitution::FindFontSubstitute(vcl::font::FontSelectPatter
     if ( IsOpenSymbol(rFontSelData.maSearchName) )
         return false;
 
-    const vcl::font::FontSelectPattern aOut = GetFcSubstitute( rFontSelData, rMissingCodes );
-    // TODO: cache the unicode + srcfont specific result
+    // cache the unicode + srcfont specific result, but not failures, as
+    // a font added later may provide the missing glyphs
     // FC doing it would be preferable because it knows the invariables
     // e.g. FC knows the FC rule that all Arial gets replaced by LiberationSans
     // whereas we would have to check for every size or attribute
+    CachedFallbackListType &rCachedFallbacks = maCachedFallbacks;
+    CachedFallbackListType::iterator itr = std::find_if(rCachedFallbacks.begin(), rCachedFallbacks.end(),
+        [&rFontSelData, &rMissingCodes](const CachedFallback& rOther)
+        { return rOther.maMissingCodes == rMissingCodes && rOther.maFontSelData == rFontSelData; });
+    if (itr != rCachedFallbacks.end())
+    {
+        // Cached substitution
+        rMissingCodes = itr->maStillMissingCodes;
+        rFontSelData = itr->maSubstitute;
+        if (itr != rCachedFallbacks.begin())
+        {
+            // MRU, move it to the front
+            rCachedFallbacks.splice(rCachedFallbacks.begin(), rCachedFallbacks, itr);
+        }
+        return true;
+    }
+
+    const OUString aMissingCodes(rMissingCodes);
+    const vcl::font::FontSelectPattern aOut = GetFcSubstitute( rFontSelData, rMissingCodes );
+
+    const bool bHaveSubstitute = !aOut.maSearchName.isEmpty() && !uselessmatch( rFontSelData, aOut );
+
+    if (bHaveSubstitute)
+    {
+        rCachedFallbacks.push_front(CachedFallback{ rFontSelData, aMissingCodes, aOut, rMissingCodes });
+        // same arbitrary limit as for the pre-match substitutions
+        if (rCachedFallbacks.size() > 256)
+            rCachedFallbacks.pop_back();
+    }
+
     if( aOut.maSearchName.isEmpty() )
         return false;
 
-    const bool bHaveSubstitute = !uselessmatch( rFontSelData, aOut );
-
 #ifdef DEBUG
     std::ostringstream oss;
     oss << "FcGFSubstitution \""
@@ -74,8 +74,8 @@ uno::Sequence< beans::PropertyValue > PropertyMap::GetPropertyValues( bool bChar
 {
     using comphelper::makePropertyValue;
 
-    if ( !m_aValues.empty() || m_vMap.empty() )
-        return comphelper::containerToSequence( m_aValues );
+    if ( m_aValues.hasElements() || m_vMap.empty() )
+        return m_aValues;
 
     size_t nCharGrabBag = 0;
     size_t nParaGrabBag = 0;
@@ -86,7 +86,8 @@ uno::Sequence< beans::PropertyValue > PropertyMap::GetPropertyValues( bool bChar
     const PropValue* pCharStyleProp = nullptr;
     const PropValue* pNumRuleProp   = nullptr;
 
-    m_aValues.reserve( m_vMap.size() );
+    std::vector< beans::PropertyValue > aValues;
+    aValues.reserve( m_vMap.size() );
     for ( const auto& rPropPair : m_vMap )
     {
         if ( rPropPair.second.getGrabBagType() == CHAR_GRAB_BAG )
@@ -112,11 +113,11 @@ uno::Sequence< beans::PropertyValue > PropertyMap::GetPropertyValues( bool bChar
     // Style names have to be the first elements within the property sequence
     // otherwise they will overwrite 'hard' attributes
     if ( pParaStyleProp != nullptr )
-        m_aValues.push_back( makePropertyValue( getPropertyName( PROP_PARA_STYLE_NAME ), pParaStyleProp->getValue() ) );
+        aValues.push_back( makePropertyValue( getPropertyName( PROP_PARA_STYLE_NAME ), pParaStyleProp->getValue() ) );
     if ( pCharStyleProp != nullptr )
-        m_aValues.push_back( makePropertyValue( getPropertyName( PROP_CHAR_STYLE_NAME ), pCharStyleProp->getValue() ) );
+        aValues.push_back( makePropertyValue( getPropertyName( PROP_CHAR_STYLE_NAME ), pCharStyleProp->getValue() ) );
     if ( pNumRuleProp != nullptr )
-        m_aValues.push_back( makePropertyValue(getPropertyName( PROP_NUMBERING_RULES ), pNumRuleProp->getValue() ) );
+        aValues.push_back( makePropertyValue(getPropertyName( PROP_NUMBERING_RULES ), pNumRuleProp->getValue() ) );
 
     // If there are any grab bag properties, we need one slot for them.
     uno::Sequence< beans::PropertyValue > aCharGrabBagValues( nCharGrabBag );
@@ -175,24 +176,25 @@ uno::Sequence< beans::PropertyValue > PropertyMap::GetPropertyValues( bool bChar
             }
             else
             {
-                m_aValues.push_back( makePropertyValue( getPropertyName( rPropPair.first ), rPropPair.second.getValue() ) );
+                aValues.push_back( makePropertyValue( getPropertyName( rPropPair.first ), rPropPair.second.getValue() ) );
             }
         }
     }
 
     if ( nCharGrabBag && bCharGrabBag )
-        m_aValues.push_back( makePropertyValue( "CharInteropGrabBag", uno::Any( aCharGrabBagValues ) ) );
+        aValues.push_back( makePropertyValue( "CharInteropGrabBag", uno::Any( aCharGrabBagValues ) ) );
 
     if ( nParaGrabBag )
-        m_aValues.push_back( makePropertyValue( "ParaInteropGrabBag", uno::Any( aParaGrabBagValues ) ) );
+        aValues.push_back( makePropertyValue( "ParaInteropGrabBag", uno::Any( aParaGrabBagValues ) ) );
 
     if ( nCellGrabBag )
-        m_aValues.push_back( makePropertyValue( "CellInteropGrabBag", uno::Any( aCellGrabBagValues ) ) );
+        aValues.push_back( makePropertyValue( "CellInteropGrabBag", uno::Any( aCellGrabBagValues ) ) );
 
     if ( nRowGrabBag )
-        m_aValues.push_back( makePropertyValue( "RowInteropGrabBag", uno::Any( aRowGrabBagValues ) ) );
+        aValues.push_back( makePropertyValue( "RowInteropGrabBag", uno::Any( aRowGrabBagValues ) ) );
 
-    return comphelper::containerToSequence( m_aValues );
+    m_aValues = comphelper::containerToSequence( aValues );
+    return m_aValues;
 }
 
 std::vector< PropertyIds > PropertyMap::GetPropertyIds()
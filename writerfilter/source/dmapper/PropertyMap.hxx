@@ -134,7 +134,8 @@ class PropertyMap : public SvRefBase
 {
 private:
     // Cache the property values for the GetPropertyValues() call(s).
-    std::vector< css::beans::PropertyValue >    m_aValues;
+    // Kept as a sequence, so that returning the cached values doesn't copy them.
+    css::uno::Sequence< css::beans::PropertyValue > m_aValues;
 
     // marks context as footnote context - ::text( ) events contain either the footnote character or can be ignored
     // depending on sprmCSymbol
@@ -196,8 +197,8 @@ public:
 protected:
     void Invalidate()
     {
-        if ( m_aValues.size() )
-            m_aValues.clear();
+        if ( m_aValues.hasElements() )
+            m_aValues = css::uno::Sequence< css::beans::PropertyValue >();
     }
 };
 
@@ -1210,10 +1210,14 @@ RTFError RTFDocumentImpl::resolveChars(char ch)
     {
         m_pBinaryData = std::make_shared<SvMemoryStream>();
         m_pBinaryData->WriteChar(ch);
-        for (int i = 0; i < m_aStates.top().getBinaryToRead() - 1; ++i)
-        {
-            Strm().ReadChar(ch);
-            m_pBinaryData->WriteChar(ch);
+        // read the rest of the binary data as a whole, not byte by byte
+        sal_uInt64 nToRead = std::max(m_aStates.top().getBinaryToRead() - 1, 0);
+        nToRead = std::min(nToRead, Strm().remainingSize());
+        if (nToRead)
+        {
+            std::vector<char> aData(nToRead);
+            std::size_t nRead = Strm().ReadBytes(aData.data(), nToRead);
+            m_pBinaryData->WriteBytes(aData.data(), nRead);
         }
         m_aStates.top().setInternalState(RTFInternalState::NORMAL);
         return RTFError::OK;
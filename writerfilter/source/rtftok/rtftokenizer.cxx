@@ -224,13 +224,19 @@ RTFError RTFTokenizer::resolveKeyword()
     int nParam = 0;
     if (rtl::isAsciiDigit(static_cast<unsigned char>(ch)))
     {
-        OStringBuffer aParameter;
-
-        // we have a parameter
+        // we have a parameter, convert it while reading it instead of
+        // collecting it in a buffer first; like o3tl::toInt32(), give 0 when
+        // it is out of range
         bParam = true;
+        sal_Int64 nValue = 0;
+        bool bOverflow = false;
         while (rtl::isAsciiDigit(static_cast<unsigned char>(ch)))
         {
-            aParameter.append(ch);
+            if (!bOverflow)
+            {
+                nValue = nValue * 10 + (ch - '0');
+                bOverflow = nValue > SAL_MAX_INT32;
+            }
             Strm().ReadChar(ch);
             if (Strm().eof())
             {
@@ -238,7 +244,7 @@ RTFError RTFTokenizer::resolveKeyword()
                 break;
             }
         }
-        nParam = o3tl::toInt32(aParameter);
+        nParam = bOverflow ? 0 : static_cast<int>(nValue);
         if (bNeg)
             nParam = -nParam;
     }
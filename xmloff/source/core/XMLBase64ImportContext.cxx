@@ -21,6 +21,7 @@
 
 #include <comphelper/base64.hxx>
 #include <o3tl/string_view.hxx>
+#include <rtl/character.hxx>
 
 #include <xmloff/xmlimp.hxx>
 #include <xmloff/XMLBase64ImportContext.hxx>
@@ -29,6 +30,14 @@ using namespace ::com::sun::star::uno;
 using namespace ::com::sun::star::xml::sax;
 using namespace ::com::sun::star::io;
 
+namespace
+{
+bool isBase64Char(sal_Unicode c)
+{
+    return rtl::isAsciiAlphanumeric(c) || c == '+' || c == '/' || c == '=';
+}
+}
+
 
 XMLBase64ImportContext::XMLBase64ImportContext(
         SvXMLImport& rImport,
@@ -58,6 +67,24 @@ void XMLBase64ImportContext::endFastElement(sal_Int32 )
 void XMLBase64ImportContext::characters( const OUString& rChars )
 {
     maCharBuffer.append(rChars);
+
+    // Decode and write out the complete groups of four characters from time
+    // to time, instead of holding all of possibly very large embedded data
+    // in memory until the end of the element.
+    if (maCharBuffer.getLength() < 65536)
+        return;
+
+    sal_Int32 nChars = 0;
+    sal_Int32 nGroupsEnd = 0;
+    for (sal_Int32 i = 0; i < maCharBuffer.getLength(); ++i)
+    {
+        if (isBase64Char(maCharBuffer[i]) && ++nChars % 4 == 0)
+            nGroupsEnd = i + 1;
+    }
+    Sequence< sal_Int8 > aBuffer( (nChars / 4) * 3 );
+    ::comphelper::Base64::decodeSomeChars( aBuffer, std::u16string_view(maCharBuffer).substr(0, nGroupsEnd) );
+    xOut->writeBytes( aBuffer );
+    maCharBuffer.remove(0, nGroupsEnd);
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
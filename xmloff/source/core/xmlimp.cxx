@@ -803,7 +803,7 @@ void SAL_CALL SvXMLImport::startFastElement (sal_Int32 Element,
     xContext->startFastElement( Element, Attribs );
 
     // Push context on stack.
-    maContexts.push(xContext);
+    maContexts.push(std::move(xContext));
 }
 
 void SAL_CALL SvXMLImport::startUnknownElement (const OUString & rNamespace, const OUString & rName,
@@ -840,7 +840,7 @@ void SAL_CALL SvXMLImport::startUnknownElement (const OUString & rNamespace, con
     }
 
     xContext->startUnknownElement( rNamespace, rName, Attribs );
-    maContexts.push(xContext);
+    maContexts.push(std::move(xContext));
 }
 
 void SAL_CALL SvXMLImport::endFastElement (sal_Int32 Element)
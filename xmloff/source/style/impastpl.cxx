@@ -267,6 +267,20 @@ struct ComparePartial
     }
 };
 
+/// Finds the last entry in [itBegin, itEnd) with properties equal to rProperties, itEnd if none.
+template<typename Iterator>
+Iterator lcl_FindLastEqual(const XMLAutoStyleFamily& rFamilyData, Iterator itBegin, Iterator itEnd,
+                           const std::vector< XMLPropertyState >& rProperties)
+{
+    for (auto it = itEnd; it != itBegin; )
+    {
+        --it;
+        if (rFamilyData.mxMapper->Equals(it->GetProperties(), rProperties))
+            return it;
+    }
+    return itEnd;
+}
+
 }
 
 // Adds an array of XMLPropertyState ( std::vector< XMLPropertyState > ) to list
@@ -274,12 +288,20 @@ struct ComparePartial
 
 bool XMLAutoStylePoolParent::Add( XMLAutoStyleFamily& rFamilyData, std::vector< XMLPropertyState >&& rProperties, OUString& rName, bool bDontSeek )
 {
-    PropertiesListType::iterator pProperties = m_PropertiesList.end();;
-    auto [itBegin, itEnd] = std::equal_range(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
-    if (!bDontSeek)
-        for (auto it = itBegin; it != itEnd; ++it)
-            if (rFamilyData.mxMapper->Equals(it->GetProperties(), rProperties))
-                pProperties = it;
+    PropertiesListType::iterator pProperties = m_PropertiesList.end();
+    PropertiesListType::iterator itBegin;
+    if (bDontSeek)
+        itBegin = std::lower_bound(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
+    else
+    {
+        auto aRange = std::equal_range(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
+        itBegin = aRange.first;
+        // the last matching entry is the one to use, so search backwards and
+        // stop at the first match
+        pProperties = lcl_FindLastEqual(rFamilyData, aRange.first, aRange.second, rProperties);
+        if (pProperties == aRange.second)
+            pProperties = m_PropertiesList.end();
+    }
 
     bool bAdded = false;
     if( bDontSeek || pProperties == m_PropertiesList.end() )
@@ -320,9 +342,9 @@ OUString XMLAutoStylePoolParent::Find( const XMLAutoStyleFamily& rFamilyData, co
 {
     OUString sName;
     auto [itBegin,itEnd] = std::equal_range(m_PropertiesList.begin(), m_PropertiesList.end(), rProperties, ComparePartial{rFamilyData});
-    for (auto it = itBegin; it != itEnd; ++it)
-        if (rFamilyData.mxMapper->Equals(it->GetProperties(), rProperties))
-            sName = it->GetName();
+    auto it = lcl_FindLastEqual(rFamilyData, itBegin, itEnd, rProperties);
+    if (it != itEnd)
+        sName = it->GetName();
 
     return sName;
 }
@@ -30,6 +30,8 @@
 
 #include <com/sun/star/beans/XPropertySet.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
 using namespace ::com::sun::star::uno;
@@ -89,12 +91,47 @@ struct XMLPropertySetMapper::Impl
 {
     std::vector<XMLPropertySetMapperEntry_Impl> maMapEntries;
     std::vector<rtl::Reference <XMLPropertyHandlerFactory> > maHdlFactories;
+    /// Indexes of maMapEntries, sorted by XML attribute name and then by index
+    std::vector<sal_Int32> maNameIndex;
 
     bool mbOnlyExportMappings;
 
     explicit Impl( bool bForExport ) : mbOnlyExportMappings(bForExport) {}
+
+    void UpdateNameIndex();
+    sal_Int32 GetEntryIndex( sal_uInt16 nNamespace, std::u16string_view rStrName,
+                             sal_uInt32 nPropType, sal_Int32 nStartAt ) const;
 };
 
+void XMLPropertySetMapper::Impl::UpdateNameIndex()
+{
+    maNameIndex.resize(maMapEntries.size());
+    std::iota(maNameIndex.begin(), maNameIndex.end(), 0);
+    std::stable_sort(maNameIndex.begin(), maNameIndex.end(),
+                     [this](sal_Int32 n1, sal_Int32 n2)
+                     { return maMapEntries[n1].sXMLAttributeName < maMapEntries[n2].sXMLAttributeName; });
+}
+
+sal_Int32 XMLPropertySetMapper::Impl::GetEntryIndex(
+        sal_uInt16 nNamespace, std::u16string_view rStrName,
+        sal_uInt32 nPropType, sal_Int32 nStartAt ) const
+{
+    sal_Int32 nIndex = nStartAt == -1 ? 0 : nStartAt + 1;
+    auto it = std::lower_bound(maNameIndex.begin(), maNameIndex.end(), rStrName,
+                               [this](sal_Int32 n, std::u16string_view rName)
+                               { return std::u16string_view(maMapEntries[n].sXMLAttributeName) < rName; });
+    for (; it != maNameIndex.end() && maMapEntries[*it].sXMLAttributeName == rStrName; ++it)
+    {
+        const XMLPropertySetMapperEntry_Impl& rEntry = maMapEntries[*it];
+        if( *it >= nIndex &&
+            (!nPropType || nPropType == rEntry.GetPropType()) &&
+            rEntry.nXMLNameSpace == nNamespace )
+            return *it;
+    }
+
+    return -1;
+}
+
 // Ctor
 XMLPropertySetMapper::XMLPropertySetMapper(
     const XMLPropertyMapEntry* pEntries, const rtl::Reference<XMLPropertyHandlerFactory>& rFactory,
@@ -128,6 +165,7 @@ XMLPropertySetMapper::XMLPropertySetMapper(
             ++pIter;
         }
     }
+    mpImpl->UpdateNameIndex();
 }
 
 XMLPropertySetMapper::~XMLPropertySetMapper()
@@ -147,6 +185,7 @@ void XMLPropertySetMapper::AddMapperEntry(
         if (!mpImpl->mbOnlyExportMappings || !rMapEntry.bImportOnly)
             mpImpl->maMapEntries.push_back( rMapEntry );
     }
+    mpImpl->UpdateNameIndex();
 }
 
 sal_Int32 XMLPropertySetMapper::GetEntryCount() const
@@ -248,25 +287,7 @@ sal_Int32 XMLPropertySetMapper::GetEntryIndex(
         sal_uInt32 nPropType,
         sal_Int32 nStartAt /* = -1 */ ) const
 {
-    sal_Int32 nEntries = GetEntryCount();
-    sal_Int32 nIndex= nStartAt == - 1? 0 : nStartAt+1;
-
-    if ( nEntries && nIndex < nEntries )
-    {
-        do
-        {
-            const XMLPropertySetMapperEntry_Impl& rEntry = mpImpl->maMapEntries[nIndex];
-            if( (!nPropType || nPropType == rEntry.GetPropType()) &&
-                rEntry.nXMLNameSpace == nNamespace &&
-                rStrName == rEntry.sXMLAttributeName )
-                return nIndex;
-            else
-                nIndex++;
-
-        } while( nIndex<nEntries );
-    }
-
-    return -1;
+    return mpImpl->GetEntryIndex( nNamespace, rStrName, nPropType, nStartAt );
 }
 
 // Search for the given name and the namespace in the list and return
@@ -277,27 +298,9 @@ sal_Int32 XMLPropertySetMapper::GetEntryIndex(
         sal_uInt32 nPropType,
         sal_Int32 nStartAt /* = -1 */ ) const
 {
-    sal_Int32 nEntries = GetEntryCount();
-    sal_Int32 nIndex= nStartAt == - 1? 0 : nStartAt+1;
-
-    if ( nEntries && nIndex < nEntries )
-    {
-        sal_uInt16 nNamespace = (nElement >> NMSP_SHIFT) - 1;
-        const OUString& rStrName = SvXMLImport::getNameFromToken(nElement);
-        do
-        {
-            const XMLPropertySetMapperEntry_Impl& rEntry = mpImpl->maMapEntries[nIndex];
-            if( (!nPropType || nPropType == rEntry.GetPropType()) &&
-                rEntry.nXMLNameSpace == nNamespace &&
-                rStrName == rEntry.sXMLAttributeName )
-                return nIndex;
-            else
-                nIndex++;
-
-        } while( nIndex<nEntries );
-    }
-
-    return -1;
+    sal_uInt16 nNamespace = (nElement >> NMSP_SHIFT) - 1;
+    return mpImpl->GetEntryIndex( nNamespace, SvXMLImport::getNameFromToken(nElement),
+                                  nPropType, nStartAt );
 }
 
 /** searches for an entry that matches the given api name, namespace and local name or -1 if nothing found */
@@ -353,6 +356,7 @@ void XMLPropertySetMapper::RemoveEntry( sal_Int32 nIndex )
     std::vector < XMLPropertySetMapperEntry_Impl >::iterator aEIter = mpImpl->maMapEntries.begin();
     std::advance(aEIter, nIndex);
     mpImpl->maMapEntries.erase( aEIter );
+    mpImpl->UpdateNameIndex();
 }
 
 void XMLPropertySetMapper::GetEntryAPINames( o3tl::sorted_vector<OUString>& rNames) const
@@ -30,6 +30,8 @@
 #include <comphelper/scopeguard.hxx>
 #include <sal/log.hxx>
 
+#include <cstring>
+
 #include <com/sun/star/xml/crypto/XUriBinding.hpp>
 
 static bool g_bInputCallbacksEnabled = false;
@@ -37,6 +39,11 @@ static bool g_bInputCallbacksRegistered = false;
 
 static css::uno::Reference< css::xml::crypto::XUriBinding > m_xUriBinding ;
 
+// The stream found by the last xmlStreamMatch() call, xmlSec opens the same uri
+// right after matching it; don't resolve (and copy) the package stream twice.
+static OString g_aMatchedUri;
+static css::uno::Reference< css::io::XInputStream > g_xMatchedStream;
+
 extern "C" {
 
 static int xmlStreamMatch( const char* uri )
@@ -63,6 +70,8 @@ static int xmlStreamMatch( const char* uri )
             xInputStream = m_xUriBinding->getUriBinding(
                 OUString::createFromAscii(uri));
         }
+        g_aMatchedUri = xInputStream.is() ? OString(uri) : OString();
+        g_xMatchedStream = xInputStream;
     }
     SAL_INFO("xmlsecurity.xmlsec",
              "xmlStreamMath: uri is '" << uri << "', returning " << xInputStream.is());
@@ -81,17 +90,25 @@ static void* xmlStreamOpen( const char* uri )
         if( uri == nullptr || !m_xUriBinding.is() )
             return nullptr ;
 
-        //see xmlStreamMatch
-        OUString sUri =
-            ::rtl::Uri::encode( OUString::createFromAscii( uri ),
-            rtl_UriCharClassUric, rtl_UriEncodeKeepEscapes, RTL_TEXTENCODING_UTF8);
-        xInputStream = m_xUriBinding->getUriBinding( sUri ) ;
-        if (!xInputStream.is())
+        if (g_xMatchedStream.is() && g_aMatchedUri == uri)
         {
-            //For old documents.
-            //try the passed in uri directly.
-            xInputStream = m_xUriBinding->getUriBinding(
-                OUString::createFromAscii(uri));
+            xInputStream = std::move(g_xMatchedStream);
+            g_aMatchedUri.clear();
+        }
+        else
+        {
+            //see xmlStreamMatch
+            OUString sUri =
+                ::rtl::Uri::encode( OUString::createFromAscii( uri ),
+                rtl_UriCharClassUric, rtl_UriEncodeKeepEscapes, RTL_TEXTENCODING_UTF8);
+            xInputStream = m_xUriBinding->getUriBinding( sUri ) ;
+            if (!xInputStream.is())
+            {
+                //For old documents.
+                //try the passed in uri directly.
+                xInputStream = m_xUriBinding->getUriBinding(
+                    OUString::createFromAscii(uri));
+            }
         }
 
         if( xInputStream.is() ) {
@@ -122,9 +139,8 @@ static int xmlStreamRead( void* context, char* buffer, int len )
                 return 0 ;
 
             numbers = xInputStream->readBytes( outSeqs, len ) ;
-            const sal_Int8* readBytes = outSeqs.getArray() ;
-            for( int i = 0 ; i < numbers ; i ++ )
-                *( buffer + i ) = *( readBytes + i ) ;
+            if( numbers > 0 )
+                std::memcpy( buffer, outSeqs.getConstArray(), numbers ) ;
         }
     }
 
@@ -235,6 +251,8 @@ int xmlUnregisterStreamInputCallbacks()
     {
         //Clear the uri-stream binding
         m_xUriBinding.clear() ;
+        g_xMatchedStream.clear() ;
+        g_aMatchedUri.clear() ;
 
         //disable the registered flag
         g_bInputCallbacksRegistered = false;